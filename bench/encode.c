@@ -0,0 +1,153 @@
+#include "ast.h"
+#include "encoder/encoder.h"
+#include "error.h"
+#include "lexer.h"
+#include "parser/parser.h"
+#include "tokenlist.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Measures how many instructions per second encoder_encode gets through,
+ * without and with a cache of encodings. The program is lexed and parsed once,
+ * only the encoding is timed. */
+
+constexpr size_t bench_lines = 20000;
+constexpr size_t bench_rounds = 50;
+
+static const char *bench_instructions[] = {
+    "mov eax, ebx",
+    "mov rax, [rbx + rcx * 8 + 16]",
+    "mov [rsp + 8], r12",
+    "add r10, 1000",
+    "lea rdi, [rsi + rdx * 2]",
+    "xor ecx, ecx",
+    "cmp [rbp - 8], r8",
+    "imul rdx, rsi, 12",
+    "movzx eax, cl",
+    "push rbp",
+    "shl r9d, 3",
+    "test al, al",
+    "cmovne rax, rdx",
+    "ret",
+};
+
+constexpr size_t bench_instruction_count =
+    sizeof(bench_instructions) / sizeof(bench_instructions[0]);
+
+static error_t *write_program(char *path) {
+    int fd = mkstemp(path);
+    if (fd < 0)
+        return errorf("Could not create %s", path);
+    FILE *file = fdopen(fd, "w");
+    if (file == nullptr) {
+        close(fd);
+        return errorf("Could not open %s", path);
+    }
+    for (size_t i = 0; i < bench_lines; ++i)
+        fprintf(file, "%s\n", bench_instructions[i % bench_instruction_count]);
+    fclose(file);
+    return nullptr;
+}
+
+static double elapsed(struct timespec *start, struct timespec *end) {
+    return (double)(end->tv_sec - start->tv_sec) +
+           (double)(end->tv_nsec - start->tv_nsec) / 1e9;
+}
+
+// Encodes the program bench_rounds times, cache may be nullptr
+static error_t *encode(ast_node_t *program, encoder_cache_t *cache,
+                       double *seconds, size_t *bytes) {
+    *bytes = 0;
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t round = 0; round < bench_rounds; ++round) {
+        for (size_t i = 0; i < program->len; ++i) {
+            encoding_t encoding;
+            error_t *err = encoder_encode_cached(ast_node_child(program, i),
+                                                 cache, &encoding);
+            if (err)
+                return err;
+            *bytes += encoding.len;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    *seconds = elapsed(&start, &end);
+    return nullptr;
+}
+
+int main() {
+    char path[] = "/tmp/oas-bench-XXXXXX";
+    error_t *err = write_program(path);
+    if (err)
+        goto cleanup_error;
+
+    lexer_t *lex = &(lexer_t){};
+    err = lexer_open(lex, path);
+    unlink(path);
+    if (err)
+        goto cleanup_error;
+
+    tokenlist_t *list;
+    err = tokenlist_alloc(&list);
+    if (err)
+        goto cleanup_lexer;
+    err = tokenlist_fill(list, lex);
+    if (err)
+        goto cleanup_tokens;
+
+    parse_result_t result = parse(list->head);
+    if (result.err) {
+        err = result.err;
+        goto cleanup_tokens;
+    }
+    ast_node_t *program = result.node;
+
+    encoder_cache_t *cache;
+    err = encoder_cache_alloc(&cache);
+    if (err)
+        goto cleanup_program;
+
+    size_t encoded = program->len * bench_rounds;
+    size_t bytes, cached_bytes;
+    double seconds, cached_seconds;
+    err = encode(program, nullptr, &seconds, &bytes);
+    if (err == nullptr)
+        err = encode(program, cache, &cached_seconds, &cached_bytes);
+    if (err == nullptr && bytes != cached_bytes)
+        err = errorf("Cached encodings have %zu bytes instead of %zu",
+                     cached_bytes, bytes);
+    if (err)
+        goto cleanup_cache;
+
+    printf("encode: %zu instructions, %zu bytes in %.3fs, %.0f "
+           "instructions/s\n",
+           encoded, bytes, seconds, (double)encoded / seconds);
+    size_t lookups = cache->hits + cache->misses;
+    printf("encode: cached in %.3fs, %.0f instructions/s, %.2fx, "
+           "%.1f%% hits\n",
+           cached_seconds, (double)encoded / cached_seconds,
+           seconds / cached_seconds,
+           lookups ? 100.0 * (double)cache->hits / (double)lookups : 0.0);
+
+    encoder_cache_free(cache);
+    ast_node_free(program);
+    tokenlist_free(list);
+    lexer_close(lex);
+    return 0;
+
+cleanup_cache:
+    encoder_cache_free(cache);
+cleanup_program:
+    ast_node_free(program);
+cleanup_tokens:
+    tokenlist_free(list);
+cleanup_lexer:
+    lexer_close(lex);
+cleanup_error:
+    puts(err->message);
+    error_free(err);
+    return 1;
+}
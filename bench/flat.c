@@ -0,0 +1,186 @@
+#include "assembler.h"
+#include "ast.h"
+#include "diagnostics.h"
+#include "error.h"
+#include "flat.h"
+#include "lexer.h"
+#include "parser/parser.h"
+#include "tokenlist.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Measures how fast a large flat binary is written: a program that includes
+ * a large file and holds a long table of .dq values. The table is assembled
+ * and the image written to a file bench_rounds times, both are timed. */
+
+constexpr size_t bench_blob_size = 64 << 20;
+constexpr size_t bench_table_lines = 32768;
+constexpr size_t bench_line_values = 8;
+constexpr size_t bench_rounds = 5;
+
+static error_t *write_blob(char *path) {
+    int fd = mkstemp(path);
+    if (fd < 0)
+        return errorf("Could not create %s", path);
+    FILE *file = fdopen(fd, "w");
+    if (file == nullptr) {
+        close(fd);
+        return errorf("Could not open %s", path);
+    }
+    for (size_t i = 0; i < bench_blob_size; ++i)
+        fputc((int)(i * 7), file);
+    fclose(file);
+    return nullptr;
+}
+
+static error_t *write_program(char *path, const char *blob) {
+    int fd = mkstemp(path);
+    if (fd < 0)
+        return errorf("Could not create %s", path);
+    FILE *file = fdopen(fd, "w");
+    if (file == nullptr) {
+        close(fd);
+        return errorf("Could not open %s", path);
+    }
+    fprintf(file, "start:\n    jmp end\n    .incbin \"%s\"\ntable:\n", blob);
+    for (size_t i = 0; i < bench_table_lines; ++i) {
+        fprintf(file, "    .dq start");
+        for (size_t j = 1; j < bench_line_values; ++j)
+            fprintf(file, ", 0x%zx", (i * bench_line_values + j) * 0x9e3779b9);
+        fprintf(file, "\n");
+    }
+    fprintf(file, "end:\n    ret\n");
+    fclose(file);
+    return nullptr;
+}
+
+static double elapsed(struct timespec *start, struct timespec *end) {
+    return (double)(end->tv_sec - start->tv_sec) +
+           (double)(end->tv_nsec - start->tv_nsec) / 1e9;
+}
+
+// Assembles the program bench_rounds times, the last assembler is kept
+static error_t *assemble(ast_node_t *program, double *seconds,
+                         assembler_t **output) {
+    *output = nullptr;
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t round = 0; round < bench_rounds; ++round) {
+        assembler_free(*output);
+        error_t *err = assembler_alloc(output);
+        for (size_t i = 0; err == nullptr && i < program->len; ++i)
+            err = assembler_statement(*output, ast_node_child(program, i));
+        if (err == nullptr)
+            err = assembler_relax(*output);
+        if (err)
+            return err;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    *seconds = elapsed(&start, &end);
+    return nullptr;
+}
+
+// Writes the binary bench_rounds times
+static error_t *write_binary(assembler_t *assembler, const char *path,
+                             double *seconds) {
+    diagnostics_t *diagnostics;
+    error_t *err = diagnostics_alloc(&diagnostics, 0);
+    if (err)
+        return err;
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t round = 0; round < bench_rounds && err == nullptr; ++round)
+        err = flat_write(assembler, diagnostics, path);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    *seconds = elapsed(&start, &end);
+    if (err == nullptr && diagnostics->len)
+        err = errorf("%s", diagnostics->entries[0].message);
+    diagnostics_free(diagnostics);
+    return err;
+}
+
+int main() {
+    char blob[] = "/tmp/oas-bench-XXXXXX";
+    error_t *err = write_blob(blob);
+    if (err)
+        goto cleanup_error;
+    char path[] = "/tmp/oas-bench-XXXXXX";
+    err = write_program(path, blob);
+    if (err)
+        goto cleanup_blob;
+
+    lexer_t *lex = &(lexer_t){};
+    err = lexer_open(lex, path);
+    unlink(path);
+    if (err)
+        goto cleanup_blob;
+
+    tokenlist_t *list;
+    err = tokenlist_alloc(&list);
+    if (err)
+        goto cleanup_lexer;
+    err = tokenlist_fill(list, lex);
+    if (err)
+        goto cleanup_tokens;
+
+    parse_result_t result = parse(list->head);
+    if (result.err) {
+        err = result.err;
+        goto cleanup_tokens;
+    }
+    ast_node_t *program = result.node;
+
+    assembler_t *assembler;
+    double assemble_seconds, write_seconds;
+    err = assemble(program, &assemble_seconds, &assembler);
+    if (err)
+        goto cleanup_assembler;
+
+    char binary[] = "/tmp/oas-bench-XXXXXX";
+    int fd = mkstemp(binary);
+    if (fd < 0) {
+        err = errorf("Could not create %s", binary);
+        goto cleanup_assembler;
+    }
+    close(fd);
+    err = write_binary(assembler, binary, &write_seconds);
+    struct stat info;
+    if (err == nullptr && stat(binary, &info) != 0)
+        err = errorf("Could not stat %s", binary);
+    unlink(binary);
+    if (err)
+        goto cleanup_assembler;
+
+    size_t values = bench_table_lines * bench_line_values * bench_rounds;
+    printf("flat: %zu table values assembled in %.3fs, %.0f values/s\n",
+           values, assemble_seconds, (double)values / assemble_seconds);
+    printf("flat: %lld byte image written in %.3fs, %.0f MB/s\n",
+           (long long)info.st_size, write_seconds / bench_rounds,
+           (double)info.st_size * bench_rounds / write_seconds / 1e6);
+
+    assembler_free(assembler);
+    ast_node_free(program);
+    tokenlist_free(list);
+    lexer_close(lex);
+    unlink(blob);
+    return 0;
+
+cleanup_assembler:
+    assembler_free(assembler);
+    ast_node_free(program);
+cleanup_tokens:
+    tokenlist_free(list);
+cleanup_lexer:
+    lexer_close(lex);
+cleanup_blob:
+    unlink(blob);
+cleanup_error:
+    puts(err->message);
+    error_free(err);
+    return 1;
+}
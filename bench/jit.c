@@ -0,0 +1,85 @@
+#include "error.h"
+#include "jit.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* Measures how many snippets per second the jit assembles into executable
+ * memory, and checks that every one of them computes what it should. The
+ * snippets are small functions like a code generator emits, each with a
+ * constant of its own. */
+
+constexpr size_t bench_snippets = 20000;
+constexpr size_t bench_snippet_size = 256;
+
+typedef int (*bench_function_t)(int, int);
+
+// Returns a * b + constant, with a loop so that the snippet has a label and
+// a branch
+static const char bench_format[] = "    xor eax, eax\n"
+                                   "    test esi, esi\n"
+                                   "    je done\n"
+                                   "again:\n"
+                                   "    add eax, edi\n"
+                                   "    sub esi, 1\n"
+                                   "    jne again\n"
+                                   "done:\n"
+                                   "    add eax, %zu\n"
+                                   "    ret\n";
+
+static double elapsed(struct timespec *start, struct timespec *end) {
+    return (double)(end->tv_sec - start->tv_sec) +
+           (double)(end->tv_nsec - start->tv_nsec) / 1e9;
+}
+
+int main() {
+    char *sources = malloc(bench_snippets * bench_snippet_size);
+    jit_code_t *codes = calloc(bench_snippets, sizeof(jit_code_t));
+    jit_t *jit = nullptr;
+    error_t *err = sources && codes ? jit_alloc(&jit, false)
+                                    : err_allocation_failed;
+    if (err)
+        goto cleanup;
+    for (size_t i = 0; i < bench_snippets; ++i)
+        snprintf(sources + i * bench_snippet_size, bench_snippet_size,
+                 bench_format, i);
+
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t i = 0; i < bench_snippets && err == nullptr; ++i) {
+        const char *source = sources + i * bench_snippet_size;
+        err = jit_assemble(jit, source, strlen(source), "snippet", &codes[i]);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    if (err)
+        goto cleanup;
+
+    for (size_t i = 0; i < bench_snippets; ++i) {
+        bench_function_t function = (bench_function_t)codes[i].entry;
+        int result = function(6, 7);
+        if (result != 42 + (int)i) {
+            err = errorf("Snippet %zu returned %d instead of %zu", i, result,
+                         42 + i);
+            goto cleanup;
+        }
+    }
+
+    double seconds = elapsed(&start, &end);
+    printf("jit: %zu snippets in %.3fs, %.0f snippets/s, %.1fus each\n",
+           bench_snippets, seconds, (double)bench_snippets / seconds,
+           seconds * 1e6 / (double)bench_snippets);
+
+cleanup:
+    for (size_t i = 0; codes && i < bench_snippets; ++i)
+        jit_release(&codes[i]);
+    jit_free(jit);
+    free(codes);
+    free(sources);
+    if (err == nullptr)
+        return 0;
+    puts(err->message);
+    error_free(err);
+    return 1;
+}
@@ -0,0 +1,183 @@
+#include "assembler.h"
+#include "ast.h"
+#include "error.h"
+#include "lexer.h"
+#include "parser/parser.h"
+#include "pool.h"
+#include "tokenlist.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Measures how assembler_encode scales with the number of threads on a
+ * program of many small functions, and checks that every thread count
+ * produces the same encodings. The program is lexed and parsed once, only the
+ * encoding is timed. */
+
+constexpr size_t bench_functions = 4000;
+constexpr size_t bench_function_lines = 24;
+constexpr size_t bench_rounds = 10;
+constexpr size_t bench_max_threads = 16;
+
+static const char *bench_instructions[] = {
+    "mov eax, ebx",
+    "mov rax, [rbx + rcx * 8 + 16]",
+    "mov [rsp + 8], r12",
+    "add r10, 1000",
+    "lea rdi, [rsi + rdx * 2]",
+    "xor ecx, ecx",
+    "cmp [rbp - 8], r8",
+    "imul rdx, rsi, 12",
+    "movzx eax, cl",
+    "push rbp",
+    "shl r9d, 3",
+    "test al, al",
+    "cmovne rax, rdx",
+};
+
+constexpr size_t bench_instruction_count =
+    sizeof(bench_instructions) / sizeof(bench_instructions[0]);
+
+static error_t *write_program(char *path) {
+    int fd = mkstemp(path);
+    if (fd < 0)
+        return errorf("Could not create %s", path);
+    FILE *file = fdopen(fd, "w");
+    if (file == nullptr) {
+        close(fd);
+        return errorf("Could not open %s", path);
+    }
+    size_t line = 0;
+    for (size_t i = 0; i < bench_functions; ++i) {
+        fprintf(file, "function%zu:\n", i);
+        for (size_t j = 0; j < bench_function_lines; ++j)
+            fprintf(file, "    %s\n",
+                    bench_instructions[line++ % bench_instruction_count]);
+        fprintf(file, "    jne function%zu\n    ret\n", i);
+    }
+    fclose(file);
+    return nullptr;
+}
+
+static double elapsed(struct timespec *start, struct timespec *end) {
+    return (double)(end->tv_sec - start->tv_sec) +
+           (double)(end->tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static bool same_encodings(const encoded_t *first, const encoded_t *second,
+                           size_t len) {
+    for (size_t i = 0; i < len; ++i) {
+        const encoding_t *a = &first[i].encoding, *b = &second[i].encoding;
+        if (first[i].err != second[i].err || a->len != b->len ||
+            memcmp(a->bytes, b->bytes, a->len) != 0 || a->label != b->label)
+            return false;
+    }
+    return true;
+}
+
+// Encodes the program bench_rounds times, the last encodings are kept
+static error_t *encode(ast_node_t *program, size_t threads, double *seconds,
+                       encoded_t **output) {
+    pool_t *pool;
+    error_t *err = pool_alloc(&pool, threads);
+    if (err)
+        return err;
+    assembler_t *assembler;
+    err = assembler_alloc(&assembler);
+    if (err) {
+        pool_free(pool);
+        return err;
+    }
+
+    *output = nullptr;
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t round = 0; round < bench_rounds && err == nullptr; ++round) {
+        free(*output);
+        err = assembler_encode(assembler, pool, program, output);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    *seconds = elapsed(&start, &end);
+
+    assembler_free(assembler);
+    pool_free(pool);
+    return err;
+}
+
+int main() {
+    char path[] = "/tmp/oas-bench-XXXXXX";
+    error_t *err = write_program(path);
+    if (err)
+        goto cleanup_error;
+
+    lexer_t *lex = &(lexer_t){};
+    err = lexer_open(lex, path);
+    unlink(path);
+    if (err)
+        goto cleanup_error;
+
+    tokenlist_t *list;
+    err = tokenlist_alloc(&list);
+    if (err)
+        goto cleanup_lexer;
+    err = tokenlist_fill(list, lex);
+    if (err)
+        goto cleanup_tokens;
+
+    parse_result_t result = parse(list->head);
+    if (result.err) {
+        err = result.err;
+        goto cleanup_tokens;
+    }
+    ast_node_t *program = result.node;
+
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    printf("parallel: %zu statements, %ld online processors\n", program->len,
+           online);
+
+    encoded_t *serial = nullptr;
+    double serial_seconds = 0;
+    for (size_t threads = 1; threads <= bench_max_threads; threads *= 2) {
+        encoded_t *encoded;
+        double seconds;
+        err = encode(program, threads, &seconds, &encoded);
+        if (err)
+            goto cleanup_encoded;
+
+        if (serial == nullptr) {
+            serial = encoded;
+            serial_seconds = seconds;
+        } else {
+            bool same = same_encodings(serial, encoded, program->len);
+            free(encoded);
+            if (!same) {
+                err = errorf("Encodings with %zu threads differ", threads);
+                goto cleanup_encoded;
+            }
+        }
+        printf("parallel: %2zu threads, %.0f statements/s, %.2fx\n", threads,
+               (double)(program->len * bench_rounds) / seconds,
+               serial_seconds / seconds);
+    }
+
+    free(serial);
+    ast_node_free(program);
+    tokenlist_free(list);
+    lexer_close(lex);
+    return 0;
+
+cleanup_encoded:
+    free(serial);
+    ast_node_free(program);
+cleanup_tokens:
+    tokenlist_free(list);
+cleanup_lexer:
+    lexer_close(lex);
+cleanup_error:
+    puts(err->message);
+    error_free(err);
+    return 1;
+}
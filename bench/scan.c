@@ -0,0 +1,224 @@
+#include "ast.h"
+#include "error.h"
+#include "lexer.h"
+#include "parser/parser.h"
+#include "scan.h"
+#include "tokenlist.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Measures how much faster scanning a program for its labels and sections is
+ * than parsing it, and what parsing the operands of every instruction on
+ * demand costs on top of the scan. The lazily parsed operands have to be the
+ * trees the parser builds. The program is lexed once, only the parsing and
+ * the scanning are timed. */
+
+constexpr size_t bench_lines = 200000;
+constexpr size_t bench_label_lines = 8;
+constexpr size_t bench_section_lines = 10000;
+constexpr size_t bench_rounds = 10;
+
+static const char *bench_instructions[] = {
+    "mov eax, ebx",
+    "mov rax, [rbx + rcx * 8 + 16]",
+    "mov [rsp + 8], r12",
+    "add r10, 1000",
+    "lea rdi, [rsi + rdx * 2]",
+    "xor ecx, ecx",
+    "cmp [rbp - 8], r8",
+    "imul rdx, rsi, 12",
+    "push rbp",
+    "jne label_8",
+    "ret",
+};
+
+constexpr size_t bench_instruction_count =
+    sizeof(bench_instructions) / sizeof(bench_instructions[0]);
+
+static error_t *write_program(char *path) {
+    int fd = mkstemp(path);
+    if (fd < 0)
+        return errorf("Could not create %s", path);
+    FILE *file = fdopen(fd, "w");
+    if (file == nullptr) {
+        close(fd);
+        return errorf("Could not open %s", path);
+    }
+    for (size_t i = 0; i < bench_lines; ++i) {
+        if (i % bench_section_lines == 0)
+            fprintf(file, ".section text_%zu\n", i / bench_section_lines);
+        if (i % bench_label_lines == 0)
+            fprintf(file, "label_%zu:\n", i);
+        fprintf(file, "    %s\n",
+                bench_instructions[i % bench_instruction_count]);
+    }
+    fclose(file);
+    return nullptr;
+}
+
+static double elapsed(struct timespec *start, struct timespec *end) {
+    return (double)(end->tv_sec - start->tv_sec) +
+           (double)(end->tv_nsec - start->tv_nsec) / 1e9;
+}
+
+// Whether the trees have the same shape, tokens and numbers
+static bool same_tree(ast_node_t *a, ast_node_t *b) {
+    if (a->id != b->id || a->token_entry != b->token_entry || a->len != b->len)
+        return false;
+    if (a->id == NODE_NUMBER &&
+        a->value.integer.value != b->value.integer.value)
+        return false;
+    for (size_t i = 0; i < a->len; ++i)
+        if (!same_tree(ast_node_child(a, i), ast_node_child(b, i)))
+            return false;
+    return true;
+}
+
+// Parses the program bench_rounds times, the last program is kept
+static error_t *parse_rounds(tokenlist_t *list, double *seconds,
+                             ast_node_t **output) {
+    *output = nullptr;
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t round = 0; round < bench_rounds; ++round) {
+        ast_node_free(*output);
+        parse_result_t result = parse(list->head);
+        if (result.err)
+            return result.err;
+        *output = result.node;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    *seconds = elapsed(&start, &end);
+    return nullptr;
+}
+
+// Scans the program bench_rounds times, the last scan is kept
+static error_t *scan_rounds(tokenlist_t *list, double *seconds,
+                            scan_t **output) {
+    *output = nullptr;
+    struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (size_t round = 0; round < bench_rounds; ++round) {
+        scan_free(*output);
+        error_t *err = scan_alloc(output);
+        if (err == nullptr)
+            err = scan_fill(*output, list, nullptr);
+        if (err)
+            return err;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    *seconds = elapsed(&start, &end);
+    return nullptr;
+}
+
+/**
+ * Parses the operands of every scanned instruction and compares them with
+ * those of the instructions of the program, in order. Only the parsing is
+ * timed.
+ */
+static error_t *parse_operands(scan_t *scan, ast_node_t *program,
+                               double *seconds, size_t *instructions) {
+    *seconds = 0;
+    *instructions = 0;
+    size_t child = 0;
+    for (size_t i = 0; i < scan->len; ++i) {
+        scan_statement_t *statement = &scan->statements[i];
+        if (statement->id != SCAN_INSTRUCTION)
+            continue;
+
+        struct timespec start, end;
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        parse_result_t result = scan_parse_operands(statement);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        *seconds += elapsed(&start, &end);
+        if (result.err)
+            return result.err;
+
+        while (child < program->len &&
+               ast_node_child(program, child)->id != NODE_INSTRUCTION)
+            child += 1;
+        bool same = child < program->len &&
+                    same_tree(result.node, ast_node_child(
+                                               ast_node_child(program, child),
+                                               1));
+        ast_node_free(result.node);
+        if (!same)
+            return errorf("Operands of line %zu differ from the parser's",
+                          statement->token->token.line_number + 1);
+        child += 1;
+        *instructions += 1;
+    }
+    return nullptr;
+}
+
+int main() {
+    char path[] = "/tmp/oas-bench-XXXXXX";
+    error_t *err = write_program(path);
+    if (err)
+        goto cleanup_error;
+
+    lexer_t *lex = &(lexer_t){};
+    err = lexer_open(lex, path);
+    unlink(path);
+    if (err)
+        goto cleanup_error;
+
+    tokenlist_t *list;
+    err = tokenlist_alloc(&list);
+    if (err)
+        goto cleanup_lexer;
+    err = tokenlist_fill(list, lex);
+    if (err)
+        goto cleanup_tokens;
+
+    ast_node_t *program;
+    double parse_seconds;
+    err = parse_rounds(list, &parse_seconds, &program);
+    if (err)
+        goto cleanup_program;
+
+    scan_t *scan;
+    double scan_seconds;
+    err = scan_rounds(list, &scan_seconds, &scan);
+    if (err)
+        goto cleanup_scan;
+
+    double operands_seconds;
+    size_t instructions;
+    err = parse_operands(scan, program, &operands_seconds, &instructions);
+    if (err)
+        goto cleanup_scan;
+
+    size_t lines = list->tail->token.line_number + 1;
+    printf("scan: %zu lines parsed in %.3fs, %.0f lines/s\n", lines,
+           parse_seconds / bench_rounds,
+           (double)(lines * bench_rounds) / parse_seconds);
+    printf("scan: scanned in %.3fs, %.0f lines/s, %.2fx\n",
+           scan_seconds / bench_rounds,
+           (double)(lines * bench_rounds) / scan_seconds,
+           parse_seconds / scan_seconds);
+    printf("scan: operands of %zu instructions parsed on demand in %.3fs\n",
+           instructions, operands_seconds);
+
+    scan_free(scan);
+    ast_node_free(program);
+    tokenlist_free(list);
+    lexer_close(lex);
+    return 0;
+
+cleanup_scan:
+    scan_free(scan);
+cleanup_program:
+    ast_node_free(program);
+cleanup_tokens:
+    tokenlist_free(list);
+cleanup_lexer:
+    lexer_close(lex);
+cleanup_error:
+    puts(err->message);
+    error_free(err);
+    return 1;
+}
@@ -0,0 +1,5040 @@
+/* Generated by tools/encodergen.c from doc/instructions.txt, do not edit */
+#include "encoder/table.h"
+#include <string.h>
+
+static uint32_t table_hash(const char *key, uint32_t seed) {
+    uint32_t hash = 0x811c9dc5 ^ (seed * 0x9e3779b9);
+    for (; *key; ++key)
+        hash = (hash ^ (unsigned char)*key) * 0x01000193;
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+    return hash;
+}
+
+static const instruction_form_t forms[] = {
+    /* mov rm8, r8 : 88 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_R8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x88},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* mov rm16, r16 : o16 89 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_R16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x89},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* mov rm32, r32 : 89 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_R32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x89},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* mov rm64, r64 : rex.w 89 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_R64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x89},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* mov r8, rm8 : 8A /r */
+    {.operand_count = 2, .operands = {OPERAND_R8, OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x8a},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* mov r16, rm16 : o16 8B /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x8b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* mov r32, rm32 : 8B /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x8b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* mov r64, rm64 : rex.w 8B /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x8b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* mov r8, imm8 : B0+r ib */
+    {.operand_count = 2, .operands = {OPERAND_R8, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xb0},
+     .opcode_register = true, .modrm = modrm_none,
+     .reg_operand = 0, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* mov r16, imm16 : o16 B8+r iw */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xb8},
+     .opcode_register = true, .modrm = modrm_none,
+     .reg_operand = 0, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* mov r32, imm32 : B8+r id */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xb8},
+     .opcode_register = true, .modrm = modrm_none,
+     .reg_operand = 0, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* mov rm64, imm32 : rex.w C7 /0 id */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xc7},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* mov r64, imm64 : rex.w B8+r io */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_IMM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xb8},
+     .opcode_register = true, .modrm = modrm_none,
+     .reg_operand = 0, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 8, .operand_size = 64,
+     .immediate_signed = false, .relative = false},
+    /* movzx r16, rm8 : o16 0F B6 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM8},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0xb6},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* movzx r32, rm8 : 0F B6 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0xb6},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* movzx r64, rm8 : rex.w 0F B6 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0xb6},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* movzx r32, rm16 : 0F B7 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM16},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0xb7},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* movzx r64, rm16 : rex.w 0F B7 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM16},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0xb7},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* movsx r16, rm8 : o16 0F BE /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM8},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0xbe},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* movsx r32, rm8 : 0F BE /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0xbe},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* movsx r64, rm8 : rex.w 0F BE /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0xbe},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* movsx r32, rm16 : 0F BF /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM16},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0xbf},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* movsx r64, rm16 : rex.w 0F BF /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM16},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0xbf},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* movsxd r64, rm32 : rex.w 63 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x63},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* lea r16, m : o16 8D /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_M},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x8d},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* lea r32, m : 8D /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x8d},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* lea r64, m : rex.w 8D /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_M},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x8d},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xchg ax, r16 : o16 90+r */
+    {.operand_count = 2, .operands = {OPERAND_AX, OPERAND_R16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x90},
+     .opcode_register = true, .modrm = modrm_none,
+     .reg_operand = 1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xchg r16, ax : o16 90+r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_AX},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x90},
+     .opcode_register = true, .modrm = modrm_none,
+     .reg_operand = 0, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xchg eax, r32 : 90+r */
+    {.operand_count = 2, .operands = {OPERAND_EAX, OPERAND_R32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x90},
+     .opcode_register = true, .modrm = modrm_none,
+     .reg_operand = 1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xchg r32, eax : 90+r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_EAX},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x90},
+     .opcode_register = true, .modrm = modrm_none,
+     .reg_operand = 0, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xchg rax, r64 : rex.w 90+r */
+    {.operand_count = 2, .operands = {OPERAND_RAX, OPERAND_R64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x90},
+     .opcode_register = true, .modrm = modrm_none,
+     .reg_operand = 1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xchg r64, rax : rex.w 90+r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RAX},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x90},
+     .opcode_register = true, .modrm = modrm_none,
+     .reg_operand = 0, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xchg rm8, r8 : 86 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_R8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x86},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xchg rm16, r16 : o16 87 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_R16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x87},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xchg rm32, r32 : 87 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_R32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x87},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xchg rm64, r64 : rex.w 87 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_R64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x87},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xchg r8, rm8 : 86 /r */
+    {.operand_count = 2, .operands = {OPERAND_R8, OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x86},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xchg r16, rm16 : o16 87 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x87},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xchg r32, rm32 : 87 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x87},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xchg r64, rm64 : rex.w 87 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x87},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* push r64 : 50+r */
+    {.operand_count = 1, .operands = {OPERAND_R64},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x50},
+     .opcode_register = true, .modrm = modrm_none,
+     .reg_operand = 0, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* push r16 : o16 50+r */
+    {.operand_count = 1, .operands = {OPERAND_R16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x50},
+     .opcode_register = true, .modrm = modrm_none,
+     .reg_operand = 0, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* push m : FF /6 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xff},
+     .opcode_register = false, .modrm = 6,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* push imm8 : 6A ib d64 */
+    {.operand_count = 1, .operands = {OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x6a},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* push imm32 : 68 id d64 */
+    {.operand_count = 1, .operands = {OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x68},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* push imm16 : o16 68 iw */
+    {.operand_count = 1, .operands = {OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x68},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* pop r64 : 58+r */
+    {.operand_count = 1, .operands = {OPERAND_R64},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x58},
+     .opcode_register = true, .modrm = modrm_none,
+     .reg_operand = 0, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* pop r16 : o16 58+r */
+    {.operand_count = 1, .operands = {OPERAND_R16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x58},
+     .opcode_register = true, .modrm = modrm_none,
+     .reg_operand = 0, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* pop m : 8F /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x8f},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* add rm8, r8 : 00 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_R8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x00},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* add rm16, r16 : o16 01 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_R16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x01},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* add rm32, r32 : 01 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_R32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x01},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* add rm64, r64 : rex.w 01 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_R64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x01},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* add r8, rm8 : 02 /r */
+    {.operand_count = 2, .operands = {OPERAND_R8, OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x02},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* add r16, rm16 : o16 03 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x03},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* add r32, rm32 : 03 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x03},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* add r64, rm64 : rex.w 03 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x03},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* add al, imm8 : 04 ib */
+    {.operand_count = 2, .operands = {OPERAND_AL, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x04},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* add rm8, imm8 : 80 /0 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x80},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* add rm16, imm8 : o16 83 /0 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM8},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 16,
+     .immediate_signed = true, .relative = false},
+    /* add rm32, imm8 : 83 /0 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 32,
+     .immediate_signed = true, .relative = false},
+    /* add rm64, imm8 : rex.w 83 /0 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* add ax, imm16 : o16 05 iw */
+    {.operand_count = 2, .operands = {OPERAND_AX, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x05},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* add eax, imm32 : 05 id */
+    {.operand_count = 2, .operands = {OPERAND_EAX, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x05},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* add rax, imm32 : rex.w 05 id */
+    {.operand_count = 2, .operands = {OPERAND_RAX, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x05},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* add rm16, imm16 : o16 81 /0 iw */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* add rm32, imm32 : 81 /0 id */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* add rm64, imm32 : rex.w 81 /0 id */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* or rm8, r8 : 08 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_R8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x08},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* or rm16, r16 : o16 09 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_R16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x09},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* or rm32, r32 : 09 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_R32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x09},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* or rm64, r64 : rex.w 09 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_R64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x09},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* or r8, rm8 : 0A /r */
+    {.operand_count = 2, .operands = {OPERAND_R8, OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x0a},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* or r16, rm16 : o16 0B /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x0b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* or r32, rm32 : 0B /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x0b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* or r64, rm64 : rex.w 0B /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x0b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* or al, imm8 : 0C ib */
+    {.operand_count = 2, .operands = {OPERAND_AL, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x0c},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* or rm8, imm8 : 80 /1 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x80},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* or rm16, imm8 : o16 83 /1 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM8},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 16,
+     .immediate_signed = true, .relative = false},
+    /* or rm32, imm8 : 83 /1 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 32,
+     .immediate_signed = true, .relative = false},
+    /* or rm64, imm8 : rex.w 83 /1 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* or ax, imm16 : o16 0D iw */
+    {.operand_count = 2, .operands = {OPERAND_AX, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x0d},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* or eax, imm32 : 0D id */
+    {.operand_count = 2, .operands = {OPERAND_EAX, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x0d},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* or rax, imm32 : rex.w 0D id */
+    {.operand_count = 2, .operands = {OPERAND_RAX, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x0d},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* or rm16, imm16 : o16 81 /1 iw */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* or rm32, imm32 : 81 /1 id */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* or rm64, imm32 : rex.w 81 /1 id */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* adc rm8, r8 : 10 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_R8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x10},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* adc rm16, r16 : o16 11 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_R16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x11},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* adc rm32, r32 : 11 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_R32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x11},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* adc rm64, r64 : rex.w 11 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_R64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x11},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* adc r8, rm8 : 12 /r */
+    {.operand_count = 2, .operands = {OPERAND_R8, OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x12},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* adc r16, rm16 : o16 13 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x13},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* adc r32, rm32 : 13 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x13},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* adc r64, rm64 : rex.w 13 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x13},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* adc al, imm8 : 14 ib */
+    {.operand_count = 2, .operands = {OPERAND_AL, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x14},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* adc rm8, imm8 : 80 /2 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x80},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* adc rm16, imm8 : o16 83 /2 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM8},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 16,
+     .immediate_signed = true, .relative = false},
+    /* adc rm32, imm8 : 83 /2 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 32,
+     .immediate_signed = true, .relative = false},
+    /* adc rm64, imm8 : rex.w 83 /2 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* adc ax, imm16 : o16 15 iw */
+    {.operand_count = 2, .operands = {OPERAND_AX, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x15},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* adc eax, imm32 : 15 id */
+    {.operand_count = 2, .operands = {OPERAND_EAX, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x15},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* adc rax, imm32 : rex.w 15 id */
+    {.operand_count = 2, .operands = {OPERAND_RAX, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x15},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* adc rm16, imm16 : o16 81 /2 iw */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* adc rm32, imm32 : 81 /2 id */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* adc rm64, imm32 : rex.w 81 /2 id */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* sbb rm8, r8 : 18 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_R8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x18},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sbb rm16, r16 : o16 19 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_R16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x19},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sbb rm32, r32 : 19 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_R32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x19},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sbb rm64, r64 : rex.w 19 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_R64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x19},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sbb r8, rm8 : 1A /r */
+    {.operand_count = 2, .operands = {OPERAND_R8, OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x1a},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sbb r16, rm16 : o16 1B /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x1b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sbb r32, rm32 : 1B /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x1b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sbb r64, rm64 : rex.w 1B /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x1b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sbb al, imm8 : 1C ib */
+    {.operand_count = 2, .operands = {OPERAND_AL, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x1c},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* sbb rm8, imm8 : 80 /3 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x80},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* sbb rm16, imm8 : o16 83 /3 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM8},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 16,
+     .immediate_signed = true, .relative = false},
+    /* sbb rm32, imm8 : 83 /3 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 32,
+     .immediate_signed = true, .relative = false},
+    /* sbb rm64, imm8 : rex.w 83 /3 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* sbb ax, imm16 : o16 1D iw */
+    {.operand_count = 2, .operands = {OPERAND_AX, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x1d},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* sbb eax, imm32 : 1D id */
+    {.operand_count = 2, .operands = {OPERAND_EAX, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x1d},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* sbb rax, imm32 : rex.w 1D id */
+    {.operand_count = 2, .operands = {OPERAND_RAX, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x1d},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* sbb rm16, imm16 : o16 81 /3 iw */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* sbb rm32, imm32 : 81 /3 id */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* sbb rm64, imm32 : rex.w 81 /3 id */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* and rm8, r8 : 20 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_R8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x20},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* and rm16, r16 : o16 21 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_R16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x21},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* and rm32, r32 : 21 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_R32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x21},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* and rm64, r64 : rex.w 21 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_R64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x21},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* and r8, rm8 : 22 /r */
+    {.operand_count = 2, .operands = {OPERAND_R8, OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x22},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* and r16, rm16 : o16 23 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x23},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* and r32, rm32 : 23 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x23},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* and r64, rm64 : rex.w 23 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x23},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* and al, imm8 : 24 ib */
+    {.operand_count = 2, .operands = {OPERAND_AL, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x24},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* and rm8, imm8 : 80 /4 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x80},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* and rm16, imm8 : o16 83 /4 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM8},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 16,
+     .immediate_signed = true, .relative = false},
+    /* and rm32, imm8 : 83 /4 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 32,
+     .immediate_signed = true, .relative = false},
+    /* and rm64, imm8 : rex.w 83 /4 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* and ax, imm16 : o16 25 iw */
+    {.operand_count = 2, .operands = {OPERAND_AX, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x25},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* and eax, imm32 : 25 id */
+    {.operand_count = 2, .operands = {OPERAND_EAX, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x25},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* and rax, imm32 : rex.w 25 id */
+    {.operand_count = 2, .operands = {OPERAND_RAX, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x25},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* and rm16, imm16 : o16 81 /4 iw */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* and rm32, imm32 : 81 /4 id */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* and rm64, imm32 : rex.w 81 /4 id */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* sub rm8, r8 : 28 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_R8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x28},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sub rm16, r16 : o16 29 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_R16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x29},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sub rm32, r32 : 29 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_R32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x29},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sub rm64, r64 : rex.w 29 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_R64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x29},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sub r8, rm8 : 2A /r */
+    {.operand_count = 2, .operands = {OPERAND_R8, OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x2a},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sub r16, rm16 : o16 2B /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x2b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sub r32, rm32 : 2B /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x2b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sub r64, rm64 : rex.w 2B /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x2b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sub al, imm8 : 2C ib */
+    {.operand_count = 2, .operands = {OPERAND_AL, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x2c},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* sub rm8, imm8 : 80 /5 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x80},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* sub rm16, imm8 : o16 83 /5 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM8},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 16,
+     .immediate_signed = true, .relative = false},
+    /* sub rm32, imm8 : 83 /5 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 32,
+     .immediate_signed = true, .relative = false},
+    /* sub rm64, imm8 : rex.w 83 /5 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* sub ax, imm16 : o16 2D iw */
+    {.operand_count = 2, .operands = {OPERAND_AX, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x2d},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* sub eax, imm32 : 2D id */
+    {.operand_count = 2, .operands = {OPERAND_EAX, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x2d},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* sub rax, imm32 : rex.w 2D id */
+    {.operand_count = 2, .operands = {OPERAND_RAX, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x2d},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* sub rm16, imm16 : o16 81 /5 iw */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* sub rm32, imm32 : 81 /5 id */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* sub rm64, imm32 : rex.w 81 /5 id */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* xor rm8, r8 : 30 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_R8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x30},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xor rm16, r16 : o16 31 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_R16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x31},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xor rm32, r32 : 31 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_R32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x31},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xor rm64, r64 : rex.w 31 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_R64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x31},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xor r8, rm8 : 32 /r */
+    {.operand_count = 2, .operands = {OPERAND_R8, OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x32},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xor r16, rm16 : o16 33 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x33},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xor r32, rm32 : 33 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x33},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xor r64, rm64 : rex.w 33 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x33},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* xor al, imm8 : 34 ib */
+    {.operand_count = 2, .operands = {OPERAND_AL, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x34},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* xor rm8, imm8 : 80 /6 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x80},
+     .opcode_register = false, .modrm = 6,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* xor rm16, imm8 : o16 83 /6 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM8},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 6,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 16,
+     .immediate_signed = true, .relative = false},
+    /* xor rm32, imm8 : 83 /6 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 6,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 32,
+     .immediate_signed = true, .relative = false},
+    /* xor rm64, imm8 : rex.w 83 /6 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 6,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* xor ax, imm16 : o16 35 iw */
+    {.operand_count = 2, .operands = {OPERAND_AX, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x35},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* xor eax, imm32 : 35 id */
+    {.operand_count = 2, .operands = {OPERAND_EAX, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x35},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* xor rax, imm32 : rex.w 35 id */
+    {.operand_count = 2, .operands = {OPERAND_RAX, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x35},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* xor rm16, imm16 : o16 81 /6 iw */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 6,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* xor rm32, imm32 : 81 /6 id */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 6,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* xor rm64, imm32 : rex.w 81 /6 id */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 6,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* cmp rm8, r8 : 38 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_R8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x38},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmp rm16, r16 : o16 39 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_R16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x39},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmp rm32, r32 : 39 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_R32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x39},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmp rm64, r64 : rex.w 39 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_R64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x39},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmp r8, rm8 : 3A /r */
+    {.operand_count = 2, .operands = {OPERAND_R8, OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x3a},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmp r16, rm16 : o16 3B /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x3b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmp r32, rm32 : 3B /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x3b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmp r64, rm64 : rex.w 3B /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x3b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmp al, imm8 : 3C ib */
+    {.operand_count = 2, .operands = {OPERAND_AL, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x3c},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* cmp rm8, imm8 : 80 /7 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x80},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* cmp rm16, imm8 : o16 83 /7 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM8},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 16,
+     .immediate_signed = true, .relative = false},
+    /* cmp rm32, imm8 : 83 /7 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 32,
+     .immediate_signed = true, .relative = false},
+    /* cmp rm64, imm8 : rex.w 83 /7 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x83},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* cmp ax, imm16 : o16 3D iw */
+    {.operand_count = 2, .operands = {OPERAND_AX, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x3d},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* cmp eax, imm32 : 3D id */
+    {.operand_count = 2, .operands = {OPERAND_EAX, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x3d},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* cmp rax, imm32 : rex.w 3D id */
+    {.operand_count = 2, .operands = {OPERAND_RAX, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x3d},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* cmp rm16, imm16 : o16 81 /7 iw */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* cmp rm32, imm32 : 81 /7 id */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* cmp rm64, imm32 : rex.w 81 /7 id */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x81},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* test rm8, r8 : 84 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_R8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x84},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* test rm16, r16 : o16 85 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_R16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x85},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* test rm32, r32 : 85 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_R32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x85},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* test rm64, r64 : rex.w 85 /r */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_R64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x85},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* test al, imm8 : A8 ib */
+    {.operand_count = 2, .operands = {OPERAND_AL, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xa8},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* test ax, imm16 : o16 A9 iw */
+    {.operand_count = 2, .operands = {OPERAND_AX, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xa9},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* test eax, imm32 : A9 id */
+    {.operand_count = 2, .operands = {OPERAND_EAX, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xa9},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* test rax, imm32 : rex.w A9 id */
+    {.operand_count = 2, .operands = {OPERAND_RAX, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xa9},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* test rm8, imm8 : F6 /0 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf6},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* test rm16, imm16 : o16 F7 /0 iw */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* test rm32, imm32 : F7 /0 id */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* test rm64, imm32 : rex.w F7 /0 id */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* not rm8 : F6 /2 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf6},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* not rm16 : o16 F7 /2 */
+    {.operand_count = 1, .operands = {OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* not rm32 : F7 /2 */
+    {.operand_count = 1, .operands = {OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* not rm64 : rex.w F7 /2 */
+    {.operand_count = 1, .operands = {OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* neg rm8 : F6 /3 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf6},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* neg rm16 : o16 F7 /3 */
+    {.operand_count = 1, .operands = {OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* neg rm32 : F7 /3 */
+    {.operand_count = 1, .operands = {OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* neg rm64 : rex.w F7 /3 */
+    {.operand_count = 1, .operands = {OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* mul rm8 : F6 /4 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf6},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* mul rm16 : o16 F7 /4 */
+    {.operand_count = 1, .operands = {OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* mul rm32 : F7 /4 */
+    {.operand_count = 1, .operands = {OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* mul rm64 : rex.w F7 /4 */
+    {.operand_count = 1, .operands = {OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* imul rm8 : F6 /5 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf6},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* imul rm16 : o16 F7 /5 */
+    {.operand_count = 1, .operands = {OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* imul rm32 : F7 /5 */
+    {.operand_count = 1, .operands = {OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* imul rm64 : rex.w F7 /5 */
+    {.operand_count = 1, .operands = {OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* imul r16, rm16 : o16 0F AF /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0xaf},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* imul r32, rm32 : 0F AF /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0xaf},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* imul r64, rm64 : rex.w 0F AF /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0xaf},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* imul r16, rm16, imm8 : o16 6B /r ib */
+    {.operand_count = 3, .operands = {OPERAND_R16, OPERAND_RM16, OPERAND_IMM8},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x6b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = 2,
+     .immediate_size = 1, .operand_size = 16,
+     .immediate_signed = true, .relative = false},
+    /* imul r32, rm32, imm8 : 6B /r ib */
+    {.operand_count = 3, .operands = {OPERAND_R32, OPERAND_RM32, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x6b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = 2,
+     .immediate_size = 1, .operand_size = 32,
+     .immediate_signed = true, .relative = false},
+    /* imul r64, rm64, imm8 : rex.w 6B /r ib */
+    {.operand_count = 3, .operands = {OPERAND_R64, OPERAND_RM64, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x6b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = 2,
+     .immediate_size = 1, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* imul r16, rm16, imm16 : o16 69 /r iw */
+    {.operand_count = 3, .operands = {OPERAND_R16, OPERAND_RM16, OPERAND_IMM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x69},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = 2,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* imul r32, rm32, imm32 : 69 /r id */
+    {.operand_count = 3, .operands = {OPERAND_R32, OPERAND_RM32, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x69},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = 2,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = false},
+    /* imul r64, rm64, imm32 : rex.w 69 /r id */
+    {.operand_count = 3, .operands = {OPERAND_R64, OPERAND_RM64, OPERAND_IMM32},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x69},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = 2,
+     .immediate_size = 4, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* div rm8 : F6 /6 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf6},
+     .opcode_register = false, .modrm = 6,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* div rm16 : o16 F7 /6 */
+    {.operand_count = 1, .operands = {OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 6,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* div rm32 : F7 /6 */
+    {.operand_count = 1, .operands = {OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 6,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* div rm64 : rex.w F7 /6 */
+    {.operand_count = 1, .operands = {OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 6,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* idiv rm8 : F6 /7 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf6},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* idiv rm16 : o16 F7 /7 */
+    {.operand_count = 1, .operands = {OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* idiv rm32 : F7 /7 */
+    {.operand_count = 1, .operands = {OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* idiv rm64 : rex.w F7 /7 */
+    {.operand_count = 1, .operands = {OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xf7},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* inc rm8 : FE /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xfe},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* inc rm16 : o16 FF /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xff},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* inc rm32 : FF /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xff},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* inc rm64 : rex.w FF /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xff},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* dec rm8 : FE /1 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xfe},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* dec rm16 : o16 FF /1 */
+    {.operand_count = 1, .operands = {OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xff},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* dec rm32 : FF /1 */
+    {.operand_count = 1, .operands = {OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xff},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* dec rm64 : rex.w FF /1 */
+    {.operand_count = 1, .operands = {OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xff},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rol rm8, 1 : D0 /0 */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd0},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rol rm16, 1 : o16 D1 /0 */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_ONE},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rol rm32, 1 : D1 /0 */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rol rm64, 1 : rex.w D1 /0 */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rol rm8, imm8 : C0 /0 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc0},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* rol rm16, imm8 : o16 C1 /0 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM8},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 16,
+     .immediate_signed = true, .relative = false},
+    /* rol rm32, imm8 : C1 /0 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 32,
+     .immediate_signed = true, .relative = false},
+    /* rol rm64, imm8 : rex.w C1 /0 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* rol rm8, cl : D2 /0 */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd2},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rol rm16, cl : o16 D3 /0 */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_CL},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rol rm32, cl : D3 /0 */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rol rm64, cl : rex.w D3 /0 */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* ror rm8, 1 : D0 /1 */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd0},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* ror rm16, 1 : o16 D1 /1 */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_ONE},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* ror rm32, 1 : D1 /1 */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* ror rm64, 1 : rex.w D1 /1 */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* ror rm8, imm8 : C0 /1 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc0},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* ror rm16, imm8 : o16 C1 /1 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM8},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 16,
+     .immediate_signed = true, .relative = false},
+    /* ror rm32, imm8 : C1 /1 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 32,
+     .immediate_signed = true, .relative = false},
+    /* ror rm64, imm8 : rex.w C1 /1 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* ror rm8, cl : D2 /1 */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd2},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* ror rm16, cl : o16 D3 /1 */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_CL},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* ror rm32, cl : D3 /1 */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* ror rm64, cl : rex.w D3 /1 */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 1,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rcl rm8, 1 : D0 /2 */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd0},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rcl rm16, 1 : o16 D1 /2 */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_ONE},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rcl rm32, 1 : D1 /2 */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rcl rm64, 1 : rex.w D1 /2 */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rcl rm8, imm8 : C0 /2 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc0},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* rcl rm16, imm8 : o16 C1 /2 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM8},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 16,
+     .immediate_signed = true, .relative = false},
+    /* rcl rm32, imm8 : C1 /2 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 32,
+     .immediate_signed = true, .relative = false},
+    /* rcl rm64, imm8 : rex.w C1 /2 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* rcl rm8, cl : D2 /2 */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd2},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rcl rm16, cl : o16 D3 /2 */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_CL},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rcl rm32, cl : D3 /2 */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rcl rm64, cl : rex.w D3 /2 */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rcr rm8, 1 : D0 /3 */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd0},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rcr rm16, 1 : o16 D1 /3 */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_ONE},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rcr rm32, 1 : D1 /3 */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rcr rm64, 1 : rex.w D1 /3 */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rcr rm8, imm8 : C0 /3 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc0},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* rcr rm16, imm8 : o16 C1 /3 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM8},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 16,
+     .immediate_signed = true, .relative = false},
+    /* rcr rm32, imm8 : C1 /3 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 32,
+     .immediate_signed = true, .relative = false},
+    /* rcr rm64, imm8 : rex.w C1 /3 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* rcr rm8, cl : D2 /3 */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd2},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rcr rm16, cl : o16 D3 /3 */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_CL},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rcr rm32, cl : D3 /3 */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rcr rm64, cl : rex.w D3 /3 */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 3,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* shl rm8, 1 : D0 /4 */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd0},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* shl rm16, 1 : o16 D1 /4 */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_ONE},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* shl rm32, 1 : D1 /4 */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* shl rm64, 1 : rex.w D1 /4 */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* shl rm8, imm8 : C0 /4 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc0},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* shl rm16, imm8 : o16 C1 /4 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM8},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 16,
+     .immediate_signed = true, .relative = false},
+    /* shl rm32, imm8 : C1 /4 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 32,
+     .immediate_signed = true, .relative = false},
+    /* shl rm64, imm8 : rex.w C1 /4 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* shl rm8, cl : D2 /4 */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd2},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* shl rm16, cl : o16 D3 /4 */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_CL},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* shl rm32, cl : D3 /4 */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* shl rm64, cl : rex.w D3 /4 */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sal rm8, 1 : D0 /4 */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd0},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sal rm16, 1 : o16 D1 /4 */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_ONE},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sal rm32, 1 : D1 /4 */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sal rm64, 1 : rex.w D1 /4 */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sal rm8, imm8 : C0 /4 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc0},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* sal rm16, imm8 : o16 C1 /4 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM8},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 16,
+     .immediate_signed = true, .relative = false},
+    /* sal rm32, imm8 : C1 /4 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 32,
+     .immediate_signed = true, .relative = false},
+    /* sal rm64, imm8 : rex.w C1 /4 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* sal rm8, cl : D2 /4 */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd2},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sal rm16, cl : o16 D3 /4 */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_CL},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sal rm32, cl : D3 /4 */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sal rm64, cl : rex.w D3 /4 */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* shr rm8, 1 : D0 /5 */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd0},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* shr rm16, 1 : o16 D1 /5 */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_ONE},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* shr rm32, 1 : D1 /5 */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* shr rm64, 1 : rex.w D1 /5 */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* shr rm8, imm8 : C0 /5 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc0},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* shr rm16, imm8 : o16 C1 /5 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM8},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 16,
+     .immediate_signed = true, .relative = false},
+    /* shr rm32, imm8 : C1 /5 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 32,
+     .immediate_signed = true, .relative = false},
+    /* shr rm64, imm8 : rex.w C1 /5 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* shr rm8, cl : D2 /5 */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd2},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* shr rm16, cl : o16 D3 /5 */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_CL},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* shr rm32, cl : D3 /5 */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* shr rm64, cl : rex.w D3 /5 */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 5,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sar rm8, 1 : D0 /7 */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd0},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sar rm16, 1 : o16 D1 /7 */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_ONE},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sar rm32, 1 : D1 /7 */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sar rm64, 1 : rex.w D1 /7 */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_ONE},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xd1},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sar rm8, imm8 : C0 /7 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc0},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+    /* sar rm16, imm8 : o16 C1 /7 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_IMM8},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 16,
+     .immediate_signed = true, .relative = false},
+    /* sar rm32, imm8 : C1 /7 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 32,
+     .immediate_signed = true, .relative = false},
+    /* sar rm64, imm8 : rex.w C1 /7 ib */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xc1},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = 1,
+     .immediate_size = 1, .operand_size = 64,
+     .immediate_signed = true, .relative = false},
+    /* sar rm8, cl : D2 /7 */
+    {.operand_count = 2, .operands = {OPERAND_RM8, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd2},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sar rm16, cl : o16 D3 /7 */
+    {.operand_count = 2, .operands = {OPERAND_RM16, OPERAND_CL},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sar rm32, cl : D3 /7 */
+    {.operand_count = 2, .operands = {OPERAND_RM32, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sar rm64, cl : rex.w D3 /7 */
+    {.operand_count = 2, .operands = {OPERAND_RM64, OPERAND_CL},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0xd3},
+     .opcode_register = false, .modrm = 7,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* bswap r32 : 0F C8+r */
+    {.operand_count = 1, .operands = {OPERAND_R32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0xc8},
+     .opcode_register = true, .modrm = modrm_none,
+     .reg_operand = 0, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* bswap r64 : rex.w 0F C8+r */
+    {.operand_count = 1, .operands = {OPERAND_R64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0xc8},
+     .opcode_register = true, .modrm = modrm_none,
+     .reg_operand = 0, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovo r16, rm16 : o16 0F 40 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x40},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovo r32, rm32 : 0F 40 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x40},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovo r64, rm64 : rex.w 0F 40 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x40},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovno r16, rm16 : o16 0F 41 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x41},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovno r32, rm32 : 0F 41 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x41},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovno r64, rm64 : rex.w 0F 41 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x41},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovb r16, rm16 : o16 0F 42 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x42},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovb r32, rm32 : 0F 42 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x42},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovb r64, rm64 : rex.w 0F 42 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x42},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovc r16, rm16 : o16 0F 42 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x42},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovc r32, rm32 : 0F 42 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x42},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovc r64, rm64 : rex.w 0F 42 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x42},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnae r16, rm16 : o16 0F 42 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x42},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnae r32, rm32 : 0F 42 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x42},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnae r64, rm64 : rex.w 0F 42 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x42},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovae r16, rm16 : o16 0F 43 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x43},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovae r32, rm32 : 0F 43 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x43},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovae r64, rm64 : rex.w 0F 43 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x43},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnb r16, rm16 : o16 0F 43 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x43},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnb r32, rm32 : 0F 43 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x43},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnb r64, rm64 : rex.w 0F 43 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x43},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnc r16, rm16 : o16 0F 43 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x43},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnc r32, rm32 : 0F 43 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x43},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnc r64, rm64 : rex.w 0F 43 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x43},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmove r16, rm16 : o16 0F 44 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x44},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmove r32, rm32 : 0F 44 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x44},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmove r64, rm64 : rex.w 0F 44 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x44},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovz r16, rm16 : o16 0F 44 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x44},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovz r32, rm32 : 0F 44 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x44},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovz r64, rm64 : rex.w 0F 44 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x44},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovne r16, rm16 : o16 0F 45 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x45},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovne r32, rm32 : 0F 45 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x45},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovne r64, rm64 : rex.w 0F 45 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x45},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnz r16, rm16 : o16 0F 45 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x45},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnz r32, rm32 : 0F 45 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x45},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnz r64, rm64 : rex.w 0F 45 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x45},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovbe r16, rm16 : o16 0F 46 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x46},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovbe r32, rm32 : 0F 46 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x46},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovbe r64, rm64 : rex.w 0F 46 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x46},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovna r16, rm16 : o16 0F 46 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x46},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovna r32, rm32 : 0F 46 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x46},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovna r64, rm64 : rex.w 0F 46 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x46},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmova r16, rm16 : o16 0F 47 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x47},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmova r32, rm32 : 0F 47 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x47},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmova r64, rm64 : rex.w 0F 47 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x47},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnbe r16, rm16 : o16 0F 47 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x47},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnbe r32, rm32 : 0F 47 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x47},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnbe r64, rm64 : rex.w 0F 47 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x47},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovs r16, rm16 : o16 0F 48 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x48},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovs r32, rm32 : 0F 48 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x48},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovs r64, rm64 : rex.w 0F 48 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x48},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovns r16, rm16 : o16 0F 49 /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x49},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovns r32, rm32 : 0F 49 /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x49},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovns r64, rm64 : rex.w 0F 49 /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x49},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovp r16, rm16 : o16 0F 4A /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4a},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovp r32, rm32 : 0F 4A /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4a},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovp r64, rm64 : rex.w 0F 4A /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x4a},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovpe r16, rm16 : o16 0F 4A /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4a},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovpe r32, rm32 : 0F 4A /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4a},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovpe r64, rm64 : rex.w 0F 4A /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x4a},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnp r16, rm16 : o16 0F 4B /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnp r32, rm32 : 0F 4B /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnp r64, rm64 : rex.w 0F 4B /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x4b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovpo r16, rm16 : o16 0F 4B /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovpo r32, rm32 : 0F 4B /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovpo r64, rm64 : rex.w 0F 4B /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x4b},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovl r16, rm16 : o16 0F 4C /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4c},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovl r32, rm32 : 0F 4C /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4c},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovl r64, rm64 : rex.w 0F 4C /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x4c},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnge r16, rm16 : o16 0F 4C /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4c},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnge r32, rm32 : 0F 4C /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4c},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnge r64, rm64 : rex.w 0F 4C /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x4c},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovge r16, rm16 : o16 0F 4D /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4d},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovge r32, rm32 : 0F 4D /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4d},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovge r64, rm64 : rex.w 0F 4D /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x4d},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnl r16, rm16 : o16 0F 4D /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4d},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnl r32, rm32 : 0F 4D /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4d},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnl r64, rm64 : rex.w 0F 4D /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x4d},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovle r16, rm16 : o16 0F 4E /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4e},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovle r32, rm32 : 0F 4E /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4e},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovle r64, rm64 : rex.w 0F 4E /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x4e},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovng r16, rm16 : o16 0F 4E /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4e},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovng r32, rm32 : 0F 4E /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4e},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovng r64, rm64 : rex.w 0F 4E /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x4e},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovg r16, rm16 : o16 0F 4F /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4f},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovg r32, rm32 : 0F 4F /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4f},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovg r64, rm64 : rex.w 0F 4F /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x4f},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnle r16, rm16 : o16 0F 4F /r */
+    {.operand_count = 2, .operands = {OPERAND_R16, OPERAND_RM16},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4f},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnle r32, rm32 : 0F 4F /r */
+    {.operand_count = 2, .operands = {OPERAND_R32, OPERAND_RM32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x4f},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmovnle r64, rm64 : rex.w 0F 4F /r */
+    {.operand_count = 2, .operands = {OPERAND_R64, OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 2, .opcode = {0x0f, 0x4f},
+     .opcode_register = false, .modrm = modrm_register,
+     .reg_operand = 0, .rm_operand = 1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* seto rm8 : 0F 90 /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x90},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* seto m : 0F 90 /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x90},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setno rm8 : 0F 91 /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x91},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setno m : 0F 91 /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x91},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setb rm8 : 0F 92 /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x92},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setb m : 0F 92 /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x92},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setc rm8 : 0F 92 /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x92},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setc m : 0F 92 /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x92},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setnae rm8 : 0F 92 /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x92},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setnae m : 0F 92 /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x92},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setae rm8 : 0F 93 /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x93},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setae m : 0F 93 /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x93},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setnb rm8 : 0F 93 /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x93},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setnb m : 0F 93 /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x93},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setnc rm8 : 0F 93 /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x93},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setnc m : 0F 93 /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x93},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sete rm8 : 0F 94 /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x94},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sete m : 0F 94 /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x94},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setz rm8 : 0F 94 /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x94},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setz m : 0F 94 /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x94},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setne rm8 : 0F 95 /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x95},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setne m : 0F 95 /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x95},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setnz rm8 : 0F 95 /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x95},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setnz m : 0F 95 /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x95},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setbe rm8 : 0F 96 /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x96},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setbe m : 0F 96 /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x96},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setna rm8 : 0F 96 /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x96},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setna m : 0F 96 /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x96},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* seta rm8 : 0F 97 /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x97},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* seta m : 0F 97 /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x97},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setnbe rm8 : 0F 97 /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x97},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setnbe m : 0F 97 /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x97},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sets rm8 : 0F 98 /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x98},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sets m : 0F 98 /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x98},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setns rm8 : 0F 99 /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x99},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setns m : 0F 99 /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x99},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setp rm8 : 0F 9A /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9a},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setp m : 0F 9A /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9a},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setpe rm8 : 0F 9A /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9a},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setpe m : 0F 9A /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9a},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setnp rm8 : 0F 9B /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9b},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setnp m : 0F 9B /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9b},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setpo rm8 : 0F 9B /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9b},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setpo m : 0F 9B /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9b},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setl rm8 : 0F 9C /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9c},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setl m : 0F 9C /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9c},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setnge rm8 : 0F 9C /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9c},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setnge m : 0F 9C /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9c},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setge rm8 : 0F 9D /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9d},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setge m : 0F 9D /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9d},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setnl rm8 : 0F 9D /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9d},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setnl m : 0F 9D /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9d},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setle rm8 : 0F 9E /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9e},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setle m : 0F 9E /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9e},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setng rm8 : 0F 9E /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9e},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setng m : 0F 9E /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9e},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setg rm8 : 0F 9F /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9f},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setg m : 0F 9F /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9f},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setnle rm8 : 0F 9F /0 */
+    {.operand_count = 1, .operands = {OPERAND_RM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9f},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* setnle m : 0F 9F /0 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x9f},
+     .opcode_register = false, .modrm = 0,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* jmp rel8 : EB cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xeb},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jmp rel32 : E9 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xe9},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jmp rm64 : FF /4 */
+    {.operand_count = 1, .operands = {OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xff},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* jmp m : FF /4 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xff},
+     .opcode_register = false, .modrm = 4,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* call rel32 : E8 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xe8},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* call rm64 : FF /2 */
+    {.operand_count = 1, .operands = {OPERAND_RM64},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xff},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* call m : FF /2 */
+    {.operand_count = 1, .operands = {OPERAND_M},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xff},
+     .opcode_register = false, .modrm = 2,
+     .reg_operand = -1, .rm_operand = 0, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* jo rel8 : 70 cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x70},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jo rel32 : 0F 80 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x80},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jno rel8 : 71 cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x71},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jno rel32 : 0F 81 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x81},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jb rel8 : 72 cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x72},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jb rel32 : 0F 82 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x82},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jc rel8 : 72 cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x72},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jc rel32 : 0F 82 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x82},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jnae rel8 : 72 cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x72},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jnae rel32 : 0F 82 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x82},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jae rel8 : 73 cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x73},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jae rel32 : 0F 83 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x83},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jnb rel8 : 73 cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x73},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jnb rel32 : 0F 83 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x83},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jnc rel8 : 73 cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x73},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jnc rel32 : 0F 83 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x83},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* je rel8 : 74 cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x74},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* je rel32 : 0F 84 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x84},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jz rel8 : 74 cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x74},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jz rel32 : 0F 84 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x84},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jne rel8 : 75 cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x75},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jne rel32 : 0F 85 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x85},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jnz rel8 : 75 cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x75},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jnz rel32 : 0F 85 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x85},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jbe rel8 : 76 cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x76},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jbe rel32 : 0F 86 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x86},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jna rel8 : 76 cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x76},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jna rel32 : 0F 86 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x86},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* ja rel8 : 77 cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x77},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* ja rel32 : 0F 87 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x87},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jnbe rel8 : 77 cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x77},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jnbe rel32 : 0F 87 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x87},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* js rel8 : 78 cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x78},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* js rel32 : 0F 88 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x88},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jns rel8 : 79 cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x79},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jns rel32 : 0F 89 cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x89},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jp rel8 : 7A cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x7a},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jp rel32 : 0F 8A cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x8a},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jpe rel8 : 7A cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x7a},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jpe rel32 : 0F 8A cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x8a},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jnp rel8 : 7B cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x7b},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jnp rel32 : 0F 8B cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x8b},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jpo rel8 : 7B cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x7b},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jpo rel32 : 0F 8B cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x8b},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jl rel8 : 7C cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x7c},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jl rel32 : 0F 8C cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x8c},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jnge rel8 : 7C cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x7c},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jnge rel32 : 0F 8C cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x8c},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jge rel8 : 7D cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x7d},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jge rel32 : 0F 8D cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x8d},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jnl rel8 : 7D cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x7d},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jnl rel32 : 0F 8D cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x8d},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jle rel8 : 7E cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x7e},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jle rel32 : 0F 8E cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x8e},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jng rel8 : 7E cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x7e},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jng rel32 : 0F 8E cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x8e},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jg rel8 : 7F cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x7f},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jg rel32 : 0F 8F cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x8f},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* jnle rel8 : 7F cb */
+    {.operand_count = 1, .operands = {OPERAND_REL8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x7f},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = true},
+    /* jnle rel32 : 0F 8F cd */
+    {.operand_count = 1, .operands = {OPERAND_REL32},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x8f},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 4, .operand_size = 32,
+     .immediate_signed = false, .relative = true},
+    /* ret : C3 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc3},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* ret imm16 : C2 iw */
+    {.operand_count = 1, .operands = {OPERAND_IMM16},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc2},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 2, .operand_size = 16,
+     .immediate_signed = false, .relative = false},
+    /* leave : C9 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xc9},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* nop : 90 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x90},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* hlt : F4 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf4},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* int3 : CC */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xcc},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* syscall : 0F 05 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x05},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* ud2 : 0F 0B */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x0b},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cpuid : 0F A2 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0xa2},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* rdtsc : 0F 31 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0x0f, 0x31},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* pause : F3 90 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 2, .opcode = {0xf3, 0x90},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* mfence : 0F AE F0 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 3, .opcode = {0x0f, 0xae, 0xf0},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* lfence : 0F AE E8 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 3, .opcode = {0x0f, 0xae, 0xe8},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* sfence : 0F AE F8 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 3, .opcode = {0x0f, 0xae, 0xf8},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cbw : o16 98 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x98},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cwde : 98 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x98},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cdqe : rex.w 98 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x98},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cwd : o16 99 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = true, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x99},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cdq : 99 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0x99},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cqo : rex.w 99 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = true,
+     .opcode_length = 1, .opcode = {0x99},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* clc : F8 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf8},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* stc : F9 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf9},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cmc : F5 */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xf5},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* cld : FC */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xfc},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* std : FD */
+    {.operand_count = 0, .operands = {},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xfd},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = -1,
+     .immediate_size = 0, .operand_size = 0,
+     .immediate_signed = false, .relative = false},
+    /* int imm8 : CD ib */
+    {.operand_count = 1, .operands = {OPERAND_IMM8},
+     .operand_size_prefix = false, .rex_w = false,
+     .opcode_length = 1, .opcode = {0xcd},
+     .opcode_register = false, .modrm = modrm_none,
+     .reg_operand = -1, .rm_operand = -1, .immediate_operand = 0,
+     .immediate_size = 1, .operand_size = 8,
+     .immediate_signed = false, .relative = false},
+};
+
+static const uint16_t instructions_seeds[76] = {
+    3, 1, 0, 3, 1, 1, 4, 3, 1, 5, 0, 1,
+    1, 1, 1, 1, 2, 2, 2, 1, 1, 3, 1, 0,
+    1, 1, 1, 1, 1, 1, 3, 1, 4, 1, 3, 2,
+    2, 2, 2, 3, 3, 3, 2, 1, 1, 5, 1, 2,
+    5, 0, 0, 7, 1, 1, 4, 1, 1, 1, 2, 4,
+    3, 1, 5, 0, 1, 1, 1, 2, 1, 7, 2, 2,
+    1, 3, 9, 0,
+};
+
+static const instruction_t instructions[256] = {
+    [222] = {.mnemonic = "mov", .form_count = 13, .forms = &forms[0]},
+    [62] = {.mnemonic = "movzx", .form_count = 5, .forms = &forms[13]},
+    [46] = {.mnemonic = "movsx", .form_count = 5, .forms = &forms[18]},
+    [4] = {.mnemonic = "movsxd", .form_count = 1, .forms = &forms[23]},
+    [15] = {.mnemonic = "lea", .form_count = 3, .forms = &forms[24]},
+    [21] = {.mnemonic = "xchg", .form_count = 14, .forms = &forms[27]},
+    [239] = {.mnemonic = "push", .form_count = 6, .forms = &forms[41]},
+    [97] = {.mnemonic = "pop", .form_count = 3, .forms = &forms[47]},
+    [27] = {.mnemonic = "add", .form_count = 19, .forms = &forms[50]},
+    [220] = {.mnemonic = "or", .form_count = 19, .forms = &forms[69]},
+    [188] = {.mnemonic = "adc", .form_count = 19, .forms = &forms[88]},
+    [7] = {.mnemonic = "sbb", .form_count = 19, .forms = &forms[107]},
+    [98] = {.mnemonic = "and", .form_count = 19, .forms = &forms[126]},
+    [168] = {.mnemonic = "sub", .form_count = 19, .forms = &forms[145]},
+    [183] = {.mnemonic = "xor", .form_count = 19, .forms = &forms[164]},
+    [104] = {.mnemonic = "cmp", .form_count = 19, .forms = &forms[183]},
+    [199] = {.mnemonic = "test", .form_count = 12, .forms = &forms[202]},
+    [211] = {.mnemonic = "not", .form_count = 4, .forms = &forms[214]},
+    [138] = {.mnemonic = "neg", .form_count = 4, .forms = &forms[218]},
+    [244] = {.mnemonic = "mul", .form_count = 4, .forms = &forms[222]},
+    [144] = {.mnemonic = "imul", .form_count = 13, .forms = &forms[226]},
+    [194] = {.mnemonic = "div", .form_count = 4, .forms = &forms[239]},
+    [28] = {.mnemonic = "idiv", .form_count = 4, .forms = &forms[243]},
+    [208] = {.mnemonic = "inc", .form_count = 4, .forms = &forms[247]},
+    [17] = {.mnemonic = "dec", .form_count = 4, .forms = &forms[251]},
+    [215] = {.mnemonic = "rol", .form_count = 12, .forms = &forms[255]},
+    [225] = {.mnemonic = "ror", .form_count = 12, .forms = &forms[267]},
+    [187] = {.mnemonic = "rcl", .form_count = 12, .forms = &forms[279]},
+    [229] = {.mnemonic = "rcr", .form_count = 12, .forms = &forms[291]},
+    [37] = {.mnemonic = "shl", .form_count = 12, .forms = &forms[303]},
+    [11] = {.mnemonic = "sal", .form_count = 12, .forms = &forms[315]},
+    [89] = {.mnemonic = "shr", .form_count = 12, .forms = &forms[327]},
+    [91] = {.mnemonic = "sar", .form_count = 12, .forms = &forms[339]},
+    [18] = {.mnemonic = "bswap", .form_count = 2, .forms = &forms[351]},
+    [163] = {.mnemonic = "cmovo", .form_count = 3, .forms = &forms[353]},
+    [228] = {.mnemonic = "cmovno", .form_count = 3, .forms = &forms[356]},
+    [26] = {.mnemonic = "cmovb", .form_count = 3, .forms = &forms[359]},
+    [43] = {.mnemonic = "cmovc", .form_count = 3, .forms = &forms[362]},
+    [121] = {.mnemonic = "cmovnae", .form_count = 3, .forms = &forms[365]},
+    [195] = {.mnemonic = "cmovae", .form_count = 3, .forms = &forms[368]},
+    [44] = {.mnemonic = "cmovnb", .form_count = 3, .forms = &forms[371]},
+    [185] = {.mnemonic = "cmovnc", .form_count = 3, .forms = &forms[374]},
+    [67] = {.mnemonic = "cmove", .form_count = 3, .forms = &forms[377]},
+    [127] = {.mnemonic = "cmovz", .form_count = 3, .forms = &forms[380]},
+    [24] = {.mnemonic = "cmovne", .form_count = 3, .forms = &forms[383]},
+    [73] = {.mnemonic = "cmovnz", .form_count = 3, .forms = &forms[386]},
+    [32] = {.mnemonic = "cmovbe", .form_count = 3, .forms = &forms[389]},
+    [85] = {.mnemonic = "cmovna", .form_count = 3, .forms = &forms[392]},
+    [189] = {.mnemonic = "cmova", .form_count = 3, .forms = &forms[395]},
+    [224] = {.mnemonic = "cmovnbe", .form_count = 3, .forms = &forms[398]},
+    [9] = {.mnemonic = "cmovs", .form_count = 3, .forms = &forms[401]},
+    [49] = {.mnemonic = "cmovns", .form_count = 3, .forms = &forms[404]},
+    [234] = {.mnemonic = "cmovp", .form_count = 3, .forms = &forms[407]},
+    [197] = {.mnemonic = "cmovpe", .form_count = 3, .forms = &forms[410]},
+    [47] = {.mnemonic = "cmovnp", .form_count = 3, .forms = &forms[413]},
+    [13] = {.mnemonic = "cmovpo", .form_count = 3, .forms = &forms[416]},
+    [200] = {.mnemonic = "cmovl", .form_count = 3, .forms = &forms[419]},
+    [56] = {.mnemonic = "cmovnge", .form_count = 3, .forms = &forms[422]},
+    [171] = {.mnemonic = "cmovge", .form_count = 3, .forms = &forms[425]},
+    [116] = {.mnemonic = "cmovnl", .form_count = 3, .forms = &forms[428]},
+    [140] = {.mnemonic = "cmovle", .form_count = 3, .forms = &forms[431]},
+    [150] = {.mnemonic = "cmovng", .form_count = 3, .forms = &forms[434]},
+    [81] = {.mnemonic = "cmovg", .form_count = 3, .forms = &forms[437]},
+    [2] = {.mnemonic = "cmovnle", .form_count = 3, .forms = &forms[440]},
+    [19] = {.mnemonic = "seto", .form_count = 2, .forms = &forms[443]},
+    [39] = {.mnemonic = "setno", .form_count = 2, .forms = &forms[445]},
+    [134] = {.mnemonic = "setb", .form_count = 2, .forms = &forms[447]},
+    [69] = {.mnemonic = "setc", .form_count = 2, .forms = &forms[449]},
+    [235] = {.mnemonic = "setnae", .form_count = 2, .forms = &forms[451]},
+    [50] = {.mnemonic = "setae", .form_count = 2, .forms = &forms[453]},
+    [184] = {.mnemonic = "setnb", .form_count = 2, .forms = &forms[455]},
+    [148] = {.mnemonic = "setnc", .form_count = 2, .forms = &forms[457]},
+    [131] = {.mnemonic = "sete", .form_count = 2, .forms = &forms[459]},
+    [41] = {.mnemonic = "setz", .form_count = 2, .forms = &forms[461]},
+    [245] = {.mnemonic = "setne", .form_count = 2, .forms = &forms[463]},
+    [57] = {.mnemonic = "setnz", .form_count = 2, .forms = &forms[465]},
+    [71] = {.mnemonic = "setbe", .form_count = 2, .forms = &forms[467]},
+    [48] = {.mnemonic = "setna", .form_count = 2, .forms = &forms[469]},
+    [87] = {.mnemonic = "seta", .form_count = 2, .forms = &forms[471]},
+    [14] = {.mnemonic = "setnbe", .form_count = 2, .forms = &forms[473]},
+    [221] = {.mnemonic = "sets", .form_count = 2, .forms = &forms[475]},
+    [107] = {.mnemonic = "setns", .form_count = 2, .forms = &forms[477]},
+    [34] = {.mnemonic = "setp", .form_count = 2, .forms = &forms[479]},
+    [193] = {.mnemonic = "setpe", .form_count = 2, .forms = &forms[481]},
+    [96] = {.mnemonic = "setnp", .form_count = 2, .forms = &forms[483]},
+    [133] = {.mnemonic = "setpo", .form_count = 2, .forms = &forms[485]},
+    [125] = {.mnemonic = "setl", .form_count = 2, .forms = &forms[487]},
+    [251] = {.mnemonic = "setnge", .form_count = 2, .forms = &forms[489]},
+    [231] = {.mnemonic = "setge", .form_count = 2, .forms = &forms[491]},
+    [227] = {.mnemonic = "setnl", .form_count = 2, .forms = &forms[493]},
+    [153] = {.mnemonic = "setle", .form_count = 2, .forms = &forms[495]},
+    [180] = {.mnemonic = "setng", .form_count = 2, .forms = &forms[497]},
+    [233] = {.mnemonic = "setg", .form_count = 2, .forms = &forms[499]},
+    [29] = {.mnemonic = "setnle", .form_count = 2, .forms = &forms[501]},
+    [100] = {.mnemonic = "jmp", .form_count = 4, .forms = &forms[503]},
+    [242] = {.mnemonic = "call", .form_count = 3, .forms = &forms[507]},
+    [124] = {.mnemonic = "jo", .form_count = 2, .forms = &forms[510]},
+    [154] = {.mnemonic = "jno", .form_count = 2, .forms = &forms[512]},
+    [190] = {.mnemonic = "jb", .form_count = 2, .forms = &forms[514]},
+    [76] = {.mnemonic = "jc", .form_count = 2, .forms = &forms[516]},
+    [175] = {.mnemonic = "jnae", .form_count = 2, .forms = &forms[518]},
+    [241] = {.mnemonic = "jae", .form_count = 2, .forms = &forms[520]},
+    [218] = {.mnemonic = "jnb", .form_count = 2, .forms = &forms[522]},
+    [10] = {.mnemonic = "jnc", .form_count = 2, .forms = &forms[524]},
+    [92] = {.mnemonic = "je", .form_count = 2, .forms = &forms[526]},
+    [252] = {.mnemonic = "jz", .form_count = 2, .forms = &forms[528]},
+    [178] = {.mnemonic = "jne", .form_count = 2, .forms = &forms[530]},
+    [99] = {.mnemonic = "jnz", .form_count = 2, .forms = &forms[532]},
+    [75] = {.mnemonic = "jbe", .form_count = 2, .forms = &forms[534]},
+    [129] = {.mnemonic = "jna", .form_count = 2, .forms = &forms[536]},
+    [165] = {.mnemonic = "ja", .form_count = 2, .forms = &forms[538]},
+    [117] = {.mnemonic = "jnbe", .form_count = 2, .forms = &forms[540]},
+    [203] = {.mnemonic = "js", .form_count = 2, .forms = &forms[542]},
+    [0] = {.mnemonic = "jns", .form_count = 2, .forms = &forms[544]},
+    [236] = {.mnemonic = "jp", .form_count = 2, .forms = &forms[546]},
+    [45] = {.mnemonic = "jpe", .form_count = 2, .forms = &forms[548]},
+    [84] = {.mnemonic = "jnp", .form_count = 2, .forms = &forms[550]},
+    [60] = {.mnemonic = "jpo", .form_count = 2, .forms = &forms[552]},
+    [1] = {.mnemonic = "jl", .form_count = 2, .forms = &forms[554]},
+    [66] = {.mnemonic = "jnge", .form_count = 2, .forms = &forms[556]},
+    [33] = {.mnemonic = "jge", .form_count = 2, .forms = &forms[558]},
+    [120] = {.mnemonic = "jnl", .form_count = 2, .forms = &forms[560]},
+    [177] = {.mnemonic = "jle", .form_count = 2, .forms = &forms[562]},
+    [63] = {.mnemonic = "jng", .form_count = 2, .forms = &forms[564]},
+    [172] = {.mnemonic = "jg", .form_count = 2, .forms = &forms[566]},
+    [103] = {.mnemonic = "jnle", .form_count = 2, .forms = &forms[568]},
+    [209] = {.mnemonic = "ret", .form_count = 2, .forms = &forms[570]},
+    [143] = {.mnemonic = "leave", .form_count = 1, .forms = &forms[572]},
+    [119] = {.mnemonic = "nop", .form_count = 1, .forms = &forms[573]},
+    [130] = {.mnemonic = "hlt", .form_count = 1, .forms = &forms[574]},
+    [86] = {.mnemonic = "int3", .form_count = 1, .forms = &forms[575]},
+    [22] = {.mnemonic = "syscall", .form_count = 1, .forms = &forms[576]},
+    [72] = {.mnemonic = "ud2", .form_count = 1, .forms = &forms[577]},
+    [132] = {.mnemonic = "cpuid", .form_count = 1, .forms = &forms[578]},
+    [166] = {.mnemonic = "rdtsc", .form_count = 1, .forms = &forms[579]},
+    [52] = {.mnemonic = "pause", .form_count = 1, .forms = &forms[580]},
+    [128] = {.mnemonic = "mfence", .form_count = 1, .forms = &forms[581]},
+    [142] = {.mnemonic = "lfence", .form_count = 1, .forms = &forms[582]},
+    [207] = {.mnemonic = "sfence", .form_count = 1, .forms = &forms[583]},
+    [159] = {.mnemonic = "cbw", .form_count = 1, .forms = &forms[584]},
+    [161] = {.mnemonic = "cwde", .form_count = 1, .forms = &forms[585]},
+    [162] = {.mnemonic = "cdqe", .form_count = 1, .forms = &forms[586]},
+    [16] = {.mnemonic = "cwd", .form_count = 1, .forms = &forms[587]},
+    [40] = {.mnemonic = "cdq", .form_count = 1, .forms = &forms[588]},
+    [113] = {.mnemonic = "cqo", .form_count = 1, .forms = &forms[589]},
+    [201] = {.mnemonic = "clc", .form_count = 1, .forms = &forms[590]},
+    [90] = {.mnemonic = "stc", .form_count = 1, .forms = &forms[591]},
+    [123] = {.mnemonic = "cmc", .form_count = 1, .forms = &forms[592]},
+    [191] = {.mnemonic = "cld", .form_count = 1, .forms = &forms[593]},
+    [135] = {.mnemonic = "std", .form_count = 1, .forms = &forms[594]},
+    [237] = {.mnemonic = "int", .form_count = 1, .forms = &forms[595]},
+};
+
+const instruction_t *instruction_lookup(const char *mnemonic) {
+    uint32_t bucket = table_hash(mnemonic, 0) % 76;
+    uint32_t slot = table_hash(mnemonic, instructions_seeds[bucket]) & 255;
+    const instruction_t *entry = &instructions[slot];
+    if (entry->mnemonic == nullptr || strcmp(entry->mnemonic, mnemonic) != 0)
+        return nullptr;
+    return entry;
+}
+
+static const uint16_t registers_seeds[33] = {
+    1, 3, 9, 1, 0, 4, 2, 3, 1, 4, 2, 6,
+    1, 3, 1, 2, 0, 1, 1, 0, 4, 0, 2, 3,
+    1, 1, 4, 1, 0, 0, 6, 6, 1,
+};
+
+static const register_info_t registers[128] = {
+    [71] = {.name = "rax", .size = 64, .number = 0, .rex = false},
+    [89] = {.name = "rcx", .size = 64, .number = 1, .rex = false},
+    [58] = {.name = "rdx", .size = 64, .number = 2, .rex = false},
+    [7] = {.name = "rbx", .size = 64, .number = 3, .rex = false},
+    [67] = {.name = "rsp", .size = 64, .number = 4, .rex = false},
+    [75] = {.name = "rbp", .size = 64, .number = 5, .rex = false},
+    [47] = {.name = "rsi", .size = 64, .number = 6, .rex = false},
+    [115] = {.name = "rdi", .size = 64, .number = 7, .rex = false},
+    [80] = {.name = "r8", .size = 64, .number = 8, .rex = false},
+    [5] = {.name = "r9", .size = 64, .number = 9, .rex = false},
+    [34] = {.name = "r10", .size = 64, .number = 10, .rex = false},
+    [12] = {.name = "r11", .size = 64, .number = 11, .rex = false},
+    [46] = {.name = "r12", .size = 64, .number = 12, .rex = false},
+    [84] = {.name = "r13", .size = 64, .number = 13, .rex = false},
+    [77] = {.name = "r14", .size = 64, .number = 14, .rex = false},
+    [81] = {.name = "r15", .size = 64, .number = 15, .rex = false},
+    [94] = {.name = "eax", .size = 32, .number = 0, .rex = false},
+    [38] = {.name = "ecx", .size = 32, .number = 1, .rex = false},
+    [85] = {.name = "edx", .size = 32, .number = 2, .rex = false},
+    [54] = {.name = "ebx", .size = 32, .number = 3, .rex = false},
+    [106] = {.name = "esp", .size = 32, .number = 4, .rex = false},
+    [36] = {.name = "ebp", .size = 32, .number = 5, .rex = false},
+    [86] = {.name = "esi", .size = 32, .number = 6, .rex = false},
+    [64] = {.name = "edi", .size = 32, .number = 7, .rex = false},
+    [43] = {.name = "r8d", .size = 32, .number = 8, .rex = false},
+    [66] = {.name = "r9d", .size = 32, .number = 9, .rex = false},
+    [8] = {.name = "r10d", .size = 32, .number = 10, .rex = false},
+    [49] = {.name = "r11d", .size = 32, .number = 11, .rex = false},
+    [119] = {.name = "r12d", .size = 32, .number = 12, .rex = false},
+    [70] = {.name = "r13d", .size = 32, .number = 13, .rex = false},
+    [9] = {.name = "r14d", .size = 32, .number = 14, .rex = false},
+    [21] = {.name = "r15d", .size = 32, .number = 15, .rex = false},
+    [41] = {.name = "ax", .size = 16, .number = 0, .rex = false},
+    [61] = {.name = "cx", .size = 16, .number = 1, .rex = false},
+    [1] = {.name = "dx", .size = 16, .number = 2, .rex = false},
+    [122] = {.name = "bx", .size = 16, .number = 3, .rex = false},
+    [78] = {.name = "sp", .size = 16, .number = 4, .rex = false},
+    [39] = {.name = "bp", .size = 16, .number = 5, .rex = false},
+    [55] = {.name = "si", .size = 16, .number = 6, .rex = false},
+    [127] = {.name = "di", .size = 16, .number = 7, .rex = false},
+    [6] = {.name = "r8w", .size = 16, .number = 8, .rex = false},
+    [107] = {.name = "r9w", .size = 16, .number = 9, .rex = false},
+    [42] = {.name = "r10w", .size = 16, .number = 10, .rex = false},
+    [26] = {.name = "r11w", .size = 16, .number = 11, .rex = false},
+    [93] = {.name = "r12w", .size = 16, .number = 12, .rex = false},
+    [13] = {.name = "r13w", .size = 16, .number = 13, .rex = false},
+    [118] = {.name = "r14w", .size = 16, .number = 14, .rex = false},
+    [20] = {.name = "r15w", .size = 16, .number = 15, .rex = false},
+    [3] = {.name = "al", .size = 8, .number = 0, .rex = false},
+    [62] = {.name = "cl", .size = 8, .number = 1, .rex = false},
+    [90] = {.name = "dl", .size = 8, .number = 2, .rex = false},
+    [116] = {.name = "bl", .size = 8, .number = 3, .rex = false},
+    [24] = {.name = "spl", .size = 8, .number = 4, .rex = true},
+    [110] = {.name = "bpl", .size = 8, .number = 5, .rex = true},
+    [31] = {.name = "sil", .size = 8, .number = 6, .rex = true},
+    [17] = {.name = "dil", .size = 8, .number = 7, .rex = true},
+    [30] = {.name = "r8b", .size = 8, .number = 8, .rex = false},
+    [112] = {.name = "r9b", .size = 8, .number = 9, .rex = false},
+    [96] = {.name = "r10b", .size = 8, .number = 10, .rex = false},
+    [95] = {.name = "r11b", .size = 8, .number = 11, .rex = false},
+    [40] = {.name = "r12b", .size = 8, .number = 12, .rex = false},
+    [99] = {.name = "r13b", .size = 8, .number = 13, .rex = false},
+    [82] = {.name = "r14b", .size = 8, .number = 14, .rex = false},
+    [48] = {.name = "r15b", .size = 8, .number = 15, .rex = false},
+};
+
+const register_info_t *register_lookup(const char *name) {
+    uint32_t bucket = table_hash(name, 0) % 33;
+    uint32_t slot = table_hash(name, registers_seeds[bucket]) & 127;
+    const register_info_t *entry = &registers[slot];
+    if (entry->name == nullptr || strcmp(entry->name, name) != 0)
+        return nullptr;
+    return entry;
+}
+
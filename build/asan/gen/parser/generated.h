@@ -0,0 +1,42 @@
+/* Generated by tools/parsergen.c from doc/parser_grammar.txt, do not edit */
+#ifndef INCLUDE_PARSER_GENERATED_H_
+#define INCLUDE_PARSER_GENERATED_H_
+
+#include "parser/util.h"
+
+parse_result_t parse_generated_program(tokenlist_entry_t *current);
+parse_result_t parse_generated_statement(tokenlist_entry_t *current);
+parse_result_t parse_generated_label(tokenlist_entry_t *current);
+parse_result_t parse_generated_directive(tokenlist_entry_t *current);
+parse_result_t parse_generated_section_directive(tokenlist_entry_t *current);
+parse_result_t parse_generated_align_directive(tokenlist_entry_t *current);
+parse_result_t parse_generated_data_directive(tokenlist_entry_t *current);
+parse_result_t parse_generated_incbin_directive(tokenlist_entry_t *current);
+parse_result_t parse_generated_global_directive(tokenlist_entry_t *current);
+parse_result_t parse_generated_instruction(tokenlist_entry_t *current);
+parse_result_t parse_generated_operands(tokenlist_entry_t *current);
+parse_result_t parse_generated_operand(tokenlist_entry_t *current);
+parse_result_t parse_generated_immediate(tokenlist_entry_t *current);
+parse_result_t parse_generated_number(tokenlist_entry_t *current);
+parse_result_t parse_generated_label_reference(tokenlist_entry_t *current);
+parse_result_t parse_generated_expression(tokenlist_entry_t *current);
+parse_result_t parse_generated_operation(tokenlist_entry_t *current);
+parse_result_t parse_generated_operator(tokenlist_entry_t *current);
+parse_result_t parse_generated_term(tokenlist_entry_t *current);
+parse_result_t parse_generated_unary(tokenlist_entry_t *current);
+parse_result_t parse_generated_unary_operator(tokenlist_entry_t *current);
+parse_result_t parse_generated_parenthesized(tokenlist_entry_t *current);
+parse_result_t parse_generated_memory(tokenlist_entry_t *current);
+parse_result_t parse_generated_memory_expression(tokenlist_entry_t *current);
+parse_result_t parse_generated_register_expression(tokenlist_entry_t *current);
+parse_result_t parse_generated_register_index(tokenlist_entry_t *current);
+parse_result_t parse_generated_register_offset(tokenlist_entry_t *current);
+parse_result_t parse_generated_plus_or_minus(tokenlist_entry_t *current);
+parse_result_t parse_generated_section(tokenlist_entry_t *current);
+parse_result_t parse_generated_align(tokenlist_entry_t *current);
+parse_result_t parse_generated_data(tokenlist_entry_t *current);
+parse_result_t parse_generated_incbin(tokenlist_entry_t *current);
+parse_result_t parse_generated_global(tokenlist_entry_t *current);
+parse_result_t parse_generated_register(tokenlist_entry_t *current);
+
+#endif // INCLUDE_PARSER_GENERATED_H_
@@ -0,0 +1,1259 @@
+/* Generated by tools/parsergen.c from doc/parser_grammar.txt, do not edit */
+#include "parser/generated.h"
+#include "ast.h"
+#include "tokenlist.h"
+#include <string.h>
+
+// Adds a parsed node to its parent, frees the child on failure
+static inline error_t *parse_generated_add(ast_node_t *node,
+                                           ast_node_t *child) {
+    error_t *err = ast_node_add_child(node, child);
+    if (err)
+        ast_node_free(child);
+    return err;
+}
+
+// Moves the children of a group's container node into the parent
+static inline error_t *parse_generated_splice(ast_node_t *node,
+                                              ast_node_t *container) {
+    error_t *err = ast_node_move_children(node, container);
+    ast_node_free(container);
+    return err;
+}
+
+static inline parse_result_t parse_generated_fail(ast_node_t *node,
+                                                  parse_result_t result) {
+    ast_node_free(node);
+    return result;
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_identifier(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_IDENTIFIER)
+        return parse_no_match();
+    return parse_token_node(current, NODE_IDENTIFIER);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_colon(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_COLON)
+        return parse_no_match();
+    return parse_token_node(current, NODE_COLON);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_dot(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_DOT)
+        return parse_no_match();
+    return parse_token_node(current, NODE_DOT);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_comma(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_COMMA)
+        return parse_no_match();
+    return parse_token_node(current, NODE_COMMA);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_string(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_STRING)
+        return parse_no_match();
+    return parse_token_node(current, NODE_STRING);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_octal(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_OCTAL)
+        return parse_no_match();
+    return parse_token_node(current, NODE_OCTAL);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_decimal(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_DECIMAL)
+        return parse_no_match();
+    return parse_token_node(current, NODE_DECIMAL);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_hexadecimal(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_HEXADECIMAL)
+        return parse_no_match();
+    return parse_token_node(current, NODE_HEXADECIMAL);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_binary(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_BINARY)
+        return parse_no_match();
+    return parse_token_node(current, NODE_BINARY);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_plus(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_PLUS)
+        return parse_no_match();
+    return parse_token_node(current, NODE_PLUS);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_minus(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_MINUS)
+        return parse_no_match();
+    return parse_token_node(current, NODE_MINUS);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_asterisk(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_ASTERISK)
+        return parse_no_match();
+    return parse_token_node(current, NODE_ASTERISK);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_slash(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_SLASH)
+        return parse_no_match();
+    return parse_token_node(current, NODE_SLASH);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_shift_left(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_SHIFT_LEFT)
+        return parse_no_match();
+    return parse_token_node(current, NODE_SHIFT_LEFT);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_shift_right(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_SHIFT_RIGHT)
+        return parse_no_match();
+    return parse_token_node(current, NODE_SHIFT_RIGHT);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_ampersand(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_AMPERSAND)
+        return parse_no_match();
+    return parse_token_node(current, NODE_AMPERSAND);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_pipe(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_PIPE)
+        return parse_no_match();
+    return parse_token_node(current, NODE_PIPE);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_dollar(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_DOLLAR)
+        return parse_no_match();
+    return parse_token_node(current, NODE_DOLLAR);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_tilde(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_TILDE)
+        return parse_no_match();
+    return parse_token_node(current, NODE_TILDE);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_lparen(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_LPAREN)
+        return parse_no_match();
+    return parse_token_node(current, NODE_LPAREN);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_rparen(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_RPAREN)
+        return parse_no_match();
+    return parse_token_node(current, NODE_RPAREN);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_lbracket(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_LBRACKET)
+        return parse_no_match();
+    return parse_token_node(current, NODE_LBRACKET);
+}
+
+[[maybe_unused]] static inline parse_result_t parse_generated_rbracket(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_RBRACKET)
+        return parse_no_match();
+    return parse_token_node(current, NODE_RBRACKET);
+}
+
+static parse_result_t parse_generated_directive_group1(tokenlist_entry_t *current);
+static parse_result_t parse_generated_align_directive_group1(tokenlist_entry_t *current);
+static parse_result_t parse_generated_operands_group1(tokenlist_entry_t *current);
+static parse_result_t parse_generated_number_group1(tokenlist_entry_t *current);
+
+parse_result_t parse_generated_program(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_PROGRAM;
+    parse_result_t result;
+
+    while ((result = parse_generated_statement(current)).err == nullptr) {
+        if ((result.err = parse_generated_add(node, result.node)))
+            return parse_generated_fail(node, result);
+        current = result.next;
+    }
+    if (result.err && result.err != err_parse_no_match)
+        return parse_generated_fail(node, result);
+
+    return parse_success(node, current);
+}
+
+parse_result_t parse_generated_statement(tokenlist_entry_t *current) {
+    parse_result_t result;
+    if (current == nullptr)
+        return parse_no_match();
+    switch (current->token.id) {
+    case TOKEN_IDENTIFIER:
+        result = parse_generated_label(current);
+        if (result.err == nullptr)
+            return result;
+        result = parse_generated_instruction(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_DOT:
+        result = parse_generated_directive(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    default:
+        return parse_no_match();
+    }
+}
+
+parse_result_t parse_generated_label(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_LABEL;
+    parse_result_t result;
+
+    result = parse_generated_identifier(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_colon(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    return parse_success(node, current);
+}
+
+static parse_result_t parse_generated_directive_group1(tokenlist_entry_t *current) {
+    parse_result_t result;
+    if (current == nullptr)
+        return parse_no_match();
+    switch (current->token.id) {
+    case TOKEN_IDENTIFIER:
+        result = parse_generated_section_directive(current);
+        if (result.err == nullptr)
+            return result;
+        result = parse_generated_align_directive(current);
+        if (result.err == nullptr)
+            return result;
+        result = parse_generated_data_directive(current);
+        if (result.err == nullptr)
+            return result;
+        result = parse_generated_incbin_directive(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    default:
+        return parse_no_match();
+    }
+}
+
+parse_result_t parse_generated_directive(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_DIRECTIVE;
+    parse_result_t result;
+
+    result = parse_generated_dot(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_directive_group1(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    return parse_success(node, current);
+}
+
+parse_result_t parse_generated_section_directive(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_SECTION_DIRECTIVE;
+    parse_result_t result;
+
+    result = parse_generated_section(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_identifier(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    return parse_success(node, current);
+}
+
+static parse_result_t parse_generated_align_directive_group1(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_INVALID;
+    parse_result_t result;
+
+    result = parse_generated_comma(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_number(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    return parse_success(node, current);
+}
+
+parse_result_t parse_generated_align_directive(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_ALIGN_DIRECTIVE;
+    parse_result_t result;
+
+    result = parse_generated_align(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_number(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_align_directive_group1(current);
+    if (result.err == nullptr) {
+        if ((result.err = parse_generated_splice(node, result.node)))
+            return parse_generated_fail(node, result);
+        current = result.next;
+    }
+
+    return parse_success(node, current);
+}
+
+parse_result_t parse_generated_data_directive(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_DATA_DIRECTIVE;
+    parse_result_t result;
+
+    result = parse_generated_data(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_immediate(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+    while (current && current->token.id == TOKEN_COMMA) {
+        current = tokenlist_next(current);
+        result = parse_generated_immediate(current);
+        if (result.err == err_parse_no_match)
+            break;
+        if (result.err || (result.err = parse_generated_add(node, result.node)))
+            return parse_generated_fail(node, result);
+        current = result.next;
+    }
+
+    return parse_success(node, current);
+}
+
+parse_result_t parse_generated_incbin_directive(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_INCBIN_DIRECTIVE;
+    parse_result_t result;
+
+    result = parse_generated_incbin(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_string(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    return parse_success(node, current);
+}
+
+parse_result_t parse_generated_instruction(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_INSTRUCTION;
+    parse_result_t result;
+
+    result = parse_generated_identifier(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_operands(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    return parse_success(node, current);
+}
+
+static parse_result_t parse_generated_operands_group1(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_INVALID;
+    parse_result_t result;
+
+    result = parse_generated_operand(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+    while (current && current->token.id == TOKEN_COMMA) {
+        current = tokenlist_next(current);
+        result = parse_generated_operand(current);
+        if (result.err == err_parse_no_match)
+            break;
+        if (result.err || (result.err = parse_generated_add(node, result.node)))
+            return parse_generated_fail(node, result);
+        current = result.next;
+    }
+
+    return parse_success(node, current);
+}
+
+parse_result_t parse_generated_operands(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_OPERANDS;
+    parse_result_t result;
+
+    result = parse_generated_operands_group1(current);
+    if (result.err == nullptr) {
+        if ((result.err = parse_generated_splice(node, result.node)))
+            return parse_generated_fail(node, result);
+        current = result.next;
+    }
+
+    return parse_success(node, current);
+}
+
+parse_result_t parse_generated_operand(tokenlist_entry_t *current) {
+    parse_result_t result;
+    if (current == nullptr)
+        return parse_no_match();
+    switch (current->token.id) {
+    case TOKEN_IDENTIFIER:
+        result = parse_generated_register(current);
+        if (result.err == nullptr)
+            return result;
+        result = parse_generated_immediate(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_OCTAL:
+    case TOKEN_DECIMAL:
+    case TOKEN_HEXADECIMAL:
+    case TOKEN_BINARY:
+    case TOKEN_MINUS:
+    case TOKEN_DOLLAR:
+    case TOKEN_TILDE:
+    case TOKEN_LPAREN:
+        result = parse_generated_immediate(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_LBRACKET:
+        result = parse_generated_memory(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    default:
+        return parse_no_match();
+    }
+}
+
+parse_result_t parse_generated_immediate(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_IMMEDIATE;
+    parse_result_t result;
+
+    result = parse_generated_expression(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    return parse_success(node, current);
+}
+
+static parse_result_t parse_generated_number_group1(tokenlist_entry_t *current) {
+    parse_result_t result;
+    if (current == nullptr)
+        return parse_no_match();
+    switch (current->token.id) {
+    case TOKEN_OCTAL:
+        result = parse_generated_octal(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_DECIMAL:
+        result = parse_generated_decimal(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_HEXADECIMAL:
+        result = parse_generated_hexadecimal(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_BINARY:
+        result = parse_generated_binary(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    default:
+        return parse_no_match();
+    }
+}
+
+parse_result_t parse_generated_number(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_NUMBER;
+    parse_result_t result;
+
+    result = parse_generated_number_group1(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    return parse_success(node, current);
+}
+
+parse_result_t parse_generated_label_reference(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_IDENTIFIER)
+        return parse_no_match();
+    return parse_token_node(current, NODE_LABEL_REFERENCE);
+}
+
+parse_result_t parse_generated_expression(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_EXPRESSION;
+    parse_result_t result;
+
+    result = parse_generated_term(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    while ((result = parse_generated_operation(current)).err == nullptr) {
+        if ((result.err = parse_generated_add(node, result.node)))
+            return parse_generated_fail(node, result);
+        current = result.next;
+    }
+    if (result.err && result.err != err_parse_no_match)
+        return parse_generated_fail(node, result);
+
+    return parse_success(node, current);
+}
+
+parse_result_t parse_generated_operation(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_OPERATION;
+    parse_result_t result;
+
+    result = parse_generated_operator(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_term(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    return parse_success(node, current);
+}
+
+parse_result_t parse_generated_operator(tokenlist_entry_t *current) {
+    parse_result_t result;
+    if (current == nullptr)
+        return parse_no_match();
+    switch (current->token.id) {
+    case TOKEN_PLUS:
+        result = parse_generated_plus(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_MINUS:
+        result = parse_generated_minus(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_ASTERISK:
+        result = parse_generated_asterisk(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_SLASH:
+        result = parse_generated_slash(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_SHIFT_LEFT:
+        result = parse_generated_shift_left(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_SHIFT_RIGHT:
+        result = parse_generated_shift_right(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_AMPERSAND:
+        result = parse_generated_ampersand(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_PIPE:
+        result = parse_generated_pipe(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    default:
+        return parse_no_match();
+    }
+}
+
+parse_result_t parse_generated_term(tokenlist_entry_t *current) {
+    parse_result_t result;
+    if (current == nullptr)
+        return parse_no_match();
+    switch (current->token.id) {
+    case TOKEN_IDENTIFIER:
+        result = parse_generated_label_reference(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_OCTAL:
+    case TOKEN_DECIMAL:
+    case TOKEN_HEXADECIMAL:
+    case TOKEN_BINARY:
+        result = parse_generated_number(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_MINUS:
+    case TOKEN_TILDE:
+        result = parse_generated_unary(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_DOLLAR:
+        result = parse_generated_dollar(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_LPAREN:
+        result = parse_generated_parenthesized(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    default:
+        return parse_no_match();
+    }
+}
+
+parse_result_t parse_generated_unary(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_UNARY;
+    parse_result_t result;
+
+    result = parse_generated_unary_operator(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_term(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    return parse_success(node, current);
+}
+
+parse_result_t parse_generated_unary_operator(tokenlist_entry_t *current) {
+    parse_result_t result;
+    if (current == nullptr)
+        return parse_no_match();
+    switch (current->token.id) {
+    case TOKEN_MINUS:
+        result = parse_generated_minus(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_TILDE:
+        result = parse_generated_tilde(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    default:
+        return parse_no_match();
+    }
+}
+
+parse_result_t parse_generated_parenthesized(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_PARENTHESIZED;
+    parse_result_t result;
+
+    result = parse_generated_lparen(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_expression(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_rparen(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    return parse_success(node, current);
+}
+
+parse_result_t parse_generated_memory(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_MEMORY;
+    parse_result_t result;
+
+    result = parse_generated_lbracket(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_memory_expression(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_rbracket(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    return parse_success(node, current);
+}
+
+parse_result_t parse_generated_memory_expression(tokenlist_entry_t *current) {
+    parse_result_t result;
+    if (current == nullptr)
+        return parse_no_match();
+    switch (current->token.id) {
+    case TOKEN_IDENTIFIER:
+        result = parse_generated_register_expression(current);
+        if (result.err == nullptr)
+            return result;
+        result = parse_generated_expression(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_OCTAL:
+    case TOKEN_DECIMAL:
+    case TOKEN_HEXADECIMAL:
+    case TOKEN_BINARY:
+    case TOKEN_MINUS:
+    case TOKEN_DOLLAR:
+    case TOKEN_TILDE:
+    case TOKEN_LPAREN:
+        result = parse_generated_expression(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    default:
+        return parse_no_match();
+    }
+}
+
+parse_result_t parse_generated_register_expression(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_REGISTER_EXPRESSION;
+    parse_result_t result;
+
+    result = parse_generated_register(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_register_index(current);
+    if (result.err == nullptr) {
+        if ((result.err = parse_generated_add(node, result.node)))
+            return parse_generated_fail(node, result);
+        current = result.next;
+    }
+
+    result = parse_generated_register_offset(current);
+    if (result.err == nullptr) {
+        if ((result.err = parse_generated_add(node, result.node)))
+            return parse_generated_fail(node, result);
+        current = result.next;
+    }
+
+    return parse_success(node, current);
+}
+
+parse_result_t parse_generated_register_index(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_REGISTER_INDEX;
+    parse_result_t result;
+
+    result = parse_generated_plus(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_register(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_asterisk(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_number(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    return parse_success(node, current);
+}
+
+parse_result_t parse_generated_register_offset(tokenlist_entry_t *current) {
+    ast_node_t *node;
+    error_t *err = ast_node_alloc(&node);
+    if (err)
+        return parse_error(err);
+    node->id = NODE_REGISTER_OFFSET;
+    parse_result_t result;
+
+    result = parse_generated_plus_or_minus(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    result = parse_generated_expression(current);
+    if (result.err || (result.err = parse_generated_add(node, result.node)))
+        return parse_generated_fail(node, result);
+    current = result.next;
+
+    return parse_success(node, current);
+}
+
+parse_result_t parse_generated_plus_or_minus(tokenlist_entry_t *current) {
+    parse_result_t result;
+    if (current == nullptr)
+        return parse_no_match();
+    switch (current->token.id) {
+    case TOKEN_PLUS:
+        result = parse_generated_plus(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    case TOKEN_MINUS:
+        result = parse_generated_minus(current);
+        if (result.err == nullptr)
+            return result;
+        return parse_no_match();
+    default:
+        return parse_no_match();
+    }
+}
+
+static bool parse_generated_is_section(const char *value) {
+    return strcmp(value + 0, "section") == 0;
+}
+
+parse_result_t parse_generated_section(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_IDENTIFIER ||
+        !parse_generated_is_section(current->token.value))
+        return parse_no_match();
+    return parse_token_node(current, NODE_SECTION);
+}
+
+static bool parse_generated_is_align(const char *value) {
+    return strcmp(value + 0, "align") == 0;
+}
+
+parse_result_t parse_generated_align(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_IDENTIFIER ||
+        !parse_generated_is_align(current->token.value))
+        return parse_no_match();
+    return parse_token_node(current, NODE_ALIGN);
+}
+
+static bool parse_generated_is_data(const char *value) {
+    switch (value[0]) {
+    case 'd':
+        switch (value[1]) {
+        case 'b':
+            return value[2] == '\0';
+        case 'd':
+            return value[2] == '\0';
+        case 'q':
+            return value[2] == '\0';
+        case 'w':
+            return value[2] == '\0';
+        default:
+            return false;
+        }
+    default:
+        return false;
+    }
+}
+
+parse_result_t parse_generated_data(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_IDENTIFIER ||
+        !parse_generated_is_data(current->token.value))
+        return parse_no_match();
+    return parse_token_node(current, NODE_DATA);
+}
+
+static bool parse_generated_is_incbin(const char *value) {
+    return strcmp(value + 0, "incbin") == 0;
+}
+
+parse_result_t parse_generated_incbin(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_IDENTIFIER ||
+        !parse_generated_is_incbin(current->token.value))
+        return parse_no_match();
+    return parse_token_node(current, NODE_INCBIN);
+}
+
+static bool parse_generated_is_register(const char *value) {
+    switch (value[0]) {
+    case 'a':
+        switch (value[1]) {
+        case 'l':
+            return value[2] == '\0';
+        case 'x':
+            return value[2] == '\0';
+        default:
+            return false;
+        }
+    case 'b':
+        switch (value[1]) {
+        case 'l':
+            return value[2] == '\0';
+        case 'p':
+            switch (value[2]) {
+            case '\0':
+                return true;
+            case 'l':
+                return value[3] == '\0';
+            default:
+                return false;
+            }
+        case 'x':
+            return value[2] == '\0';
+        default:
+            return false;
+        }
+    case 'c':
+        switch (value[1]) {
+        case 'l':
+            return value[2] == '\0';
+        case 'x':
+            return value[2] == '\0';
+        default:
+            return false;
+        }
+    case 'd':
+        switch (value[1]) {
+        case 'i':
+            switch (value[2]) {
+            case '\0':
+                return true;
+            case 'l':
+                return value[3] == '\0';
+            default:
+                return false;
+            }
+        case 'l':
+            return value[2] == '\0';
+        case 'x':
+            return value[2] == '\0';
+        default:
+            return false;
+        }
+    case 'e':
+        switch (value[1]) {
+        case 'a':
+            return strcmp(value + 2, "x") == 0;
+        case 'b':
+            switch (value[2]) {
+            case 'p':
+                return value[3] == '\0';
+            case 'x':
+                return value[3] == '\0';
+            default:
+                return false;
+            }
+        case 'c':
+            return strcmp(value + 2, "x") == 0;
+        case 'd':
+            switch (value[2]) {
+            case 'i':
+                return value[3] == '\0';
+            case 'x':
+                return value[3] == '\0';
+            default:
+                return false;
+            }
+        case 's':
+            switch (value[2]) {
+            case 'i':
+                return value[3] == '\0';
+            case 'p':
+                return value[3] == '\0';
+            default:
+                return false;
+            }
+        default:
+            return false;
+        }
+    case 'r':
+        switch (value[1]) {
+        case '1':
+            switch (value[2]) {
+            case '0':
+                switch (value[3]) {
+                case '\0':
+                    return true;
+                case 'b':
+                    return value[4] == '\0';
+                case 'd':
+                    return value[4] == '\0';
+                case 'w':
+                    return value[4] == '\0';
+                default:
+                    return false;
+                }
+            case '1':
+                switch (value[3]) {
+                case '\0':
+                    return true;
+                case 'b':
+                    return value[4] == '\0';
+                case 'd':
+                    return value[4] == '\0';
+                case 'w':
+                    return value[4] == '\0';
+                default:
+                    return false;
+                }
+            case '2':
+                switch (value[3]) {
+                case '\0':
+                    return true;
+                case 'b':
+                    return value[4] == '\0';
+                case 'd':
+                    return value[4] == '\0';
+                case 'w':
+                    return value[4] == '\0';
+                default:
+                    return false;
+                }
+            case '3':
+                switch (value[3]) {
+                case '\0':
+                    return true;
+                case 'b':
+                    return value[4] == '\0';
+                case 'd':
+                    return value[4] == '\0';
+                case 'w':
+                    return value[4] == '\0';
+                default:
+                    return false;
+                }
+            case '4':
+                switch (value[3]) {
+                case '\0':
+                    return true;
+                case 'b':
+                    return value[4] == '\0';
+                case 'd':
+                    return value[4] == '\0';
+                case 'w':
+                    return value[4] == '\0';
+                default:
+                    return false;
+                }
+            case '5':
+                switch (value[3]) {
+                case '\0':
+                    return true;
+                case 'b':
+                    return value[4] == '\0';
+                case 'd':
+                    return value[4] == '\0';
+                case 'w':
+                    return value[4] == '\0';
+                default:
+                    return false;
+                }
+            default:
+                return false;
+            }
+        case '8':
+            switch (value[2]) {
+            case '\0':
+                return true;
+            case 'b':
+                return value[3] == '\0';
+            case 'd':
+                return value[3] == '\0';
+            case 'w':
+                return value[3] == '\0';
+            default:
+                return false;
+            }
+        case '9':
+            switch (value[2]) {
+            case '\0':
+                return true;
+            case 'b':
+                return value[3] == '\0';
+            case 'd':
+                return value[3] == '\0';
+            case 'w':
+                return value[3] == '\0';
+            default:
+                return false;
+            }
+        case 'a':
+            return strcmp(value + 2, "x") == 0;
+        case 'b':
+            switch (value[2]) {
+            case 'p':
+                return value[3] == '\0';
+            case 'x':
+                return value[3] == '\0';
+            default:
+                return false;
+            }
+        case 'c':
+            return strcmp(value + 2, "x") == 0;
+        case 'd':
+            switch (value[2]) {
+            case 'i':
+                return value[3] == '\0';
+            case 'x':
+                return value[3] == '\0';
+            default:
+                return false;
+            }
+        case 's':
+            switch (value[2]) {
+            case 'i':
+                return value[3] == '\0';
+            case 'p':
+                return value[3] == '\0';
+            default:
+                return false;
+            }
+        default:
+            return false;
+        }
+    case 's':
+        switch (value[1]) {
+        case 'i':
+            switch (value[2]) {
+            case '\0':
+                return true;
+            case 'l':
+                return value[3] == '\0';
+            default:
+                return false;
+            }
+        case 'p':
+            switch (value[2]) {
+            case '\0':
+                return true;
+            case 'l':
+                return value[3] == '\0';
+            default:
+                return false;
+            }
+        default:
+            return false;
+        }
+    default:
+        return false;
+    }
+}
+
+parse_result_t parse_generated_register(tokenlist_entry_t *current) {
+    if (current == nullptr || current->token.id != TOKEN_IDENTIFIER ||
+        !parse_generated_is_register(current->token.value))
+        return parse_no_match();
+    return parse_token_node(current, NODE_REGISTER);
+}
+
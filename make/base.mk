@@ -4,22 +4,70 @@ CC?=clang
 LD?=clang
 CFLAGS?=-Wall -Wextra -Wpedantic -O0 -g3 -std=c23 -fno-omit-frame-pointer -fno-optimize-sibling-calls -D_POSIX_C_SOURCE=200809L
 LDFLAGS?=
+# The encoder runs on a pool of threads
+LDLIBS=-pthread
 BUILD_DIR?=build/debug/
+# The generators run on the host while building, without the sanitizers of
+# the build they generate for
+TOOL_CFLAGS?=$(filter-out -fsanitize=%,$(CFLAGS))
+
+GENERATED_DIR=$(BUILD_DIR)gen/
+INCLUDES=-Isrc -I$(GENERATED_DIR)
+
+PARSER_GENERATOR=$(BUILD_DIR)tools/parsergen
+PARSER_GRAMMAR=doc/parser_grammar.txt
+GENERATED_PARSER=$(GENERATED_DIR)parser/generated.c
+GENERATED_PARSER_HEADER=$(GENERATED_DIR)parser/generated.h
+
+ENCODER_GENERATOR=$(BUILD_DIR)tools/encodergen
+INSTRUCTION_TABLE=doc/instructions.txt
+GENERATED_ENCODER_TABLE=$(GENERATED_DIR)encoder/table.c
 
 SOURCES?=$(shell find src/ -type f -name '*.c')
-OBJECTS=$(patsubst %.c,$(BUILD_DIR)%.o,$(SOURCES))
-DEPENDENCIES=$(OBJECTS:.o=.d)
+GENERATED_SOURCES=$(GENERATED_PARSER) $(GENERATED_ENCODER_TABLE)
+OBJECTS=$(patsubst %.c,$(BUILD_DIR)%.o,$(SOURCES)) $(GENERATED_SOURCES:.c=.o)
+# Everything but main, linked into the benchmarks
+LIBRARY_OBJECTS=$(filter-out $(BUILD_DIR)src/main.o,$(OBJECTS))
+BENCH_SOURCES=$(shell find bench/ -type f -name '*.c')
+BENCHMARKS=$(patsubst %.c,$(BUILD_DIR)%,$(BENCH_SOURCES))
+DEPENDENCIES=$(OBJECTS:.o=.d) $(BENCHMARKS:=.d)
 TARGET?=oas
 
 all: $(BUILD_DIR)$(TARGET)
 	
 
+bench: $(BENCHMARKS)
+	for BENCHMARK in $(BENCHMARKS); do $$BENCHMARK || exit 1; done
+
 $(BUILD_DIR)$(TARGET): $(OBJECTS)
-	$(LD) $(LDFLAGS) -o $@ $^
+	$(LD) $(LDFLAGS) -o $@ $^ $(LDLIBS)
+
+$(BUILD_DIR)bench/%: $(BUILD_DIR)bench/%.o $(LIBRARY_OBJECTS)
+	$(LD) $(LDFLAGS) -o $@ $^ $(LDLIBS)
+
+# Every object may include generated headers, so they have to exist first
+$(OBJECTS) $(BENCHMARKS:=.o): | $(GENERATED_PARSER_HEADER)
 
 $(BUILD_DIR)%.o: %.c
 	mkdir -p $(dir $@)
-	$(CC) $(CFLAGS) -MMD -MP -c $< -o $@
+	$(CC) $(CFLAGS) $(INCLUDES) -MMD -MP -c $< -o $@
+
+$(GENERATED_DIR)%.o: $(GENERATED_DIR)%.c
+	$(CC) $(CFLAGS) $(INCLUDES) -MMD -MP -c $< -o $@
+
+$(BUILD_DIR)tools/%: tools/%.c
+	mkdir -p $(dir $@)
+	$(CC) $(TOOL_CFLAGS) -o $@ $<
+
+$(GENERATED_PARSER): $(PARSER_GRAMMAR) $(PARSER_GENERATOR)
+	mkdir -p $(dir $@)
+	$(PARSER_GENERATOR) $(PARSER_GRAMMAR) $@ $(GENERATED_PARSER_HEADER)
+
+$(GENERATED_PARSER_HEADER): $(GENERATED_PARSER)
+
+$(GENERATED_ENCODER_TABLE): $(INSTRUCTION_TABLE) $(ENCODER_GENERATOR)
+	mkdir -p $(dir $@)
+	$(ENCODER_GENERATOR) $(INSTRUCTION_TABLE) $@
 
 -include $(DEPENDENCIES)
 
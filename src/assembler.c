@@ -0,0 +1,1268 @@
+#include "assembler.h"
+#include "encoder/encoder.h"
+#include "error.h"
+#include "lexer.h"
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+error_t *err_assembler_redefined =
+    &(error_t){.message = "Label is already defined"};
+error_t *err_assembler_undefined = &(error_t){.message = "Undefined label"};
+error_t *err_assembler_difference = &(error_t){
+    .message = "Both labels of a difference have to be defined in the same "
+               "section"};
+error_t *err_assembler_alignment = &(error_t){
+    .message = "Alignment must be a power of two no larger than 4096"};
+error_t *err_assembler_fill =
+    &(error_t){.message = "Fill value must fit in a byte"};
+error_t *err_assembler_data =
+    &(error_t){.message = "Value doesn't fit in the size of the data"};
+error_t *err_assembler_data_label =
+    &(error_t){.message = "Only .dd and .dq can hold the address of a label"};
+error_t *err_assembler_incbin =
+    &(error_t){.message = "Can't map the included file"};
+
+constexpr size_t assembler_default_code_cap = 4096;
+constexpr size_t assembler_default_fixups_cap = 64;
+constexpr size_t assembler_default_relocations_cap = 16;
+constexpr size_t assembler_default_fragments_cap = 64;
+constexpr size_t assembler_max_alignment = 4096;
+constexpr size_t assembler_default_sections_cap = 4;
+constexpr size_t assembler_default_blobs_cap = 4;
+// Values of a data directive are converted to little endian this many at a
+// time
+constexpr size_t assembler_data_chunk = 256;
+// Splits regions without labels so that they still spread over the pool
+constexpr size_t assembler_max_region_statements = 4096;
+
+static const char *assembler_default_section = "text";
+// The section padded with NOPs by default
+static const char *assembler_code_section = "text";
+
+static error_t *assembler_add_section(assembler_t *assembler,
+                                      const char *name) {
+    if (assembler->sections_len == assembler->sections_cap) {
+        size_t new_cap = assembler->sections_cap
+                             ? assembler->sections_cap * 2
+                             : assembler_default_sections_cap;
+        section_t *sections =
+            realloc(assembler->sections, new_cap * sizeof(section_t));
+        if (sections == nullptr)
+            return err_allocation_failed;
+        assembler->sections = sections;
+        assembler->sections_cap = new_cap;
+    }
+
+    assembler->sections[assembler->sections_len] = (section_t){.name = name};
+    assembler->current = assembler->sections_len;
+    assembler->sections_len += 1;
+    return nullptr;
+}
+
+error_t *assembler_alloc(assembler_t **output) {
+    *output = nullptr;
+
+    assembler_t *assembler = calloc(1, sizeof(assembler_t));
+    if (assembler == nullptr)
+        return err_allocation_failed;
+
+    error_t *err = symbols_alloc(&assembler->symbols);
+    if (err == nullptr)
+        err = encoder_cache_alloc(&assembler->cache);
+    if (err == nullptr)
+        err = assembler_add_section(assembler, assembler_default_section);
+    if (err) {
+        assembler_free(assembler);
+        return err;
+    }
+
+    *output = assembler;
+    return nullptr;
+}
+
+static void assembler_free_section(section_t *section) {
+    for (size_t i = 0; i < section->blobs_len; ++i)
+        munmap((void *)section->blobs[i].data, section->blobs[i].size);
+    free(section->blobs);
+    free(section->code);
+    free(section->relocations);
+    free(section->fragments);
+    free(section->growth);
+}
+
+void assembler_free(assembler_t *assembler) {
+    if (assembler == nullptr)
+        return;
+    for (size_t i = 0; i < assembler->sections_len; ++i)
+        assembler_free_section(&assembler->sections[i]);
+    free(assembler->sections);
+    symbols_free(assembler->symbols);
+    encoder_cache_free(assembler->cache);
+    free(assembler->fixups);
+    free(assembler);
+}
+
+void assembler_reset(assembler_t *assembler) {
+    for (size_t i = 1; i < assembler->sections_len; ++i)
+        assembler_free_section(&assembler->sections[i]);
+    assembler->sections_len = 1;
+    assembler->current = 0;
+
+    section_t *text = &assembler->sections[0];
+    for (size_t i = 0; i < text->blobs_len; ++i)
+        munmap((void *)text->blobs[i].data, text->blobs[i].size);
+    free(text->growth);
+    text->growth = nullptr;
+    text->len = 0;
+    text->blobs_len = 0;
+    text->relocations_len = 0;
+    text->fragments_len = 0;
+    text->alignment = 0;
+
+    assembler->fixups_len = 0;
+    symbols_clear(assembler->symbols);
+    assembler->fusible = nullptr;
+    assembler->fusible_offset = 0;
+}
+
+static error_t *assembler_reserve(section_t *section, size_t len) {
+    if (section->len + len <= section->cap)
+        return nullptr;
+
+    size_t new_cap = section->cap ? section->cap : assembler_default_code_cap;
+    while (new_cap < section->len + len)
+        new_cap *= 2;
+    uint8_t *code = realloc(section->code, new_cap);
+    if (code == nullptr)
+        return err_allocation_failed;
+    section->code = code;
+    section->cap = new_cap;
+    return nullptr;
+}
+
+static error_t *assembler_add_relocation(section_t *section,
+                                         relocation_t relocation) {
+    if (section->relocations_len == section->relocations_cap) {
+        size_t new_cap = section->relocations_cap
+                             ? section->relocations_cap * 2
+                             : assembler_default_relocations_cap;
+        relocation_t *relocations =
+            realloc(section->relocations, new_cap * sizeof(relocation_t));
+        if (relocations == nullptr)
+            return err_allocation_failed;
+        section->relocations = relocations;
+        section->relocations_cap = new_cap;
+    }
+
+    section->relocations[section->relocations_len++] = relocation;
+    return nullptr;
+}
+
+static error_t *assembler_add_fragment(section_t *section,
+                                       fragment_t fragment) {
+    if (section->fragments_len == section->fragments_cap) {
+        size_t new_cap = section->fragments_cap
+                             ? section->fragments_cap * 2
+                             : assembler_default_fragments_cap;
+        fragment_t *fragments =
+            realloc(section->fragments, new_cap * sizeof(fragment_t));
+        if (fragments == nullptr)
+            return err_allocation_failed;
+        section->fragments = fragments;
+        section->fragments_cap = new_cap;
+    }
+
+    section->fragments[section->fragments_len++] = fragment;
+    return nullptr;
+}
+
+// Adds a fixup for a reference to symbol, which waits for the label unless
+// it is defined already. Without a symbol the fixup is defined already.
+static error_t *assembler_add_fixup(assembler_t *assembler, symbol_t *symbol,
+                                    fixup_t fixup) {
+    if (assembler->fixups_len == assembler->fixups_cap) {
+        size_t new_cap = assembler->fixups_cap ? assembler->fixups_cap * 2
+                                               : assembler_default_fixups_cap;
+        fixup_t *fixups =
+            realloc(assembler->fixups, new_cap * sizeof(fixup_t));
+        if (fixups == nullptr)
+            return err_allocation_failed;
+        assembler->fixups = fixups;
+        assembler->fixups_cap = new_cap;
+    }
+
+    fixup.next = symbol_no_fixup;
+    if (symbol && symbol->defined) {
+        fixup.defined = true;
+        fixup.target_section = symbol->section;
+        fixup.target = symbol->offset;
+    } else if (symbol) {
+        fixup.next = symbol->fixups;
+        symbol->fixups = assembler->fixups_len;
+    }
+    assembler->fixups[assembler->fixups_len++] = fixup;
+    return nullptr;
+}
+
+// Adds the fixup of a reference to label plus addend, minus the label minus
+// for a difference. $ is the offset of the statement, which starts at start.
+static error_t *assembler_reference(assembler_t *assembler,
+                                    tokenlist_entry_t *label,
+                                    tokenlist_entry_t *minus, int64_t addend,
+                                    size_t start, fixup_t fixup) {
+    fixup.token = label;
+    fixup.addend = addend;
+    fixup.minus = minus;
+    if (minus && minus->token.id == TOKEN_DOLLAR) {
+        fixup.minus_defined = true;
+        fixup.minus_section = assembler->current;
+        fixup.minus_target = start;
+    }
+    if (label->token.id == TOKEN_DOLLAR) {
+        fixup.defined = true;
+        fixup.target_section = assembler->current;
+        fixup.target = start;
+        return assembler_add_fixup(assembler, nullptr, fixup);
+    }
+
+    symbol_t *symbol;
+    error_t *err = symbols_get(assembler->symbols, label, &symbol);
+    if (err)
+        return err;
+    return assembler_add_fixup(assembler, symbol, fixup);
+}
+
+static error_t *assembler_label(assembler_t *assembler, ast_node_t *label) {
+    symbol_t *symbol;
+    tokenlist_entry_t *name = ast_node_child(label, 0)->token_entry;
+    error_t *err = symbols_get(assembler->symbols, name, &symbol);
+    if (err)
+        return err;
+    if (symbol->defined)
+        return err_assembler_redefined;
+
+    // Code can jump in between, so the instructions around don't fuse
+    assembler->fusible = nullptr;
+    symbol->defined = true;
+    symbol->section = assembler->current;
+    symbol->offset = assembler->sections[assembler->current].len;
+    symbol->token = name;
+
+    for (size_t i = symbol->fixups; i != symbol_no_fixup;) {
+        fixup_t *fixup = &assembler->fixups[i];
+        fixup->defined = true;
+        fixup->target_section = symbol->section;
+        fixup->target = symbol->offset;
+        i = fixup->next;
+    }
+    symbol->fixups = symbol_no_fixup;
+    return nullptr;
+}
+
+// Marks the labels the directive names as global, wherever they are defined
+static error_t *assembler_global(assembler_t *assembler,
+                                 ast_node_t *global_directive) {
+    for (size_t i = 1; i < global_directive->len; ++i) {
+        symbol_t *symbol;
+        tokenlist_entry_t *name =
+            ast_node_child(global_directive, i)->token_entry;
+        error_t *err = symbols_get(assembler->symbols, name, &symbol);
+        if (err)
+            return err;
+        symbol->global = true;
+    }
+    return nullptr;
+}
+
+static relocation_kind_t assembler_relocation_kind(const encoding_t *encoding) {
+    if (encoding->label_relative)
+        return encoding->label_size == 1 ? RELOCATION_RELATIVE_8
+                                         : RELOCATION_RELATIVE_32;
+    if (encoding->label_size == 8)
+        return RELOCATION_ABSOLUTE_64;
+    return encoding->label_signed ? RELOCATION_ABSOLUTE_32S
+                                  : RELOCATION_ABSOLUTE_32;
+}
+
+// Records a fragment for the padding in front of a branch starting at offset,
+// or in front of the instruction it fuses with
+static error_t *assembler_boundary(assembler_t *assembler,
+                                   ast_node_t *instruction,
+                                   const encoding_t *encoding, size_t offset,
+                                   tokenlist_entry_t *fused) {
+    section_t *section = &assembler->sections[assembler->current];
+    size_t start = fused ? assembler->fusible_offset : offset;
+    return assembler_add_fragment(
+        section, (fragment_t){
+                     .kind = FRAGMENT_BOUNDARY,
+                     .position = start,
+                     .fill = -1,
+                     .span = offset + encoding->len - start,
+                     .token = ast_node_child(instruction, 0)->token_entry,
+                     .fused = fused,
+                 });
+}
+
+// Appends an encoded instruction to the current section
+static error_t *assembler_instruction(assembler_t *assembler,
+                                      ast_node_t *instruction,
+                                      const encoding_t *encoding) {
+    tokenlist_entry_t *fusible = assembler->fusible;
+    assembler->fusible = nullptr;
+
+    section_t *section = &assembler->sections[assembler->current];
+    error_t *err = assembler_reserve(section, encoding->len);
+    if (err)
+        return err;
+
+    size_t offset = section->len;
+    if (assembler->boundaries != BOUNDARIES_IGNORE &&
+        encoding->flow >= FLOW_CONDITIONAL) {
+        tokenlist_entry_t *fused =
+            encoding->flow == FLOW_CONDITIONAL ? fusible : nullptr;
+        err = assembler_boundary(assembler, instruction, encoding, offset,
+                                 fused);
+        if (err)
+            return err;
+    }
+    if (encoding->flow == FLOW_FUSIBLE) {
+        assembler->fusible = ast_node_child(instruction, 0)->token_entry;
+        assembler->fusible_offset = offset;
+    }
+
+    memcpy(section->code + offset, encoding->bytes, encoding->len);
+    section->len += encoding->len;
+    if (encoding->label == nullptr)
+        return nullptr;
+
+    if (encoding->long_opcode_length) {
+        fragment_t branch = {
+            .kind = FRAGMENT_BRANCH,
+            .position = offset,
+            .length = encoding->len,
+            .size = encoding->len,
+            .long_opcode_length = encoding->long_opcode_length,
+            .fixup = assembler->fixups_len,
+        };
+        memcpy(branch.long_opcode, encoding->long_opcode,
+               encoding->long_opcode_length);
+        err = assembler_add_fragment(section, branch);
+        if (err)
+            return err;
+    }
+
+    return assembler_reference(
+        assembler, encoding->label, encoding->label_minus,
+        encoding->label_addend, offset,
+        (fixup_t){
+            .section = assembler->current,
+            .position = offset + encoding->label_offset,
+            .origin = offset + encoding->len,
+            .kind = assembler_relocation_kind(encoding),
+        });
+}
+
+static uint64_t assembler_number(ast_node_t *number) {
+    return ast_node_child(number, 0)->value.integer.value;
+}
+
+// Reserves the most padding the alignment can need, assembler_relax cuts it
+// down once the final offset is known
+static error_t *assembler_align(assembler_t *assembler,
+                                ast_node_t *align_directive) {
+    uint64_t alignment = assembler_number(ast_node_child(align_directive, 1));
+    if (alignment == 0 || alignment > assembler_max_alignment ||
+        (alignment & (alignment - 1)) != 0)
+        return err_assembler_alignment;
+
+    section_t *section = &assembler->sections[assembler->current];
+    int fill = strcmp(section->name, assembler_code_section) == 0 ? -1 : 0;
+    if (align_directive->len > 2) {
+        uint64_t value = assembler_number(ast_node_child(align_directive, 3));
+        if (value > UINT8_MAX)
+            return err_assembler_fill;
+        fill = value;
+    }
+    if (alignment > section->alignment)
+        section->alignment = alignment;
+    if (alignment == 1)
+        return nullptr;
+
+    error_t *err = assembler_reserve(section, alignment - 1);
+    if (err)
+        return err;
+    size_t offset = section->len;
+    memset(section->code + offset, 0, alignment - 1);
+    section->len += alignment - 1;
+    return assembler_add_fragment(section, (fragment_t){
+                                               .kind = FRAGMENT_ALIGN,
+                                               .position = offset,
+                                               .length = alignment - 1,
+                                               .size = alignment - 1,
+                                               .alignment = alignment,
+                                               .fill = fill,
+                                           });
+}
+
+// Size in bytes of the values of .db, .dw, .dd and .dq
+static size_t assembler_data_width(ast_node_t *data) {
+    switch (data->token_entry->token.value[1]) {
+    case 'b':
+        return 1;
+    case 'w':
+        return 2;
+    case 'd':
+        return 4;
+    default:
+        return 8;
+    }
+}
+
+// Stores values little endian. Tables can be long, so on little endian
+// machines a whole chunk is narrowed in one loop the compiler can vectorize
+// and copied at once.
+static void assembler_store(uint8_t *code, const uint64_t *values,
+                            size_t count, size_t width) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    switch (width) {
+    case 1:
+        for (size_t i = 0; i < count; ++i)
+            code[i] = values[i];
+        break;
+    case 2: {
+        uint16_t narrowed[assembler_data_chunk];
+        for (size_t i = 0; i < count; ++i)
+            narrowed[i] = values[i];
+        memcpy(code, narrowed, count * width);
+        break;
+    }
+    case 4: {
+        uint32_t narrowed[assembler_data_chunk];
+        for (size_t i = 0; i < count; ++i)
+            narrowed[i] = values[i];
+        memcpy(code, narrowed, count * width);
+        break;
+    }
+    default:
+        memcpy(code, values, count * width);
+        break;
+    }
+#else
+    for (size_t i = 0; i < count; ++i)
+        for (size_t j = 0; j < width; ++j)
+            code[i * width + j] = values[i] >> (8 * j);
+#endif
+}
+
+static error_t *assembler_data(assembler_t *assembler,
+                               ast_node_t *data_directive) {
+    size_t width = assembler_data_width(ast_node_child(data_directive, 0));
+    size_t count = data_directive->len - 1;
+    uint64_t limit = width == 8 ? UINT64_MAX : (1ull << (8 * width)) - 1;
+    // Folded expressions can be negative, down to the lowest signed value
+    int64_t lowest = width == 8 ? INT64_MIN : -(int64_t)(limit / 2) - 1;
+
+    // Check every value first, so a directive that fails leaves no fixups
+    for (size_t i = 0; i < count; ++i) {
+        ast_node_t *value =
+            ast_node_child(ast_node_child(data_directive, i + 1), 0);
+        if (value->id == NODE_LABEL_REFERENCE && width < 4)
+            return err_assembler_data_label;
+        if (value->id != NODE_NUMBER)
+            continue;
+        uint64_t number = assembler_number(value);
+        if (number > limit &&
+            ((int64_t)number < lowest || (int64_t)number >= 0))
+            return err_assembler_data;
+    }
+
+    section_t *section = &assembler->sections[assembler->current];
+    error_t *err = assembler_reserve(section, count * width);
+    if (err)
+        return err;
+
+    size_t offset = section->len;
+    uint64_t values[assembler_data_chunk];
+    for (size_t i = 0; i < count; i += assembler_data_chunk) {
+        size_t len = count - i < assembler_data_chunk ? count - i
+                                                      : assembler_data_chunk;
+        for (size_t j = 0; j < len; ++j) {
+            ast_node_t *value =
+                ast_node_child(ast_node_child(data_directive, i + j + 1), 0);
+            if (value->id == NODE_NUMBER) {
+                values[j] = assembler_number(value);
+                continue;
+            }
+
+            // The address of the label, filled in like absolute references
+            // of instructions
+            values[j] = 0;
+            size_t position = offset + (i + j) * width;
+            err = assembler_reference(
+                assembler, value->token_entry, value->value.reference.minus,
+                value->value.reference.addend, offset,
+                (fixup_t){
+                    .section = assembler->current,
+                    .position = position,
+                    .origin = position + width,
+                    .kind = width == 8 ? RELOCATION_ABSOLUTE_64
+                                       : RELOCATION_ABSOLUTE_32,
+                });
+            if (err)
+                return err;
+        }
+        assembler_store(section->code + offset + i * width, values, len,
+                        width);
+    }
+    section->len += count * width;
+    return nullptr;
+}
+
+static error_t *assembler_add_blob(section_t *section, blob_t blob) {
+    if (section->blobs_len == section->blobs_cap) {
+        size_t new_cap = section->blobs_cap ? section->blobs_cap * 2
+                                            : assembler_default_blobs_cap;
+        blob_t *blobs = realloc(section->blobs, new_cap * sizeof(blob_t));
+        if (blobs == nullptr)
+            return err_allocation_failed;
+        section->blobs = blobs;
+        section->blobs_cap = new_cap;
+    }
+
+    section->blobs[section->blobs_len++] = blob;
+    return nullptr;
+}
+
+// Maps the file, it is only read when the section is written. The blob takes
+// a single byte of the code until assembler_relax gives it its size.
+static error_t *assembler_incbin(assembler_t *assembler,
+                                 ast_node_t *incbin_directive) {
+    const char *value =
+        ast_node_child(incbin_directive, 1)->token_entry->token.value;
+    char *path = malloc(strlen(value) + 1);
+    if (path == nullptr)
+        return err_allocation_failed;
+    size_t len;
+    bool valid = lexer_unescape(value, path, &len) &&
+                 memchr(path, '\0', len) == nullptr;
+    path[valid ? len : 0] = '\0';
+    int fd = valid ? open(path, O_RDONLY) : -1;
+    free(path);
+    if (fd < 0)
+        return err_assembler_incbin;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+        close(fd);
+        return err_assembler_incbin;
+    }
+    size_t size = info.st_size;
+    void *data = size ? mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0)
+                      : nullptr;
+    close(fd);
+    if (size == 0)
+        return nullptr;
+    if (data == MAP_FAILED)
+        return err_assembler_incbin;
+    posix_madvise(data, size, POSIX_MADV_SEQUENTIAL);
+
+    section_t *section = &assembler->sections[assembler->current];
+    error_t *err = assembler_add_blob(section, (blob_t){.data = data,
+                                                        .size = size});
+    if (err) {
+        munmap(data, size);
+        return err;
+    }
+    err = assembler_reserve(section, 1);
+    if (err)
+        return err;
+    size_t offset = section->len;
+    section->code[offset] = 0;
+    section->len += 1;
+    return assembler_add_fragment(section,
+                                  (fragment_t){
+                                      .kind = FRAGMENT_BLOB,
+                                      .position = offset,
+                                      .length = 1,
+                                      .size = 1,
+                                      .blob = section->blobs_len - 1,
+                                  });
+}
+
+static error_t *assembler_section(assembler_t *assembler,
+                                  ast_node_t *section_directive) {
+    const char *name =
+        ast_node_child(section_directive, 1)->token_entry->token.value;
+
+    for (size_t i = 0; i < assembler->sections_len; ++i) {
+        if (strcmp(assembler->sections[i].name, name) == 0) {
+            assembler->current = i;
+            return nullptr;
+        }
+    }
+    return assembler_add_section(assembler, name);
+}
+
+error_t *assembler_statement(assembler_t *assembler, ast_node_t *statement) {
+    switch (statement->id) {
+    case NODE_LABEL:
+        return assembler_label(assembler, statement);
+    case NODE_INSTRUCTION: {
+        encoded_t encoded = {};
+        encoded.err = encoder_encode_cached(statement, assembler->cache,
+                                            &encoded.encoding);
+        return assembler_encoded_statement(assembler, statement, &encoded);
+    }
+    case NODE_DIRECTIVE: {
+        assembler->fusible = nullptr;
+        ast_node_t *directive = ast_node_child(statement, 1);
+        switch (directive->id) {
+        case NODE_ALIGN_DIRECTIVE:
+            return assembler_align(assembler, directive);
+        case NODE_DATA_DIRECTIVE:
+            return assembler_data(assembler, directive);
+        case NODE_INCBIN_DIRECTIVE:
+            return assembler_incbin(assembler, directive);
+        case NODE_GLOBAL_DIRECTIVE:
+            return assembler_global(assembler, directive);
+        default:
+            return assembler_section(assembler, directive);
+        }
+    }
+    default:
+        return nullptr;
+    }
+}
+
+error_t *assembler_encoded_statement(assembler_t *assembler,
+                                     ast_node_t *statement,
+                                     const encoded_t *encoded) {
+    if (statement->id != NODE_INSTRUCTION)
+        return assembler_statement(assembler, statement);
+    if (encoded->err) {
+        // Whatever came before doesn't fuse with what comes after
+        assembler->fusible = nullptr;
+        return encoded->err;
+    }
+    return assembler_instruction(assembler, statement, &encoded->encoding);
+}
+
+typedef struct assembler_regions {
+    ast_node_t *program;
+    /* region i is the statements from starts[i] up to starts[i + 1] */
+    size_t *starts;
+    encoded_t *encoded;
+    /* one for every worker */
+    encoder_cache_t **caches;
+} assembler_regions_t;
+
+static void assembler_encode_region(void *context, size_t region,
+                                    size_t worker) {
+    assembler_regions_t *regions = context;
+    for (size_t i = regions->starts[region]; i < regions->starts[region + 1];
+         ++i) {
+        ast_node_t *statement = ast_node_child(regions->program, i);
+        if (statement->id != NODE_INSTRUCTION)
+            continue;
+        encoded_t *encoded = &regions->encoded[i];
+        encoded->err = encoder_encode_cached(
+            statement, regions->caches[worker], &encoded->encoding);
+    }
+}
+
+static void assembler_free_caches(encoder_cache_t **caches, size_t len) {
+    for (size_t i = 0; caches && i < len; ++i)
+        encoder_cache_free(caches[i]);
+    free(caches);
+}
+
+error_t *assembler_encode(assembler_t *assembler, pool_t *pool,
+                          ast_node_t *program, encoded_t **output) {
+    *output = nullptr;
+
+    // One spare entry keeps the allocations from being empty
+    encoded_t *encoded = calloc(program->len + 1, sizeof(encoded_t));
+    size_t *starts = malloc((program->len + 2) * sizeof(size_t));
+    encoder_cache_t **caches = calloc(pool->threads, sizeof(*caches));
+    error_t *err = encoded && starts && caches ? nullptr
+                                               : err_allocation_failed;
+    for (size_t i = 0; err == nullptr && i < pool->threads; ++i)
+        err = encoder_cache_alloc(&caches[i]);
+    if (err) {
+        free(encoded);
+        free(starts);
+        assembler_free_caches(caches, pool->threads);
+        return err;
+    }
+
+    size_t regions_len = 0;
+    for (size_t i = 0; i < program->len; ++i) {
+        ast_node_t *statement = ast_node_child(program, i);
+        if (i == 0 || statement->id == NODE_LABEL ||
+            statement->id == NODE_DIRECTIVE ||
+            i - starts[regions_len - 1] == assembler_max_region_statements)
+            starts[regions_len++] = i;
+    }
+    starts[regions_len] = program->len;
+
+    pool_run(pool, regions_len, assembler_encode_region,
+             &(assembler_regions_t){
+                 .program = program,
+                 .starts = starts,
+                 .encoded = encoded,
+                 .caches = caches,
+             });
+
+    for (size_t i = 0; i < pool->threads; ++i) {
+        assembler->cache->hits += caches[i]->hits;
+        assembler->cache->misses += caches[i]->misses;
+        assembler->cache->bypasses += caches[i]->bypasses;
+    }
+    assembler_free_caches(caches, pool->threads);
+    free(starts);
+    *output = encoded;
+    return nullptr;
+}
+
+// Bytes everything after the first count fragments of the section moved
+static int64_t assembler_growth(const section_t *section, size_t count) {
+    int64_t sum = 0;
+    for (size_t i = count; i > 0; i &= i - 1)
+        sum += section->growth[i];
+    return sum;
+}
+
+static void assembler_resize(section_t *section, size_t index, size_t size) {
+    fragment_t *fragment = &section->fragments[index];
+    int64_t growth = (int64_t)size - (int64_t)fragment->size;
+    fragment->size = size;
+    for (size_t i = index + 1; i <= section->fragments_len; i += i & -i)
+        section->growth[i] += growth;
+}
+
+// Where an offset ends up, behind the padding of the boundary and loop
+// fragments at the offset if behind is set
+static size_t assembler_map(const section_t *code, size_t offset,
+                            bool behind) {
+    if (code->growth == nullptr)
+        return offset;
+
+    // Only the fragments in front of the offset move it. Boundaries and loops
+    // come first among the fragments at the same position.
+    size_t low = 0, high = code->fragments_len;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        const fragment_t *fragment = &code->fragments[middle];
+        if (fragment->position < offset ||
+            (behind && fragment->position == offset && fragment->length == 0))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return offset + assembler_growth(code, low);
+}
+
+size_t assembler_offset(const assembler_t *assembler, size_t section,
+                        size_t offset) {
+    return assembler_map(&assembler->sections[section], offset, false);
+}
+
+size_t assembler_label_offset(const assembler_t *assembler, size_t section,
+                              size_t offset) {
+    return assembler_map(&assembler->sections[section], offset, true);
+}
+
+bool assembler_crosses_boundary(size_t start, size_t size) {
+    return start / assembler_branch_boundary !=
+           (start + size) / assembler_branch_boundary;
+}
+
+bool assembler_straddles_line(size_t start, size_t size) {
+    // Longer loops gain little from starting at a line
+    if (size == 0 || size > assembler_cache_line)
+        return false;
+    return start / assembler_cache_line !=
+           (start + size - 1) / assembler_cache_line;
+}
+
+static size_t assembler_long_branch(const fragment_t *branch) {
+    return branch->long_opcode_length + 4;
+}
+
+// The size of the code a boundary or loop fragment keeps together, with the
+// sizes the fragments in it have now
+static size_t assembler_span(const section_t *section, size_t index) {
+    const fragment_t *fragment = &section->fragments[index];
+    size_t end = fragment->position + fragment->span;
+    size_t low = index + 1, high = section->fragments_len;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (section->fragments[middle].position < end)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return fragment->span + assembler_growth(section, low) -
+           assembler_growth(section, index + 1);
+}
+
+static size_t assembler_boundary_padding(size_t start, size_t span) {
+    // Branches as long as the boundary cross one wherever they are
+    if (!assembler_crosses_boundary(start, span) ||
+        span >= assembler_branch_boundary)
+        return 0;
+    return -start & (assembler_branch_boundary - 1);
+}
+
+// Sizes the padding of every alignment, and of the boundaries and loops if
+// they are padded, for where the fragments in front of it end up. Returns
+// whether any changed.
+static bool assembler_size_padding(section_t *section, bool pad) {
+    bool changed = false;
+    for (size_t i = 0; i < section->fragments_len; ++i) {
+        fragment_t *fragment = &section->fragments[i];
+        int64_t start = fragment->position + assembler_growth(section, i);
+        size_t padding;
+        if (fragment->kind == FRAGMENT_ALIGN) {
+            padding = -start & (fragment->alignment - 1);
+        } else if (fragment->kind == FRAGMENT_BOUNDARY && pad) {
+            padding =
+                assembler_boundary_padding(start, assembler_span(section, i));
+        } else if (fragment->kind == FRAGMENT_LOOP && pad) {
+            // The span of a loop depends on the padding in it, which depends
+            // on where the loop starts. A loop that straddles a line once
+            // stays aligned to one, so the padding in it can't move it back
+            // and forth forever.
+            if (assembler_straddles_line(start, assembler_span(section, i)))
+                fragment->alignment = assembler_cache_line;
+            if (fragment->alignment == 0)
+                continue;
+            padding = -start & (fragment->alignment - 1);
+        } else {
+            continue;
+        }
+        if (padding != fragment->size) {
+            assembler_resize(section, i, padding);
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+// Sizes the fragments of a section. Growing a branch moves the code after
+// it, which can push other branches out of reach and changes the padding
+// after it, so repeat until nothing changes anymore. Branches only ever grow
+// and loops only ever become aligned, which is what makes this end. All
+// branches are checked against the same layout before any of them grows, so
+// no branch grows because of padding that was about to shrink.
+static error_t *assembler_size_fragments(assembler_t *assembler,
+                                         size_t section) {
+    section_t *code = &assembler->sections[section];
+    for (size_t i = 0; i < code->fragments_len; ++i) {
+        const fragment_t *fragment = &code->fragments[i];
+        if (fragment->kind == FRAGMENT_BLOB) {
+            assembler_resize(code, i, code->blobs[fragment->blob].size);
+            continue;
+        }
+        if (fragment->kind != FRAGMENT_BRANCH)
+            continue;
+        const fixup_t *fixup = &assembler->fixups[fragment->fixup];
+        if (!fixup->defined || fixup->target_section != section)
+            assembler_resize(code, i, assembler_long_branch(fragment));
+    }
+
+    size_t *grow = malloc(code->fragments_len * sizeof(size_t));
+    if (grow == nullptr)
+        return err_allocation_failed;
+
+    bool pad = assembler->boundaries == BOUNDARIES_PAD;
+    bool changed = true;
+    while (changed) {
+        changed = assembler_size_padding(code, pad);
+
+        size_t grow_len = 0;
+        for (size_t i = 0; i < code->fragments_len; ++i) {
+            const fragment_t *fragment = &code->fragments[i];
+            if (fragment->kind != FRAGMENT_BRANCH ||
+                fragment->size != fragment->length)
+                continue;
+            const fixup_t *fixup = &assembler->fixups[fragment->fixup];
+            int64_t end = fragment->position + assembler_growth(code, i) +
+                          fragment->length;
+            int64_t target =
+                assembler_label_offset(assembler, section, fixup->target) +
+                fixup->addend;
+            if (target - end < INT8_MIN || target - end > INT8_MAX)
+                grow[grow_len++] = i;
+        }
+        for (size_t i = 0; i < grow_len; ++i)
+            assembler_resize(code, grow[i],
+                             assembler_long_branch(&code->fragments[grow[i]]));
+        changed = changed || grow_len;
+    }
+
+    free(grow);
+    return nullptr;
+}
+
+// Copies the code to its final layout with every grown branch in its long
+// form and every padding, and points the fixups of the
+// branches at their final place. The blobs are left out of the code.
+static error_t *assembler_layout(assembler_t *assembler, size_t section) {
+    section_t *code = &assembler->sections[section];
+    if (code->fragments_len == 0)
+        return nullptr;
+    size_t len = code->len + assembler_growth(code, code->fragments_len);
+    size_t blobs = 0;
+    for (size_t i = 0; i < code->blobs_len; ++i)
+        blobs += code->blobs[i].size;
+    // Keep the allocation from being empty when all code was padding
+    uint8_t *relaxed = malloc(len - blobs + 1);
+    if (relaxed == nullptr)
+        return err_allocation_failed;
+
+    // to is the final offset, at is where it is in the code without the
+    // blobs in front of it
+    size_t from = 0, to = 0, at = 0;
+    for (size_t i = 0; i < code->fragments_len; ++i) {
+        const fragment_t *fragment = &code->fragments[i];
+        memcpy(relaxed + at, code->code + from, fragment->position - from);
+        to += fragment->position - from;
+        at += fragment->position - from;
+        from = fragment->position + fragment->length;
+
+        if (fragment->kind == FRAGMENT_BLOB) {
+            blob_t *blob = &code->blobs[fragment->blob];
+            blob->offset = to;
+            blob->before = to - at;
+            to += fragment->size;
+            continue;
+        }
+        if (fragment->kind != FRAGMENT_BRANCH) {
+            if (fragment->fill < 0)
+                encoder_nops(relaxed + at, fragment->size);
+            else
+                memset(relaxed + at, fragment->fill, fragment->size);
+            to += fragment->size;
+            at += fragment->size;
+            continue;
+        }
+
+        fixup_t *fixup = &assembler->fixups[fragment->fixup];
+        if (fragment->size != fragment->length) {
+            memcpy(relaxed + at, fragment->long_opcode,
+                   fragment->long_opcode_length);
+            // Labels that aren't defined leave the displacement to the
+            // relocation, so it has to be written here
+            memset(relaxed + at + fragment->long_opcode_length, 0, 4);
+            fixup->position = to + fragment->long_opcode_length;
+            fixup->kind = RELOCATION_RELATIVE_32;
+        } else {
+            memcpy(relaxed + at, code->code + fragment->position,
+                   fragment->length);
+            fixup->position = to + fragment->length - 1;
+        }
+        to += fragment->size;
+        at += fragment->size;
+        fixup->origin = to;
+    }
+    memcpy(relaxed + at, code->code + from, code->len - from);
+
+    free(code->code);
+    code->code = relaxed;
+    code->len = len;
+    code->cap = len - blobs + 1;
+    return nullptr;
+}
+
+// The first blob that ends behind the offset, blobs_len if there is none
+static size_t assembler_next_blob(const section_t *section, size_t offset) {
+    size_t low = 0, high = section->blobs_len;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        const blob_t *blob = &section->blobs[middle];
+        if (blob->offset + blob->size <= offset)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+// Where an offset outside of the blobs is in the code
+static size_t assembler_code_index(const section_t *section, size_t offset,
+                                   size_t next_blob) {
+    if (next_blob < section->blobs_len)
+        return offset - section->blobs[next_blob].before;
+    if (section->blobs_len == 0)
+        return offset;
+    const blob_t *last = &section->blobs[section->blobs_len - 1];
+    return offset - last->before - last->size;
+}
+
+const uint8_t *assembler_code(const section_t *section, size_t offset,
+                              size_t *len) {
+    size_t next = assembler_next_blob(section, offset);
+    if (next == section->blobs_len) {
+        *len = section->len - offset;
+        return section->code + assembler_code_index(section, offset, next);
+    }
+    const blob_t *blob = &section->blobs[next];
+    if (blob->offset <= offset) {
+        *len = blob->offset + blob->size - offset;
+        return blob->data + (offset - blob->offset);
+    }
+    *len = blob->offset - offset;
+    return section->code + assembler_code_index(section, offset, next);
+}
+
+static size_t assembler_fixup_size(relocation_kind_t kind) {
+    switch (kind) {
+    case RELOCATION_RELATIVE_8:
+        return 1;
+    case RELOCATION_ABSOLUTE_64:
+        return 8;
+    default:
+        return 4;
+    }
+}
+
+// Values are never in a blob, the code holds them
+static void assembler_patch(section_t *section, size_t position,
+                            uint64_t value, relocation_kind_t kind) {
+    uint8_t *code =
+        section->code + assembler_code_index(
+                            section, position,
+                            assembler_next_blob(section, position));
+    for (size_t i = 0; i < assembler_fixup_size(kind); ++i)
+        code[i] = value >> (8 * i);
+}
+
+// Whether the fixup is a difference of labels that can't be resolved, which
+// takes both labels defined in the same section
+static bool assembler_unresolvable(const assembler_t *assembler,
+                                   const fixup_t *fixup) {
+    if (fixup->minus == nullptr)
+        return false;
+    if (!fixup->defined)
+        return true;
+    if (fixup->minus_defined)
+        return fixup->minus_section != fixup->target_section;
+    const symbol_t *minus =
+        symbols_find(assembler->symbols, fixup->minus->token.value);
+    return minus == nullptr || !minus->defined ||
+           minus->section != fixup->target_section;
+}
+
+// Fills in the value of a reference to a defined label. Relative references
+// within a section and differences are final, everything else still needs
+// the linker.
+static error_t *assembler_resolve(assembler_t *assembler,
+                                  const fixup_t *fixup) {
+    section_t *section = &assembler->sections[fixup->section];
+    bool relative = fixup->kind == RELOCATION_RELATIVE_8 ||
+                    fixup->kind == RELOCATION_RELATIVE_32;
+    if (fixup->minus) {
+        // Unresolvable ones are reported by assembler_check
+        if (!assembler_unresolvable(assembler, fixup))
+            assembler_patch(section, fixup->position,
+                            fixup->target - fixup->minus_target +
+                                fixup->addend,
+                            fixup->kind);
+        return nullptr;
+    }
+    if (!relative) {
+        // Leave the offset in the code too, it's what a listing shows
+        assembler_patch(section, fixup->position,
+                        fixup->target + fixup->addend, fixup->kind);
+        bool dollar = fixup->token->token.id == TOKEN_DOLLAR;
+        return assembler_add_relocation(
+            section,
+            (relocation_t){.position = fixup->position,
+                           .kind = fixup->kind,
+                           .addend = dollar ? fixup->target + fixup->addend
+                                            : fixup->addend,
+                           .label = fixup->token,
+                           .section = fixup->target_section});
+    }
+
+    if (fixup->target_section == fixup->section) {
+        assembler_patch(section, fixup->position,
+                        fixup->target + fixup->addend - fixup->origin,
+                        fixup->kind);
+        return nullptr;
+    }
+    // The linker computes the label's address minus the position of the
+    // value, the end of the instruction is a few bytes further
+    return assembler_add_relocation(
+        section,
+        (relocation_t){.position = fixup->position,
+                       .kind = fixup->kind,
+                       .addend = (int64_t)fixup->position -
+                                 (int64_t)fixup->origin + fixup->addend,
+                       .label = fixup->token});
+}
+
+// The outermost loop at a label comes first
+static int assembler_compare_loops(const void *a, const void *b) {
+    const fragment_t *first = a, *second = b;
+    if (first->position != second->position)
+        return first->position < second->position ? -1 : 1;
+    return (first->span < second->span) - (first->span > second->span);
+}
+
+// Adds a loop fragment at every label a branch of the section jumps back to,
+// reaching to the end of the last branch back to it
+static error_t *assembler_add_loops(assembler_t *assembler, size_t section) {
+    section_t *code = &assembler->sections[section];
+    fragment_t *loops = malloc((code->fragments_len + 1) * sizeof(fragment_t));
+    if (loops == nullptr)
+        return err_allocation_failed;
+
+    size_t loops_len = 0;
+    for (size_t i = 0; i < code->fragments_len; ++i) {
+        const fragment_t *fragment = &code->fragments[i];
+        if (fragment->kind != FRAGMENT_BRANCH)
+            continue;
+        const fixup_t *fixup = &assembler->fixups[fragment->fixup];
+        if (!fixup->defined || fixup->target_section != section ||
+            fixup->target > fragment->position || fixup->addend != 0)
+            continue;
+        loops[loops_len++] = (fragment_t){
+            .kind = FRAGMENT_LOOP,
+            .position = fixup->target,
+            .fill = -1,
+            .span = fragment->position + fragment->length - fixup->target,
+            .token = fixup->token,
+        };
+    }
+    qsort(loops, loops_len, sizeof(fragment_t), assembler_compare_loops);
+    size_t unique = 0;
+    for (size_t i = 0; i < loops_len; ++i)
+        if (unique == 0 || loops[unique - 1].position != loops[i].position)
+            loops[unique++] = loops[i];
+
+    fragment_t *fragments =
+        malloc((code->fragments_len + unique + 1) * sizeof(fragment_t));
+    if (fragments == nullptr) {
+        free(loops);
+        return err_allocation_failed;
+    }
+    // Merge them in front of the other fragments at their label
+    size_t len = 0;
+    for (size_t i = 0, j = 0; i < code->fragments_len || j < unique;) {
+        if (j < unique && (i == code->fragments_len ||
+                           loops[j].position <= code->fragments[i].position))
+            fragments[len++] = loops[j++];
+        else
+            fragments[len++] = code->fragments[i++];
+    }
+
+    free(loops);
+    free(code->fragments);
+    code->fragments = fragments;
+    code->fragments_len = len;
+    code->fragments_cap = len + 1;
+    return nullptr;
+}
+
+error_t *assembler_relax(assembler_t *assembler) {
+    for (size_t i = 0; i < assembler->sections_len; ++i) {
+        section_t *section = &assembler->sections[i];
+        if (assembler->boundaries != BOUNDARIES_IGNORE &&
+            section->fragments_len) {
+            error_t *err = assembler_add_loops(assembler, i);
+            if (err)
+                return err;
+        }
+        if (section->fragments_len == 0)
+            continue;
+        section->growth =
+            calloc(section->fragments_len + 1, sizeof(int64_t));
+        if (section->growth == nullptr)
+            return err_allocation_failed;
+        error_t *err = assembler_size_fragments(assembler, i);
+        if (err)
+            return err;
+    }
+
+    // Move everything to its final offset while the code still has its
+    // assembled layout, the branches set their own fixups in the layout
+    for (size_t i = 0; i < assembler->symbols->cap; ++i) {
+        symbol_t *symbol = &assembler->symbols->entries[i];
+        if (symbol->name && symbol->defined)
+            symbol->offset = assembler_label_offset(assembler, symbol->section,
+                                                    symbol->offset);
+    }
+    for (size_t i = 0; i < assembler->fixups_len; ++i) {
+        fixup_t *fixup = &assembler->fixups[i];
+        fixup->position =
+            assembler_offset(assembler, fixup->section, fixup->position);
+        fixup->origin =
+            assembler_offset(assembler, fixup->section, fixup->origin);
+        if (fixup->defined)
+            fixup->target = assembler_label_offset(
+                assembler, fixup->target_section, fixup->target);
+        if (fixup->minus_defined)
+            fixup->minus_target = assembler_label_offset(
+                assembler, fixup->minus_section, fixup->minus_target);
+    }
+    for (size_t i = 0; i < assembler->sections_len; ++i) {
+        error_t *err = assembler_layout(assembler, i);
+        if (err)
+            return err;
+    }
+
+    for (size_t i = 0; i < assembler->fixups_len; ++i) {
+        fixup_t *fixup = &assembler->fixups[i];
+        // The labels of differences are looked up once they are final
+        const symbol_t *minus =
+            fixup->minus && !fixup->minus_defined
+                ? symbols_find(assembler->symbols, fixup->minus->token.value)
+                : nullptr;
+        if (minus && minus->defined) {
+            fixup->minus_defined = true;
+            fixup->minus_section = minus->section;
+            fixup->minus_target = minus->offset;
+        }
+        if (!fixup->defined)
+            continue;
+        error_t *err = assembler_resolve(assembler, fixup);
+        if (err)
+            return err;
+    }
+    return nullptr;
+}
+
+// Reports the differences that can't be resolved and the references to
+// undefined labels if they have to be defined
+static error_t *assembler_report(assembler_t *assembler,
+                                 diagnostics_t *diagnostics, bool undefined) {
+    // Report in the order the references appear, the fixups are in that order
+    for (size_t i = 0; i < assembler->fixups_len; ++i) {
+        fixup_t *fixup = &assembler->fixups[i];
+        const char *message = nullptr;
+        if (assembler_unresolvable(assembler, fixup))
+            message = err_assembler_difference->message;
+        else if (!fixup->defined && undefined)
+            message = err_assembler_undefined->message;
+        if (message == nullptr)
+            continue;
+        error_t *err = diagnostics_add(diagnostics, fixup->token, message);
+        if (err)
+            return err;
+    }
+    return nullptr;
+}
+
+error_t *assembler_check(assembler_t *assembler, diagnostics_t *diagnostics) {
+    return assembler_report(assembler, diagnostics, false);
+}
+
+error_t *assembler_finish(assembler_t *assembler, diagnostics_t *diagnostics) {
+    return assembler_report(assembler, diagnostics, true);
+}
@@ -0,0 +1,426 @@
+#ifndef INCLUDE_SRC_ASSEMBLER_H_
+#define INCLUDE_SRC_ASSEMBLER_H_
+
+#include "ast.h"
+#include "diagnostics.h"
+#include "encoder/encoder.h"
+#include "encoder/table.h"
+#include "error.h"
+#include "pool.h"
+#include "symbols.h"
+#include "tokenlist.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* The assembler turns statements into machine code in a single pass over the
+ * program. Every label reference is recorded as a fixup in a compact array.
+ * References to labels further down wait in a chain per label, defining the
+ * label tells every waiting fixup where the label is, so the program never
+ * has to be walked a second time.
+ *
+ * Branches to labels start out in their short form and alignments with the
+ * most padding they can need. Once the last statement is assembled,
+ * assembler_relax grows the branches that don't reach their label, sizes the
+ * padding of every alignment, lays out the final code and fills in the value
+ * of every fixup.
+ *
+ * Branches that cross or end on a 32 byte boundary are slow on Intel
+ * processors with the JCC erratum microcode update, loops that fit in a 64
+ * byte cache line but straddle two take twice the space in the decoded
+ * instruction cache. The assembler can record both for a report and pad them
+ * away from the boundaries with NOPs in front of them, sized together with
+ * the alignments.
+ *
+ * Encoding instructions doesn't depend on anything assembled before them, so
+ * repeated instructions come from a cache of encodings and assembler_encode
+ * can encode a whole program on a pool of threads up front.
+ * Statements are still assembled one by one in the order of the program, so
+ * the code is the same as without the pool.
+ *
+ * Files included with .incbin are mapped instead of read. Their contents never
+ * enter the code of the section, they are only read when the section is
+ * written out, see assembler_code.
+ *
+ * Every .section directive switches to its own section with its own code,
+ * statements before the first directive go to the text section. References
+ * that only the linker can resolve, because they are absolute or cross into
+ * another section, become relocations of the section. */
+
+typedef enum relocation_kind {
+    /* 1 byte offset relative to the end of a short branch, never a relocation
+     * because branches to other sections are never short */
+    RELOCATION_RELATIVE_8,
+    /* 4 byte offset relative to the end of the instruction */
+    RELOCATION_RELATIVE_32,
+    /* absolute address, zero extended from 4 bytes */
+    RELOCATION_ABSOLUTE_32,
+    /* absolute address, sign extended from 4 bytes */
+    RELOCATION_ABSOLUTE_32S,
+    RELOCATION_ABSOLUTE_64,
+} relocation_kind_t;
+
+typedef struct relocation {
+    /* where the value goes in the section's code */
+    size_t position;
+    relocation_kind_t kind;
+    /* added to the label's address */
+    int64_t addend;
+    tokenlist_entry_t *label;
+    /* $ is no symbol, references to it are relative to the start of this
+     * section instead */
+    size_t section;
+} relocation_t;
+
+typedef enum fragment_kind {
+    FRAGMENT_BRANCH,
+    FRAGMENT_ALIGN,
+    /* padding in front of a branch, or of the instruction it fuses with */
+    FRAGMENT_BOUNDARY,
+    /* padding in front of the label a loop starts at */
+    FRAGMENT_LOOP,
+    /* the contents of an included file, a single byte as assembled */
+    FRAGMENT_BLOB,
+} fragment_kind_t;
+
+/* Code whose size depends on where everything ends up. Boundary and loop
+ * fragments take no space in the assembled code, labels at their position
+ * end up behind their padding. */
+typedef struct fragment {
+    fragment_kind_t kind;
+    /* offset and size in the code as it was assembled */
+    size_t position;
+    size_t length;
+    /* the size in the final layout */
+    size_t size;
+    /* branches: the long form replacing the short opcode, see encoding_t, and
+     * the fixup of the branch's label */
+    uint8_t long_opcode_length;
+    uint8_t long_opcode[instruction_max_opcode];
+    size_t fixup;
+    /* alignments: a power of two and the byte to pad with, -1 for NOPs.
+     * Loops are aligned to a cache line once they are padded. */
+    size_t alignment;
+    int fill;
+    /* boundaries and loops: the size of the code behind the padding to keep
+     * together as it was assembled, and the mnemonic of the branch or the
+     * label of the loop. fused is the mnemonic of the instruction the branch
+     * fuses with, nullptr if none. */
+    size_t span;
+    tokenlist_entry_t *token;
+    tokenlist_entry_t *fused;
+    /* blobs: the index in the blobs of the section */
+    size_t blob;
+} fragment_t;
+
+/* The mapped contents of a file included with .incbin */
+typedef struct blob {
+    const uint8_t *data;
+    size_t size;
+    /* the final offset in the section and the bytes of the blobs in front of
+     * it, set by assembler_relax */
+    size_t offset;
+    size_t before;
+} blob_t;
+
+typedef struct section {
+    const char *name;
+    /* the machine code, as assembled until assembler_relax lays it out. len
+     * counts the contents of the blobs, code doesn't hold them. */
+    size_t len;
+    size_t cap;
+    uint8_t *code;
+    size_t blobs_len;
+    size_t blobs_cap;
+    blob_t *blobs;
+    size_t relocations_len;
+    size_t relocations_cap;
+    relocation_t *relocations;
+    /* fragments in the order they appear in the code */
+    size_t fragments_len;
+    size_t fragments_cap;
+    fragment_t *fragments;
+    /* Fenwick tree over the fragments holding how many bytes each fragment
+     * grew, negative for padding that shrank, so the number of bytes
+     * everything after a fragment moves is a logarithmic prefix sum.
+     * Allocated by assembler_relax. */
+    int64_t *growth;
+    /* the largest alignment of the section */
+    size_t alignment;
+} section_t;
+
+typedef struct fixup {
+    /* where the value goes in the code of the section */
+    size_t section;
+    size_t position;
+    /* relative values are the label's offset minus origin, which is the end
+     * of the instruction */
+    size_t origin;
+    relocation_kind_t kind;
+    /* the next fixup waiting for the same label, symbol_no_fixup if none */
+    size_t next;
+    tokenlist_entry_t *token;
+    /* where the label is, once it is defined */
+    bool defined;
+    size_t target_section;
+    size_t target;
+    /* added to the label's offset */
+    int64_t addend;
+    /* A difference of labels subtracts the offset of minus, nullptr if the
+     * reference is no difference. Where minus is is looked up once every
+     * label is defined, unless it is $. */
+    tokenlist_entry_t *minus;
+    bool minus_defined;
+    size_t minus_section;
+    size_t minus_target;
+} fixup_t;
+
+/* Branches should stay within these, short loops within a cache line */
+constexpr size_t assembler_branch_boundary = 32;
+constexpr size_t assembler_cache_line = 64;
+
+typedef enum boundaries {
+    /* leave branches and loops where they end up */
+    BOUNDARIES_IGNORE,
+    /* record branches and loops as fragments that are never padded */
+    BOUNDARIES_REPORT,
+    /* record and pad them */
+    BOUNDARIES_PAD,
+} boundaries_t;
+
+typedef struct assembler {
+    symbols_t *symbols;
+    /* encodings of earlier instructions, with the statistics of every
+     * instruction the assembler encoded */
+    encoder_cache_t *cache;
+    size_t fixups_len;
+    size_t fixups_cap;
+    fixup_t *fixups;
+    size_t sections_len;
+    size_t sections_cap;
+    section_t *sections;
+    /* index of the section statements are assembled into */
+    size_t current;
+    /* BOUNDARIES_IGNORE unless set before the first statement */
+    boundaries_t boundaries;
+    /* the mnemonic and offset of the last statement if it was an instruction
+     * a conditional branch fuses with, nullptr otherwise */
+    tokenlist_entry_t *fusible;
+    size_t fusible_offset;
+} assembler_t;
+
+/* An instruction encoded by assembler_encode */
+typedef struct encoded {
+    encoding_t encoding;
+    /* the error of encoder_encode, nullptr if it succeeded */
+    error_t *err;
+} encoded_t;
+
+extern error_t *err_assembler_redefined;
+extern error_t *err_assembler_undefined;
+extern error_t *err_assembler_difference;
+extern error_t *err_assembler_alignment;
+extern error_t *err_assembler_fill;
+extern error_t *err_assembler_data;
+extern error_t *err_assembler_data_label;
+extern error_t *err_assembler_incbin;
+
+/**
+ * @brief Allocate a new assembler with an empty text section and no symbols
+ *
+ * @param[out] output Pointer to the allocated assembler
+ * @return error_t* nullptr on success, allocation error on failure
+ */
+error_t *assembler_alloc(assembler_t **output);
+
+/**
+ * @brief Free the assembler and its sections
+ *
+ * If assembler is nullptr, the function returns without doing anything.
+ *
+ * @param assembler The assembler to free
+ */
+void assembler_free(assembler_t *assembler);
+
+/**
+ * @brief Empty the assembler to assemble another program
+ *
+ * Only the text section is left, without code. The buffers of the text
+ * section, the fixups and the symbols are kept, so do the cache of encodings
+ * and its statistics and the boundaries setting.
+ *
+ * @param assembler The assembler to reset
+ */
+void assembler_reset(assembler_t *assembler);
+
+/**
+ * @brief Assemble a statement
+ *
+ * Labels are defined at the current offset and resolve the fixups waiting for
+ * them, instructions are encoded and appended to the current section and
+ * section directives switch to their section. Alignment directives pad the
+ * current section to a multiple of their alignment with their fill byte, the
+ * text section is padded with NOPs and the others with zeros by default.
+ * Data directives append their values little endian, labels in .dd and .dq
+ * are referenced like in instructions. $ in an instruction or data directive
+ * is the offset it starts at. .incbin maps its file and .global marks the
+ * labels it names as symbols other objects can reference.
+ *
+ * @param assembler The assembler
+ * @param statement A statement node as produced by the parser
+ * @return error_t* nullptr on success, err_assembler_redefined for a label
+ *         that is already defined, an err_encoder_* error for an instruction
+ *         that can't be encoded, err_assembler_alignment or
+ *         err_assembler_fill for an invalid alignment directive,
+ *         err_assembler_data or err_assembler_data_label for a value that
+ *         doesn't fit, err_assembler_incbin for a file that can't be mapped,
+ *         allocation error on failure
+ */
+error_t *assembler_statement(assembler_t *assembler, ast_node_t *statement);
+
+/**
+ * @brief Encode every instruction of a program on a pool of threads
+ *
+ * Labels and section directives split the program into regions, usually a
+ * function each, and every region is a task of the pool. Regions longer than
+ * a few thousand statements are split further. Every worker has a cache of
+ * its own, their statistics are added to the cache of the assembler.
+ *
+ * @param assembler The assembler the program is assembled with next
+ * @param pool The pool to run the regions on
+ * @param program A NODE_PROGRAM node as produced by the parser
+ * @param[out] output An array with the encoding of every statement of the
+ *        program, left zero for statements that aren't instructions. Freed by
+ *        the caller.
+ * @return error_t* nullptr on success, allocation error on failure
+ */
+error_t *assembler_encode(assembler_t *assembler, pool_t *pool,
+                          ast_node_t *program, encoded_t **output);
+
+/**
+ * @brief Assemble a statement whose instruction assembler_encode encoded
+ *
+ * The same as assembler_statement, without encoding the instruction again.
+ *
+ * @param assembler The assembler
+ * @param statement A statement node as produced by the parser
+ * @param encoded The encoding of the statement from assembler_encode
+ * @return error_t* see assembler_statement
+ */
+error_t *assembler_encoded_statement(assembler_t *assembler,
+                                     ast_node_t *statement,
+                                     const encoded_t *encoded);
+
+/**
+ * @brief Lay out the final code after the last statement
+ *
+ * Grows every branch whose label is out of reach of the short form and sizes
+ * the padding of the alignments until all of them fit, moves the code and
+ * labels to their final offsets, fills in the values of the label references
+ * and records relocations for the ones only the linker can resolve.
+ *
+ * Unless boundaries are ignored, every label a branch jumps back to becomes
+ * the head of a loop fragment that reaches to the end of the last branch
+ * back. Padding them moves a branch, or the pair of instructions it fuses
+ * into, that crosses or ends on a 32 byte boundary to the start of the next
+ * 32 bytes when it is shorter than that. A loop that fits in a cache line
+ * but straddles two moves to the start of the next one and stays aligned
+ * to a cache line while the fragments are sized, which keeps the sizing
+ * finite.
+ *
+ * @param assembler The assembler, after the last statement
+ * @return error_t* nullptr on success, allocation error on failure
+ */
+error_t *assembler_relax(assembler_t *assembler);
+
+/**
+ * @brief Where an offset of the code as it was assembled ends up after
+ *        assembler_relax
+ *
+ * @param assembler The assembler, after assembler_relax
+ * @param section Index of the section
+ * @param offset Offset in the section before relaxation
+ * @return size_t The final offset
+ */
+size_t assembler_offset(const assembler_t *assembler, size_t section,
+                        size_t offset);
+
+/**
+ * @brief Where a label defined at an offset of the code as it was assembled
+ *        ends up after assembler_relax
+ *
+ * Unlike assembler_offset, this is behind the padding of boundary and loop
+ * fragments at the offset: a label names the code that starts there, not
+ * the padding in front of it.
+ *
+ * @param assembler The assembler, after assembler_relax
+ * @param section Index of the section
+ * @param offset Offset of the label in the section before relaxation
+ * @return size_t The final offset
+ */
+size_t assembler_label_offset(const assembler_t *assembler, size_t section,
+                              size_t offset);
+
+/**
+ * @brief The final code of a section from an offset on
+ *
+ * The code is split at the blobs, so the bytes are either in the code of the
+ * section or in the mapping of an included file.
+ *
+ * @param section The section, after assembler_relax
+ * @param offset Final offset in the section, below its len
+ * @param[out] len How many bytes from the offset are in one piece, up to the
+ *        next blob, the end of the blob or the end of the section
+ * @return const uint8_t* The byte at the offset
+ */
+const uint8_t *assembler_code(const section_t *section, size_t offset,
+                              size_t *len);
+
+/**
+ * @brief Whether code crosses or ends on a multiple of
+ *        assembler_branch_boundary
+ *
+ * @param start Offset of the code
+ * @param size Size of the code
+ * @return bool true if a branch there is slowed down by the JCC erratum
+ */
+bool assembler_crosses_boundary(size_t start, size_t size);
+
+/**
+ * @brief Whether code that fits in a cache line straddles two
+ *
+ * @param start Offset of the code
+ * @param size Size of the code
+ * @return bool true if the code is at most assembler_cache_line bytes but
+ *         crosses a multiple of it
+ */
+bool assembler_straddles_line(size_t start, size_t size);
+
+/**
+ * @brief Report every difference of labels that can't be resolved
+ *
+ * A difference takes both labels defined in the same section, a linker can't
+ * compute it either.
+ *
+ * @param assembler The assembler, after the last statement
+ * @param diagnostics Receives an err_assembler_difference diagnostic for
+ *        every such difference
+ * @return error_t* nullptr on success, err_diagnostics_limit or allocation
+ *         error from adding the diagnostics
+ */
+error_t *assembler_check(assembler_t *assembler, diagnostics_t *diagnostics);
+
+/**
+ * @brief Report every label reference whose label was never defined
+ *
+ * Only needed when the code is used as is. In an object file these refer to
+ * symbols of other objects. Reports what assembler_check does as well.
+ *
+ * @param assembler The assembler, after the last statement
+ * @param diagnostics Receives an err_assembler_undefined diagnostic for every
+ *        unresolved reference and err_assembler_difference for differences
+ * @return error_t* nullptr on success, err_diagnostics_limit or allocation
+ *         error from adding the diagnostics
+ */
+error_t *assembler_finish(assembler_t *assembler, diagnostics_t *diagnostics);
+
+#endif // INCLUDE_SRC_ASSEMBLER_H_
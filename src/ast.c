@@ -3,8 +3,8 @@
 #include <assert.h>
 #include <string.h>
 
-error_t *err_node_children_cap = &(error_t){
-    .message = "Failed to increase ast node children, max capacity reached"};
+error_t *err_ast_walk_skip =
+    &(error_t){.message = "Skip the children of the current ast node"};
 
 error_t *ast_node_alloc(ast_node_t **output) {
     *output = nullptr;
@@ -21,19 +21,39 @@ void ast_node_free_value(ast_node_t *node) {
     // TODO: decide how value ownership will work and clean it up here
 }
 
-void ast_node_free(ast_node_t *node) {
-    if (node == nullptr)
-        return;
-    if (node->children) {
-        for (size_t i = 0; i < node->len; ++i)
-            ast_node_free(node->children[i]);
+static error_t *ast_node_free_visit(ast_node_t *node, size_t depth,
+                                    void *data) {
+    (void)depth;
+    (void)data;
+    if (node->segments) {
+        for (size_t i = 0; i < node_max_child_segments && node->segments[i];
+             ++i)
+            free(node->segments[i]);
+        free(node->segments);
+    } else {
         free(node->children);
     }
-
     ast_node_free_value(node);
 
     memset(node, 0, sizeof(ast_node_t));
     free(node);
+    return nullptr;
+}
+
+static error_t *ast_node_release_visit(ast_node_t *node, size_t depth,
+                                       void *data) {
+    (void)depth;
+    (void)data;
+    if (node->shared_count == 0)
+        return nullptr;
+    node->shared_count -= 1;
+    return err_ast_walk_skip;
+}
+
+void ast_node_free(ast_node_t *node) {
+    // The walk can only fail if its stack can't grow, in that case whatever
+    // hasn't been visited yet is leaked instead of freed recursively.
+    ast_node_walk(node, ast_node_release_visit, ast_node_free_visit, nullptr);
 }
 
 /**
@@ -48,25 +68,29 @@ error_t *ast_node_alloc_children(ast_node_t *node) {
     return nullptr;
 }
 
+/**
+ * @pre node->children must be allocated and full
+ */
 error_t *ast_node_grow_cap(ast_node_t *node) {
-    if (node->cap >= node_max_children_cap) {
-        return err_node_children_cap;
+    if (node->segments == nullptr) {
+        node->segments = calloc(node_max_child_segments, sizeof(ast_node_t **));
+        if (node->segments == nullptr)
+            return err_allocation_failed;
+        node->segments[0] = node->children;
     }
 
-    size_t new_cap = node->cap * 2;
-    if (new_cap > node_max_children_cap) {
-        new_cap = node_max_children_cap;
-    }
+    // Segment n holds node_default_children_cap << n children
+    size_t segment = 1;
+    while (node->segments[segment])
+        segment++;
+    assert(segment < node_max_child_segments);
 
-    ast_node_t **new_children =
-        realloc(node->children, new_cap * sizeof(ast_node_t *));
-    if (new_children == nullptr) {
+    size_t size = node_default_children_cap << segment;
+    node->segments[segment] = calloc(size, sizeof(ast_node_t *));
+    if (node->segments[segment] == nullptr)
         return err_allocation_failed;
-    }
-
-    node->children = new_children;
-    node->cap = new_cap;
 
+    node->cap += size;
     return nullptr;
 }
 
@@ -79,12 +103,26 @@ error_t *ast_node_add_child(ast_node_t *node, ast_node_t *child) {
     if (err)
         return err;
 
-    node->children[node->len] = child;
+    *ast_node_child_slot(node, node->len) = child;
     node->len += 1;
 
     return nullptr;
 }
 
+error_t *ast_node_move_children(ast_node_t *node, ast_node_t *from) {
+    error_t *err = nullptr;
+    for (size_t i = 0; i < from->len; ++i) {
+        ast_node_t *child = ast_node_child(from, i);
+        if (err == nullptr)
+            err = ast_node_add_child(node, child);
+        if (err)
+            ast_node_free(child);
+    }
+
+    from->len = 0;
+    return err;
+}
+
 const char *ast_node_id_to_cstr(node_id_t id) {
     switch (id) {
     case NODE_INVALID:
@@ -123,10 +161,40 @@ const char *ast_node_id_to_cstr(node_id_t id) {
         return "NODE_PLUS_OR_MINUS";
     case NODE_SECTION_DIRECTIVE:
         return "NODE_SECTION_DIRECTIVE";
+    case NODE_ALIGN_DIRECTIVE:
+        return "NODE_ALIGN_DIRECTIVE";
+    case NODE_DATA_DIRECTIVE:
+        return "NODE_DATA_DIRECTIVE";
+    case NODE_INCBIN_DIRECTIVE:
+        return "NODE_INCBIN_DIRECTIVE";
+    case NODE_GLOBAL_DIRECTIVE:
+        return "NODE_GLOBAL_DIRECTIVE";
+    case NODE_EXPRESSION:
+        return "NODE_EXPRESSION";
+    case NODE_OPERATION:
+        return "NODE_OPERATION";
+    case NODE_OPERATOR:
+        return "NODE_OPERATOR";
+    case NODE_TERM:
+        return "NODE_TERM";
+    case NODE_UNARY:
+        return "NODE_UNARY";
+    case NODE_UNARY_OPERATOR:
+        return "NODE_UNARY_OPERATOR";
+    case NODE_PARENTHESIZED:
+        return "NODE_PARENTHESIZED";
     case NODE_REGISTER:
         return "NODE_REGISTER";
     case NODE_SECTION:
         return "NODE_SECTION";
+    case NODE_ALIGN:
+        return "NODE_ALIGN";
+    case NODE_DATA:
+        return "NODE_DATA";
+    case NODE_INCBIN:
+        return "NODE_INCBIN";
+    case NODE_GLOBAL:
+        return "NODE_GLOBAL";
     case NODE_IDENTIFIER:
         return "NODE_IDENTIFIER";
     case NODE_DECIMAL:
@@ -157,17 +225,117 @@ const char *ast_node_id_to_cstr(node_id_t id) {
         return "NODE_ASTERISK";
     case NODE_DOT:
         return "NODE_DOT";
+    case NODE_SLASH:
+        return "NODE_SLASH";
+    case NODE_SHIFT_LEFT:
+        return "NODE_SHIFT_LEFT";
+    case NODE_SHIFT_RIGHT:
+        return "NODE_SHIFT_RIGHT";
+    case NODE_AMPERSAND:
+        return "NODE_AMPERSAND";
+    case NODE_PIPE:
+        return "NODE_PIPE";
+    case NODE_TILDE:
+        return "NODE_TILDE";
+    case NODE_LPAREN:
+        return "NODE_LPAREN";
+    case NODE_RPAREN:
+        return "NODE_RPAREN";
+    case NODE_DOLLAR:
+        return "NODE_DOLLAR";
     }
     assert(!"Unreachable, weird node id" && id);
     __builtin_unreachable();
 }
 
-static void ast_node_print_internal(ast_node_t *node, int indent) {
-    if (node == NULL) {
-        return;
+typedef struct ast_walk_frame {
+    ast_node_t *node;
+    size_t next_child;
+} ast_walk_frame_t;
+
+constexpr size_t ast_walk_inline_depth = 32;
+
+typedef struct ast_walk_stack {
+    size_t len;
+    size_t cap;
+    ast_walk_frame_t *frames;
+    ast_walk_frame_t inline_frames[ast_walk_inline_depth];
+} ast_walk_stack_t;
+
+static error_t *ast_walk_stack_push(ast_walk_stack_t *stack, ast_node_t *node) {
+    if (stack->len == stack->cap) {
+        size_t new_cap = stack->cap * 2;
+        ast_walk_frame_t *frames;
+        if (stack->frames == stack->inline_frames) {
+            frames = malloc(new_cap * sizeof(ast_walk_frame_t));
+            if (frames)
+                memcpy(frames, stack->inline_frames,
+                       stack->len * sizeof(ast_walk_frame_t));
+        } else {
+            frames = realloc(stack->frames, new_cap * sizeof(ast_walk_frame_t));
+        }
+        if (frames == nullptr)
+            return err_allocation_failed;
+        stack->frames = frames;
+        stack->cap = new_cap;
+    }
+
+    stack->frames[stack->len] = (ast_walk_frame_t){.node = node};
+    stack->len += 1;
+    return nullptr;
+}
+
+/**
+ * Pushes the node onto the walk stack and runs the pre-order visitor on it.
+ * Nodes for which the visitor returns err_ast_walk_skip are never pushed.
+ */
+static error_t *ast_walk_enter(ast_walk_stack_t *stack, ast_node_t *node,
+                               ast_visitor_t pre, void *data) {
+    if (pre) {
+        error_t *err = pre(node, stack->len, data);
+        if (err == err_ast_walk_skip)
+            return nullptr;
+        if (err)
+            return err;
     }
+    return ast_walk_stack_push(stack, node);
+}
+
+error_t *ast_node_walk(ast_node_t *node, ast_visitor_t pre, ast_visitor_t post,
+                       void *data) {
+    if (node == nullptr)
+        return nullptr;
 
-    for (int i = 0; i < indent; i++) {
+    ast_walk_stack_t stack = {.cap = ast_walk_inline_depth};
+    stack.frames = stack.inline_frames;
+
+    error_t *err = ast_walk_enter(&stack, node, pre, data);
+    while (err == nullptr && stack.len > 0) {
+        ast_walk_frame_t *frame = &stack.frames[stack.len - 1];
+        ast_node_t *current = frame->node;
+
+        if (frame->next_child < current->len) {
+            ast_node_t *child = ast_node_child(current, frame->next_child);
+            frame->next_child += 1;
+            if (child)
+                err = ast_walk_enter(&stack, child, pre, data);
+            continue;
+        }
+
+        stack.len -= 1;
+        if (post)
+            err = post(current, stack.len, data);
+    }
+
+    if (stack.frames != stack.inline_frames)
+        free(stack.frames);
+    return err;
+}
+
+static error_t *ast_node_print_visit(ast_node_t *node, size_t depth,
+                                     void *data) {
+    (void)data;
+    for (size_t i = 0; i < depth; i++) {
         printf("  ");
     }
     printf("%s", ast_node_id_to_cstr(node->id));
@@ -176,12 +344,9 @@ static void ast_node_print_internal(ast_node_t *node, int indent) {
         printf(" \"%s\"", node->token_entry->token.value);
     }
     printf("\n");
-
-    for (size_t i = 0; i < node->len; i++) {
-        ast_node_print_internal(node->children[i], indent + 1);
-    }
+    return nullptr;
 }
 
 void ast_node_print(ast_node_t *node) {
-    ast_node_print_internal(node, 0);
+    ast_node_walk(node, ast_node_print_visit, nullptr, nullptr);
 }
@@ -27,10 +27,25 @@ typedef enum node_id {
     NODE_REGISTER_OFFSET,
     NODE_PLUS_OR_MINUS,
     NODE_SECTION_DIRECTIVE,
+    NODE_ALIGN_DIRECTIVE,
+    NODE_DATA_DIRECTIVE,
+    NODE_INCBIN_DIRECTIVE,
+    NODE_GLOBAL_DIRECTIVE,
+    NODE_EXPRESSION,
+    NODE_OPERATION,
+    NODE_OPERATOR,
+    NODE_TERM,
+    NODE_UNARY,
+    NODE_UNARY_OPERATOR,
+    NODE_PARENTHESIZED,
 
     // Validated primitives
     NODE_REGISTER,
     NODE_SECTION,
+    NODE_ALIGN,
+    NODE_DATA,
+    NODE_INCBIN,
+    NODE_GLOBAL,
 
     // Primitive nodes
     NODE_IDENTIFIER,
@@ -48,30 +63,79 @@ typedef enum node_id {
     NODE_MINUS,
     NODE_ASTERISK,
     NODE_DOT,
+    NODE_SLASH,
+    NODE_SHIFT_LEFT,
+    NODE_SHIFT_RIGHT,
+    NODE_AMPERSAND,
+    NODE_PIPE,
+    NODE_TILDE,
+    NODE_LPAREN,
+    NODE_RPAREN,
+    NODE_DOLLAR,
 } node_id_t;
 
 typedef struct ast_node ast_node_t;
 
 constexpr size_t node_default_children_cap = 8;
-/* 65K ought to be enough for anybody */
-constexpr size_t node_max_children_cap = 1 << 16;
+/* Children are stored in segments that double in size, the first segment holds
+ * node_default_children_cap children. Growing a node never moves the children
+ * it already has and 48 segments are more than can ever be addressed. */
+constexpr size_t node_max_child_segments = 48;
 
 struct ast_node {
     node_id_t id;
+    /* Number of owners beyond the first, see ast_node_share */
+    uint32_t shared_count;
     tokenlist_entry_t *token_entry;
     size_t len;
     size_t cap;
     ast_node_t **children;
+    ast_node_t ***segments;
 
     union {
+        /* number nodes: the value and the size suffix in bits, 0 without */
         struct {
             uint64_t value;
             int size;
         } integer;
+        /* label references: the label subtracted from the referenced one or
+         * nullptr and the number added, set when an expression is folded */
+        struct {
+            tokenlist_entry_t *minus;
+            int64_t addend;
+        } reference;
         char *name;
     } value;
 };
 
+/**
+ * @brief Returns the storage slot of the child at the given index
+ *
+ * The first node_default_children_cap children live in node->children, any
+ * further children live in node->segments.
+ *
+ * @pre index < node->cap
+ */
+static inline ast_node_t **ast_node_child_slot(const ast_node_t *node,
+                                               size_t index) {
+    if (index < node_default_children_cap)
+        return &node->children[index];
+    size_t segment =
+        63 - __builtin_clzll(index / node_default_children_cap + 1);
+    size_t start = node_default_children_cap * ((1ull << segment) - 1);
+    return &node->segments[segment][index - start];
+}
+
+/**
+ * @brief Returns the child at the given index
+ *
+ * @pre index < node->len
+ */
+static inline ast_node_t *ast_node_child(const ast_node_t *node,
+                                         size_t index) {
+    return *ast_node_child_slot(node, index);
+}
+
 /**
  * @brief Allocates a new AST node
  *
@@ -83,29 +147,92 @@ struct ast_node {
 error_t *ast_node_alloc(ast_node_t **node);
 
 /**
- * @brief Frees an AST node and all its children recursively
+ * @brief Frees an AST node and all its children
  *
- * Recursively frees all children of the node, then frees the node itself.
+ * Frees all children of the node, then frees the node itself. Uses
+ * ast_node_walk so arbitrarily deep trees are freed without recursion. Shared
+ * nodes only lose an owner and are left alone until their last owner frees
+ * them.
  * If node is nullptr, the function returns without doing anything.
  *
  * @param node The node to free
  */
 void ast_node_free(ast_node_t *node);
 
+/**
+ * @brief Adds an owner to a node
+ *
+ * Shared nodes are only freed once ast_node_free has been called for every
+ * owner. Shared nodes must be treated as immutable since every owner sees
+ * changes to them.
+ *
+ * @param node The node to share
+ * @return ast_node_t* The node itself, for convenience
+ */
+static inline ast_node_t *ast_node_share(ast_node_t *node) {
+    node->shared_count += 1;
+    return node;
+}
+
 /**
  * @brief Adds a child node to a parent node
  *
- * Adds the specified child node to the parent's children array.
- * If this is the first child, the function allocates the children array.
- * If the children array is full, the function increases its capacity.
+ * Adds the specified child node to the parent's children.
+ * If this is the first child, the function allocates the first segment.
+ * If all segments are full, the function allocates a new segment twice the
+ * size of the last one, existing children are never copied.
  *
  * @param node The parent node to add the child to
  * @param child The child node to add
- * @return error_t* nullptr on success, allocation error on failure,
- *                  or err_node_children_cap if maximum capacity is reached
+ * @return error_t* nullptr on success, allocation error on failure
  */
 error_t *ast_node_add_child(ast_node_t *node, ast_node_t *child);
 
+/**
+ * @brief Moves all children of one node to the end of another
+ *
+ * The source node is left without children. On failure the children that
+ * couldn't be moved are freed.
+ *
+ * @param node The node receiving the children
+ * @param from The node to take the children from
+ * @return error_t* nullptr on success, allocation error on failure
+ */
+error_t *ast_node_move_children(ast_node_t *node, ast_node_t *from);
+
+/**
+ * @brief Visitor callback used by ast_node_walk
+ *
+ * @param node The node being visited
+ * @param depth Distance from the root of the walk, the root has depth 0
+ * @param data User data passed through unchanged from ast_node_walk
+ * @return error_t* nullptr to continue, err_ast_walk_skip from a pre-order
+ *                  visitor to skip the node's children and post-order visit,
+ *                  any other error aborts the walk
+ */
+typedef error_t *(*ast_visitor_t)(ast_node_t *node, size_t depth, void *data);
+
+extern error_t *err_ast_walk_skip;
+
+/**
+ * @brief Walks an AST depth first without recursion
+ *
+ * Uses an explicit stack so deeply nested trees can't overflow the call
+ * stack. The pre-order visitor is called before a node's children are
+ * visited, the post-order visitor after all of them have been. A post-order
+ * visitor may free the node it is given, the walk does not touch a node again
+ * after its post-order visit. Either visitor may be nullptr.
+ *
+ * @param node The root node of the walk, nullptr walks nothing
+ * @param pre Pre-order visitor
+ * @param post Post-order visitor
+ * @param data User data passed to both visitors
+ * @return error_t* nullptr on success, the first error returned by a visitor
+ *                  or an allocation error if the traversal stack can't grow
+ */
+error_t *ast_node_walk(ast_node_t *node, ast_visitor_t pre, ast_visitor_t post,
+                       void *data);
+
 /**
  * @brief Prints an AST starting from the given node
  *
@@ -0,0 +1,323 @@
+#include "cfg.h"
+#include "ast.h"
+#include "error.h"
+#include "tokenlist.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* Control doesn't continue behind these */
+static const char *cfg_terminators[] = {"jmp", "ret", "ud2"};
+
+static const char *cfg_mnemonic(ast_node_t *statement) {
+    return ast_node_child(statement, 0)->token_entry->token.value;
+}
+
+static bool cfg_terminates(const char *mnemonic) {
+    for (size_t i = 0;
+         i < sizeof(cfg_terminators) / sizeof(cfg_terminators[0]); ++i)
+        if (strcmp(cfg_terminators[i], mnemonic) == 0)
+            return true;
+    return false;
+}
+
+// Whether the instruction ends its block: jumps, branches, calls and returns
+static bool cfg_transfers(const char *mnemonic) {
+    return mnemonic[0] == 'j' || strcmp(mnemonic, "call") == 0 ||
+           cfg_terminates(mnemonic);
+}
+
+// The operand a jump, branch or call goes to directly, nullptr for any other
+// instruction or an indirect one
+static ast_node_t *cfg_direct_target(ast_node_t *instruction) {
+    const char *mnemonic = cfg_mnemonic(instruction);
+    if (mnemonic[0] != 'j' && strcmp(mnemonic, "call") != 0)
+        return nullptr;
+    ast_node_t *operands = ast_node_child(instruction, 1);
+    if (operands->len != 1 ||
+        ast_node_child(operands, 0)->id != NODE_IMMEDIATE)
+        return nullptr;
+    return ast_node_child(ast_node_child(operands, 0), 0);
+}
+
+// Whether the target is the start of a label, which is an edge of the graph
+static bool cfg_exact_target(ast_node_t *target) {
+    return target->id == NODE_LABEL_REFERENCE && target->len == 0;
+}
+
+// The block a label reference names, SIZE_MAX if no label of the program has
+// the name
+static size_t cfg_target_block(const cfg_t *cfg, ast_node_t *reference) {
+    const symbol_t *symbol =
+        symbols_find(cfg->labels, reference->token_entry->token.value);
+    return symbol && symbol->defined ? symbol->offset : SIZE_MAX;
+}
+
+// The first block a target that isn't the start of a label could be in, for
+// the jump at the end of block: the block of the label or of the jump for $
+// plus a number that isn't negative, the first block for anything else.
+// SIZE_MAX if it names a label outside of the program.
+static size_t cfg_unknown_from(const cfg_t *cfg, ast_node_t *target,
+                               size_t block) {
+    if (target->id != NODE_LABEL_REFERENCE || target->value.reference.minus ||
+        target->value.reference.addend < 0)
+        return 0;
+    if (target->token_entry->token.id == TOKEN_DOLLAR)
+        return block;
+    return cfg_target_block(cfg, target);
+}
+
+static bool cfg_global(ast_node_t *statement) {
+    return statement->id == NODE_DIRECTIVE &&
+           ast_node_child(statement, 1)->id == NODE_GLOBAL_DIRECTIVE;
+}
+
+// Every directive but .global is a block of its own
+static bool cfg_block_directive(ast_node_t *statement) {
+    return statement->id == NODE_DIRECTIVE && !cfg_global(statement);
+}
+
+// Every statement that is a block of its own or ends one
+static bool cfg_ends_block(ast_node_t *statement) {
+    return cfg_block_directive(statement) ||
+           (statement->id == NODE_INSTRUCTION &&
+            cfg_transfers(cfg_mnemonic(statement)));
+}
+
+// Marks the labels .global names, which may come before or after them
+static error_t *cfg_mark_globals(cfg_t *cfg, ast_node_t *program) {
+    for (size_t i = 0; i < program->len; ++i) {
+        ast_node_t *statement = ast_node_child(program, i);
+        if (!cfg_global(statement))
+            continue;
+        ast_node_t *directive = ast_node_child(statement, 1);
+        for (size_t j = 1; j < directive->len; ++j) {
+            symbol_t *symbol;
+            error_t *err = symbols_get(
+                cfg->labels, ast_node_child(directive, j)->token_entry,
+                &symbol);
+            if (err)
+                return err;
+            symbol->global = true;
+        }
+    }
+    return nullptr;
+}
+
+// Splits the program into blocks and maps every label to its block
+static error_t *cfg_split(cfg_t *cfg, ast_node_t *program) {
+    size_t count = 0;
+    for (size_t i = 0; i < program->len; ++i) {
+        ast_node_t *statement = ast_node_child(program, i);
+        bool after_end = i && cfg_ends_block(ast_node_child(program, i - 1));
+        if (i == 0 || after_end || statement->id == NODE_LABEL ||
+            cfg_block_directive(statement))
+            count += 1;
+    }
+    cfg->blocks = calloc(count + 1, sizeof(cfg_block_t));
+    if (cfg->blocks == nullptr)
+        return err_allocation_failed;
+
+    for (size_t i = 0; i < program->len; ++i) {
+        ast_node_t *statement = ast_node_child(program, i);
+        bool after_end = i && cfg_ends_block(ast_node_child(program, i - 1));
+        if (i == 0 || after_end || statement->id == NODE_LABEL ||
+            cfg_block_directive(statement)) {
+            if (cfg->blocks_len)
+                cfg->blocks[cfg->blocks_len - 1].end = i;
+            cfg->blocks[cfg->blocks_len++] = (cfg_block_t){
+                .first = i,
+                .unknown_from = SIZE_MAX,
+                .root = i == 0 || cfg_block_directive(statement),
+            };
+        }
+        if (statement->id != NODE_LABEL)
+            continue;
+
+        symbol_t *symbol;
+        tokenlist_entry_t *name = ast_node_child(statement, 0)->token_entry;
+        error_t *err = symbols_get(cfg->labels, name, &symbol);
+        if (err)
+            return err;
+        cfg_block_t *block = &cfg->blocks[cfg->blocks_len - 1];
+        // The assembler reports labels defined twice, they have to stay
+        if (symbol->defined || (cfg->exported_labels && symbol->global)) {
+            block->root = true;
+            block->referenced = true;
+        }
+        if (symbol->defined)
+            continue;
+        symbol->defined = true;
+        symbol->offset = cfg->blocks_len - 1;
+    }
+    if (cfg->blocks_len)
+        cfg->blocks[cfg->blocks_len - 1].end = program->len;
+    cfg->blocks[cfg->blocks_len] = (cfg_block_t){.first = program->len,
+                                                 .end = program->len,
+                                                 .unknown_from = SIZE_MAX};
+    return nullptr;
+}
+
+// Adds the successors of every block, in the order of the blocks
+static error_t *cfg_connect(cfg_t *cfg, ast_node_t *program) {
+    // A jump and a fall through at most
+    cfg->edges = calloc(2 * cfg->blocks_len + 1, sizeof(cfg_edge_t));
+    if (cfg->edges == nullptr)
+        return err_allocation_failed;
+
+    for (size_t i = 0; i < cfg->blocks_len; ++i) {
+        cfg_block_t *block = &cfg->blocks[i];
+        block->edges = cfg->edges_len;
+        ast_node_t *last = ast_node_child(program, block->end - 1);
+        bool falls_through = true;
+        if (last->id == NODE_INSTRUCTION) {
+            const char *mnemonic = cfg_mnemonic(last);
+            ast_node_t *target = cfg_direct_target(last);
+            bool exact = target && cfg_exact_target(target);
+            size_t target_block =
+                exact ? cfg_target_block(cfg, target) : SIZE_MAX;
+            if (target && !exact)
+                block->unknown_from = cfg_unknown_from(cfg, target, i);
+            if (target_block != SIZE_MAX)
+                cfg->edges[cfg->edges_len++] = (cfg_edge_t){
+                    .target = target_block,
+                    .kind = strcmp(mnemonic, "call") == 0 ? CFG_CALL
+                                                          : CFG_JUMP,
+                };
+            falls_through = !cfg_terminates(mnemonic);
+        }
+        if (falls_through && i + 1 < cfg->blocks_len)
+            cfg->edges[cfg->edges_len++] =
+                (cfg_edge_t){.target = i + 1, .kind = CFG_FALLTHROUGH};
+    }
+    cfg->blocks[cfg->blocks_len].edges = cfg->edges_len;
+    return nullptr;
+}
+
+error_t *cfg_build(cfg_t **output, ast_node_t *program, bool exported_labels) {
+    *output = nullptr;
+
+    cfg_t *cfg = calloc(1, sizeof(cfg_t));
+    if (cfg == nullptr)
+        return err_allocation_failed;
+    cfg->exported_labels = exported_labels;
+    error_t *err = symbols_alloc(&cfg->labels);
+    if (err == nullptr && exported_labels)
+        err = cfg_mark_globals(cfg, program);
+    if (err == nullptr)
+        err = cfg_split(cfg, program);
+    if (err == nullptr)
+        err = cfg_connect(cfg, program);
+    if (err) {
+        cfg_free(cfg);
+        return err;
+    }
+
+    *output = cfg;
+    return nullptr;
+}
+
+void cfg_free(cfg_t *cfg) {
+    if (cfg == nullptr)
+        return;
+    free(cfg->blocks);
+    free(cfg->edges);
+    symbols_free(cfg->labels);
+    free(cfg);
+}
+
+/* Blocks found reachable whose successors are still to be visited */
+typedef struct cfg_walk {
+    cfg_t *cfg;
+    size_t *stack;
+    size_t len;
+    /* the blocks from here on have been visited for jumps the graph can't
+     * follow */
+    size_t unknown_from;
+} cfg_walk_t;
+
+static void cfg_visit(cfg_walk_t *walk, size_t block) {
+    if (walk->cfg->blocks[block].reachable)
+        return;
+    walk->cfg->blocks[block].reachable = true;
+    walk->stack[walk->len++] = block;
+}
+
+// Visits the blocks of the labels the subtree names, a label whose address is
+// taken could be jumped to from anywhere. Operands are only a few levels deep.
+static void cfg_name(cfg_walk_t *walk, ast_node_t *node) {
+    // A folded expression has every label it names in its subtree
+    if (node->id == NODE_LABEL_REFERENCE) {
+        size_t block = cfg_target_block(walk->cfg, node);
+        if (block != SIZE_MAX) {
+            walk->cfg->blocks[block].referenced = true;
+            cfg_visit(walk, block);
+        }
+    }
+    for (size_t i = 0; i < node->len; ++i)
+        cfg_name(walk, ast_node_child(node, i));
+}
+
+// Marks every block reachable from a root along the edges and the labels live
+// statements name, and every label live statements name as referenced
+static error_t *cfg_reach(cfg_t *cfg, ast_node_t *program) {
+    cfg_walk_t walk = {
+        .cfg = cfg,
+        .stack = malloc((cfg->blocks_len + 1) * sizeof(size_t)),
+        .unknown_from = cfg->blocks_len,
+    };
+    if (walk.stack == nullptr)
+        return err_allocation_failed;
+    for (size_t i = 0; i < cfg->blocks_len; ++i)
+        if (cfg->blocks[i].root)
+            cfg_visit(&walk, i);
+
+    while (walk.len) {
+        const cfg_block_t *block = &cfg->blocks[walk.stack[--walk.len]];
+        for (size_t i = block->edges; i < block[1].edges; ++i)
+            cfg_visit(&walk, cfg->edges[i].target);
+        // Without knowing where the jump goes, everything it could go to is
+        // reachable
+        for (; block->unknown_from < walk.unknown_from; --walk.unknown_from)
+            cfg_visit(&walk, walk.unknown_from - 1);
+        for (size_t i = block->first; i < block->end; ++i) {
+            ast_node_t *statement = ast_node_child(program, i);
+            if (statement->id != NODE_LABEL)
+                cfg_name(&walk, statement);
+        }
+    }
+    free(walk.stack);
+    return nullptr;
+}
+
+error_t *cfg_eliminate(cfg_t *cfg, ast_node_t *program) {
+    error_t *err = cfg_reach(cfg, program);
+    if (err)
+        return err;
+
+    size_t kept = 0;
+    for (size_t i = 0; i < cfg->blocks_len; ++i) {
+        const cfg_block_t *block = &cfg->blocks[i];
+        for (size_t j = block->first; j < block->end; ++j) {
+            ast_node_t *statement = ast_node_child(program, j);
+            bool label = statement->id == NODE_LABEL;
+            // The symbols .global names stay, live or not
+            if ((block->reachable && (!label || block->referenced)) ||
+                cfg_global(statement)) {
+                *ast_node_child_slot(program, kept++) = statement;
+                continue;
+            }
+            if (label && block->reachable)
+                cfg->dropped_labels += 1;
+            else
+                cfg->dropped_statements += 1;
+            ast_node_free(statement);
+        }
+    }
+    program->len = kept;
+    return nullptr;
+}
+
+void cfg_print(const cfg_t *cfg, FILE *file) {
+    fprintf(file, "dead code: %zu statements and %zu labels dropped\n",
+            cfg->dropped_statements, cfg->dropped_labels);
+}
@@ -0,0 +1,112 @@
+#ifndef INCLUDE_SRC_CFG_H_
+#define INCLUDE_SRC_CFG_H_
+
+#include "ast.h"
+#include "error.h"
+#include "symbols.h"
+#include <stddef.h>
+#include <stdio.h>
+
+/* The control flow graph of a parsed program. A basic block is a run of
+ * statements that starts at the beginning of the program, at a label or after
+ * a jump, branch, call or return and ends in front of the next such place.
+ * Directives are blocks of their own, except .global, which only names
+ * symbols and is kept wherever it is. Edges go from a block to the label a
+ * jump, branch or call at its end names and to the next block if control can
+ * fall through to it. The successors of all blocks are kept together in one
+ * array in the order of the blocks, so the graph takes two arrays and is
+ * built in two linear passes over the program.
+ *
+ * Blocks are roots when control can enter them from outside of what the
+ * graph knows about: the first block, directives and the labels .global names
+ * when they are symbols other objects can reference. Live code reaches the
+ * blocks along the edges and the labels whose address it takes by anything
+ * but a direct jump, branch or call, since those might be jumped to
+ * indirectly. A jump to anything but the start of a label makes every block
+ * it could land in reachable. Everything else is dead. */
+
+typedef enum cfg_edge_kind {
+    CFG_FALLTHROUGH,
+    CFG_JUMP,
+    CFG_CALL,
+} cfg_edge_kind_t;
+
+typedef struct cfg_edge {
+    size_t target;
+    cfg_edge_kind_t kind;
+} cfg_edge_t;
+
+typedef struct cfg_block {
+    /* statements first up to end */
+    size_t first;
+    size_t end;
+    /* the successors are edges[edges] up to the edges of the next block */
+    size_t edges;
+    /* the jump, branch or call at its end goes somewhere the graph can't
+     * tell, like $ or a label plus a number, which is in this block or one
+     * behind it. SIZE_MAX for every other block. */
+    size_t unknown_from;
+    bool root;
+    /* a live statement names the label the block starts with */
+    bool referenced;
+    bool reachable;
+} cfg_block_t;
+
+typedef struct cfg {
+    /* one more block than blocks_len, whose edges end the last block's */
+    size_t blocks_len;
+    cfg_block_t *blocks;
+    size_t edges_len;
+    cfg_edge_t *edges;
+    /* maps every label to the block it starts, as the offset of its symbol */
+    symbols_t *labels;
+    /* the labels .global names are roots */
+    bool exported_labels;
+    /* what cfg_eliminate dropped */
+    size_t dropped_statements;
+    size_t dropped_labels;
+} cfg_t;
+
+/**
+ * @brief Build the control flow graph of a program
+ *
+ * @param[out] output Pointer to the allocated graph
+ * @param program The program, which must have parsed without diagnostics
+ * @param exported_labels Whether the labels .global names are roots
+ * @return error_t* nullptr on success, allocation error on failure
+ */
+error_t *cfg_build(cfg_t **output, ast_node_t *program, bool exported_labels);
+
+/**
+ * @brief Free the graph
+ *
+ * If cfg is nullptr, the function returns without doing anything.
+ *
+ * @param cfg The graph to free
+ */
+void cfg_free(cfg_t *cfg);
+
+/**
+ * @brief Drop the dead code of the program the graph was built from
+ *
+ * Finds the blocks reachable from the roots, frees and removes the statements
+ * of all others and the labels no live statement names, unless they are
+ * exported. The graph keeps the blocks as they were, with what is reachable
+ * marked, and counts what was dropped.
+ *
+ * @param cfg The graph of the program
+ * @param program The program
+ * @return error_t* nullptr on success, allocation error on failure, in which
+ *         case the program is left as is
+ */
+error_t *cfg_eliminate(cfg_t *cfg, ast_node_t *program);
+
+/**
+ * @brief Print how many statements and labels were dropped
+ *
+ * @param cfg The graph after cfg_eliminate
+ * @param file The file to print to
+ */
+void cfg_print(const cfg_t *cfg, FILE *file);
+
+#endif // INCLUDE_SRC_CFG_H_
@@ -0,0 +1,293 @@
+#include "conditional.h"
+#include "error.h"
+#include "expression.h"
+#include "parser/generated.h"
+#include <ctype.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+error_t *err_conditional_define = &(error_t){
+    .message = "Definitions are name or name=value, with a decimal or 0x "
+               "hexadecimal value"};
+
+constexpr size_t conditionals_default_cap = 16;
+
+typedef enum conditional_directive {
+    CONDITIONAL_NONE,
+    CONDITIONAL_IF,
+    CONDITIONAL_IFDEF,
+    CONDITIONAL_IFNDEF,
+    CONDITIONAL_ELSE,
+    CONDITIONAL_ENDIF,
+} conditional_directive_t;
+
+static const char *conditional_directives[] = {
+    [CONDITIONAL_IF] = "if",         [CONDITIONAL_IFDEF] = "ifdef",
+    [CONDITIONAL_IFNDEF] = "ifndef", [CONDITIONAL_ELSE] = "else",
+    [CONDITIONAL_ENDIF] = "endif",
+};
+
+// With the dot, for the error at the end of the input
+static const char *conditional_openers[] = {
+    [CONDITIONAL_IF] = ".if",
+    [CONDITIONAL_IFDEF] = ".ifdef",
+    [CONDITIONAL_IFNDEF] = ".ifndef",
+};
+
+error_t *conditionals_alloc(conditionals_t **output) {
+    *output = nullptr;
+
+    conditionals_t *conditionals = calloc(1, sizeof(conditionals_t));
+    if (conditionals == nullptr)
+        return err_allocation_failed;
+
+    error_t *err = symbols_alloc(&conditionals->defines);
+    if (err == nullptr)
+        err = tokenlist_alloc(&conditionals->names);
+    if (err) {
+        conditionals_free(conditionals);
+        return err;
+    }
+
+    *output = conditionals;
+    return nullptr;
+}
+
+void conditionals_free(conditionals_t *conditionals) {
+    if (conditionals == nullptr)
+        return;
+    symbols_free(conditionals->defines);
+    tokenlist_free(conditionals->names);
+    free(conditionals->blocks);
+    free(conditionals);
+}
+
+error_t *conditionals_define(conditionals_t *conditionals,
+                             const char *definition) {
+    size_t len = 0;
+    while (definition[len] == '_' || isalnum((unsigned char)definition[len]))
+        len++;
+    if (len == 0 || isdigit((unsigned char)definition[0]))
+        return err_conditional_define;
+
+    uint64_t value = 1;
+    if (definition[len] == '=') {
+        const char *number = definition + len + 1;
+        bool hexadecimal = strncmp(number, "0x", 2) == 0;
+        char *end;
+        errno = 0;
+        value = strtoull(number, &end, hexadecimal ? 16 : 10);
+        // strtoull would take signs and leading whitespace
+        if (errno || !isxdigit((unsigned char)*number) || *end != '\0')
+            return err_conditional_define;
+    } else if (definition[len] != '\0') {
+        return err_conditional_define;
+    }
+
+    tokenlist_entry_t *entry;
+    error_t *err = tokenlist_entry_alloc(&entry);
+    if (err)
+        return err;
+    entry->token.id = TOKEN_IDENTIFIER;
+    entry->token.value = strndup(definition, len);
+    if (entry->token.value == nullptr) {
+        free(entry);
+        return err_allocation_failed;
+    }
+    tokenlist_append(conditionals->names, entry);
+
+    symbol_t *symbol;
+    err = symbols_get(conditionals->defines, entry, &symbol);
+    if (err)
+        return err;
+    symbol->defined = true;
+    symbol->offset = value;
+    return nullptr;
+}
+
+// The conditional directive the line starts with. Its dot and name have to
+// be next to each other, like the lexer expects when it skips lines.
+static conditional_directive_t
+conditionals_directive(tokenlist_entry_t *line) {
+    while (line && line->token.id == TOKEN_WHITESPACE)
+        line = line->next;
+    if (line == nullptr || line->token.id != TOKEN_DOT || !line->next ||
+        line->next->token.id != TOKEN_IDENTIFIER)
+        return CONDITIONAL_NONE;
+    for (size_t i = CONDITIONAL_IF; i <= CONDITIONAL_ENDIF; ++i)
+        if (strcmp(line->next->token.value, conditional_directives[i]) == 0)
+            return i;
+    return CONDITIONAL_NONE;
+}
+
+// Decides whether the block of the .if, .ifdef or .ifndef line is kept. The
+// line is the last one in the list.
+static error_t *conditionals_condition(conditionals_t *conditionals,
+                                       conditional_directive_t directive,
+                                       tokenlist_entry_t *name, bool *kept,
+                                       const char **explanation) {
+    tokenlist_entry_t *operand = tokenlist_next(name);
+    if (directive != CONDITIONAL_IF) {
+        if (operand == nullptr || operand->token.id != TOKEN_IDENTIFIER ||
+            tokenlist_next(operand)) {
+            *explanation = ".ifdef and .ifndef take a single name";
+            return nullptr;
+        }
+        const symbol_t *symbol =
+            symbols_find(conditionals->defines, operand->token.value);
+        *kept = (symbol != nullptr) == (directive == CONDITIONAL_IFDEF);
+        return nullptr;
+    }
+
+    parse_result_t result = parse_generated_expression(operand);
+    if (result.err == err_allocation_failed)
+        return result.err;
+    if (result.err || result.next) {
+        ast_node_free(result.node);
+        *explanation = "Condition has to be an expression";
+        return nullptr;
+    }
+    uint64_t value;
+    tokenlist_entry_t *token;
+    error_t *err = expression_constant(result.node, conditionals->defines,
+                                       &value, &token);
+    ast_node_free(result.node);
+    if (err == nullptr)
+        *kept = value != 0;
+    else
+        *explanation = err->message;
+    return nullptr;
+}
+
+static error_t *conditionals_push(conditionals_t *conditionals,
+                                  conditional_block_t block) {
+    if (conditionals->len == conditionals->cap) {
+        size_t new_cap = conditionals->cap ? conditionals->cap * 2
+                                           : conditionals_default_cap;
+        conditional_block_t *blocks = realloc(
+            conditionals->blocks, new_cap * sizeof(conditional_block_t));
+        if (blocks == nullptr)
+            return err_allocation_failed;
+        conditionals->blocks = blocks;
+        conditionals->cap = new_cap;
+    }
+    conditionals->blocks[conditionals->len++] = block;
+    return nullptr;
+}
+
+// Takes care of the line that was just added to the end of the list if it is
+// a conditional directive: the line is dropped or marked as an error, and
+// the lexer skips the block that follows unless it is kept. Sets *end if the
+// input ends while skipping.
+static error_t *conditionals_line(conditionals_t *conditionals,
+                                  tokenlist_t *list, tokenlist_entry_t *line,
+                                  lexer_t *lex, bool *end) {
+    conditional_directive_t directive = conditionals_directive(line);
+    if (directive == CONDITIONAL_NONE)
+        return nullptr;
+    tokenlist_entry_t *dot = tokenlist_skip_trivia(line);
+    const char *explanation = nullptr;
+    bool skip = false, stop_at_else = false;
+
+    conditional_block_t *block =
+        conditionals->len ? &conditionals->blocks[conditionals->len - 1]
+                          : nullptr;
+    if (directive == CONDITIONAL_ELSE) {
+        if (block == nullptr || block->in_else) {
+            explanation = ".else without an .if to belong to";
+        } else {
+            block->in_else = true;
+            skip = block->kept;
+            block->kept = true;
+        }
+    } else if (directive == CONDITIONAL_ENDIF) {
+        if (block == nullptr)
+            explanation = ".endif without an .if to end";
+        else
+            conditionals->len -= 1;
+    } else {
+        // A block whose condition is wrong is dropped, along with the
+        // blocks nested in it
+        bool kept = false;
+        error_t *err = conditionals_condition(conditionals, directive,
+                                              dot->next, &kept, &explanation);
+        if (err == nullptr)
+            err = conditionals_push(
+                conditionals,
+                (conditional_block_t){
+                    .directive = conditional_openers[directive],
+                    .line_number = dot->token.line_number,
+                    .character_number = dot->token.character_number,
+                    .kept = kept,
+                });
+        if (err)
+            return err;
+        skip = !kept;
+        stop_at_else = true;
+    }
+
+    if (explanation) {
+        dot->token.id = TOKEN_ERROR;
+        dot->token.explanation = explanation;
+    } else {
+        tokenlist_truncate(list, line);
+    }
+    if (!skip)
+        return nullptr;
+    error_t *err = lexer_skip_conditional(lex, stop_at_else);
+    if (err == err_eof) {
+        *end = true;
+        return nullptr;
+    }
+    return err;
+}
+
+error_t *conditionals_fill(conditionals_t *conditionals, tokenlist_t *list,
+                           lexer_t *lex) {
+    conditionals->len = 0;
+    tokenlist_entry_t *line = nullptr;
+    bool end = false;
+    while (!end) {
+        lexer_token_t token;
+        error_t *err = lexer_next(lex, &token);
+        end = err == err_eof;
+        if (err && !end)
+            return err;
+
+        if (!end) {
+            bool newline = token.id == TOKEN_NEWLINE;
+            err = tokenlist_add(list, &token);
+            if (err)
+                return err;
+            if (line == nullptr)
+                line = list->tail;
+            if (!newline)
+                continue;
+        }
+        // The last line may end without a newline
+        err = line ? conditionals_line(conditionals, list, line, lex, &end)
+                   : nullptr;
+        if (err)
+            return err;
+        line = nullptr;
+    }
+
+    // Blocks without an .endif are reported where they start
+    for (size_t i = 0; i < conditionals->len; ++i) {
+        conditional_block_t *block = &conditionals->blocks[i];
+        lexer_token_t token = {
+            .id = TOKEN_ERROR,
+            .line_number = block->line_number,
+            .character_number = block->character_number,
+            .value = strdup(block->directive),
+            .explanation = "Block is missing its .endif",
+        };
+        if (token.value == nullptr)
+            return err_allocation_failed;
+        error_t *err = tokenlist_add(list, &token);
+        if (err)
+            return err;
+    }
+    return nullptr;
+}
@@ -0,0 +1,95 @@
+#ifndef INCLUDE_SRC_CONDITIONAL_H_
+#define INCLUDE_SRC_CONDITIONAL_H_
+
+#include "error.h"
+#include "lexer.h"
+#include "symbols.h"
+#include "tokenlist.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* Conditional assembly keeps or drops blocks of lines while the input is
+ * lexed, depending on names defined before assembling starts:
+ *
+ *     .if expression      kept if the expression isn't 0
+ *     .ifdef name         kept if the name is defined
+ *     .ifndef name        kept if it isn't
+ *     .else               kept if the block in front of it isn't
+ *     .endif
+ *
+ * Expressions are made of numbers and defined names, see expression.h. Only
+ * conditions see the defined names, they aren't labels or constants. The
+ * directive lines never make it into the token list, neither do the blocks
+ * that are dropped: the lexer skips their lines without lexing them, see
+ * lexer_skip_conditional. Blocks nest. Since conditions are decided before
+ * macros are expanded, they can't depend on macro arguments.
+ *
+ * A directive that is wrong stays in the token list with its dot turned into
+ * a TOKEN_ERROR explaining what is wrong, so the parser reports it like any
+ * other error of the lexer. */
+
+typedef struct conditional_block {
+    /* the directive opening the block, to report it if .endif is missing */
+    const char *directive;
+    size_t line_number;
+    size_t character_number;
+    /* one of the blocks in front of .else is kept */
+    bool kept;
+    bool in_else;
+} conditional_block_t;
+
+typedef struct conditionals {
+    /* the defined names, the offset of a symbol is its value */
+    symbols_t *defines;
+    /* the tokens naming them, which the table points into */
+    tokenlist_t *names;
+    /* the blocks open at the current line, innermost last */
+    size_t len;
+    size_t cap;
+    conditional_block_t *blocks;
+} conditionals_t;
+
+extern error_t *err_conditional_define;
+
+/**
+ * @brief Allocate a new table without any defined names
+ *
+ * @param[out] output Pointer to the allocated table
+ * @return error_t* nullptr on success, allocation error on failure
+ */
+error_t *conditionals_alloc(conditionals_t **output);
+
+/**
+ * @brief Free the table
+ *
+ * If conditionals is nullptr, the function returns without doing anything.
+ *
+ * @param conditionals The table to free
+ */
+void conditionals_free(conditionals_t *conditionals);
+
+/**
+ * @brief Define a name, which replaces an earlier definition
+ *
+ * @param conditionals The table
+ * @param definition name or name=value, with a decimal or 0x hexadecimal
+ *        value. Without one the name is 1.
+ * @return error_t* nullptr on success, err_conditional_define if the
+ *         definition isn't either, allocation error on failure
+ */
+error_t *conditionals_define(conditionals_t *conditionals,
+                             const char *definition);
+
+/**
+ * @brief Consume all tokens from the lexer and add the ones in kept blocks to
+ *        the list
+ *
+ * @param conditionals The table
+ * @param list The list to add to
+ * @param lex The lexer
+ * @return error_t* nullptr on success, allocation or read error on failure
+ */
+error_t *conditionals_fill(conditionals_t *conditionals, tokenlist_t *list,
+                           lexer_t *lex);
+
+#endif // INCLUDE_SRC_CONDITIONAL_H_
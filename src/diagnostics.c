@@ -0,0 +1,69 @@
+#include "diagnostics.h"
+#include "error.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+error_t *err_diagnostics_limit =
+    &(error_t){.message = "Reached the maximum number of diagnostics"};
+
+constexpr size_t diagnostics_default_cap = 16;
+
+error_t *diagnostics_alloc(diagnostics_t **output, size_t limit) {
+    *output = nullptr;
+
+    diagnostics_t *diagnostics = calloc(1, sizeof(diagnostics_t));
+    if (diagnostics == nullptr)
+        return err_allocation_failed;
+    diagnostics->limit = limit;
+
+    *output = diagnostics;
+    return nullptr;
+}
+
+void diagnostics_free(diagnostics_t *diagnostics) {
+    if (diagnostics == nullptr)
+        return;
+    free(diagnostics->entries);
+    free(diagnostics);
+}
+
+void diagnostics_clear(diagnostics_t *diagnostics) {
+    diagnostics->len = 0;
+    diagnostics->limit_reached = false;
+}
+
+error_t *diagnostics_add(diagnostics_t *diagnostics, tokenlist_entry_t *token,
+                         const char *message) {
+    if (diagnostics->limit && diagnostics->len == diagnostics->limit) {
+        diagnostics->limit_reached = true;
+        return err_diagnostics_limit;
+    }
+
+    if (diagnostics->len == diagnostics->cap) {
+        size_t new_cap = diagnostics->cap ? diagnostics->cap * 2
+                                          : diagnostics_default_cap;
+        diagnostic_t *entries =
+            realloc(diagnostics->entries, new_cap * sizeof(diagnostic_t));
+        if (entries == nullptr)
+            return err_allocation_failed;
+        diagnostics->entries = entries;
+        diagnostics->cap = new_cap;
+    }
+
+    diagnostics->entries[diagnostics->len] =
+        (diagnostic_t){.token = token, .message = message};
+    diagnostics->len += 1;
+    return nullptr;
+}
+
+void diagnostics_print(diagnostics_t *diagnostics) {
+    for (size_t i = 0; i < diagnostics->len; ++i) {
+        lexer_token_t *token = &diagnostics->entries[i].token->token;
+        printf("%zu:%zu: %s: \"%s\"\n", token->line_number + 1,
+               token->character_number + 1, diagnostics->entries[i].message,
+               token->value ? token->value : "");
+    }
+    if (diagnostics->limit_reached)
+        printf("Stopped after reaching the limit of %zu errors\n",
+               diagnostics->limit);
+}
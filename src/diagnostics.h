@@ -0,0 +1,74 @@
+#ifndef INCLUDE_SRC_DIAGNOSTICS_H_
+#define INCLUDE_SRC_DIAGNOSTICS_H_
+
+#include "error.h"
+#include "tokenlist.h"
+#include <stddef.h>
+
+/* Diagnostics collect the errors found in the input so that a single pass can
+ * report all of them instead of stopping at the first one. */
+
+typedef struct diagnostic {
+    /* the token the diagnostic points at */
+    tokenlist_entry_t *token;
+    const char *message;
+} diagnostic_t;
+
+typedef struct diagnostics {
+    size_t len;
+    size_t cap;
+    /* maximum number of diagnostics to record, 0 for no limit */
+    size_t limit;
+    /* set once a diagnostic was dropped because of the limit */
+    bool limit_reached;
+    diagnostic_t *entries;
+} diagnostics_t;
+
+extern error_t *err_diagnostics_limit;
+
+/**
+ * @brief Allocate a new, empty set of diagnostics
+ *
+ * @param[out] output Pointer to the allocated diagnostics
+ * @param limit Maximum number of diagnostics to record, 0 for no limit
+ * @return error_t* nullptr on success, allocation error on failure
+ */
+error_t *diagnostics_alloc(diagnostics_t **output, size_t limit);
+
+/**
+ * @brief Free the diagnostics
+ *
+ * If diagnostics is nullptr, the function returns without doing anything.
+ *
+ * @param diagnostics The diagnostics to free
+ */
+void diagnostics_free(diagnostics_t *diagnostics);
+
+/**
+ * @brief Forget every diagnostic, so the diagnostics can be used again
+ *
+ * @param diagnostics The diagnostics to clear
+ */
+void diagnostics_clear(diagnostics_t *diagnostics);
+
+/**
+ * @brief Record a diagnostic
+ *
+ * @param diagnostics The diagnostics to add to
+ * @param token The token the diagnostic points at
+ * @param message Message describing the problem, must outlive diagnostics
+ * @return error_t* nullptr on success, err_diagnostics_limit if the limit was
+ *         already reached, in which case nothing is recorded, allocation
+ *         error on failure
+ */
+error_t *diagnostics_add(diagnostics_t *diagnostics, tokenlist_entry_t *token,
+                         const char *message);
+
+/**
+ * @brief Print every diagnostic on its own line, prefixed by line and column
+ *
+ * @param diagnostics The diagnostics to print
+ */
+void diagnostics_print(diagnostics_t *diagnostics);
+
+#endif // INCLUDE_SRC_DIAGNOSTICS_H_
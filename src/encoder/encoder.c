@@ -0,0 +1,549 @@
+#include "encoder.h"
+#include "../ast.h"
+#include "../error.h"
+#include "../expression.h"
+#include "table.h"
+#include <stdlib.h>
+#include <string.h>
+
+error_t *err_encoder_unknown_mnemonic =
+    &(error_t){.message = "Unknown instruction"};
+error_t *err_encoder_operands =
+    &(error_t){.message = "Invalid operands for the instruction"};
+error_t *err_encoder_operand_size = &(error_t){
+    .message = "Operand size can't be inferred, no register operand gives "
+               "it away"};
+error_t *err_encoder_memory = &(error_t){.message = "Invalid memory operand"};
+error_t *err_encoder_label =
+    &(error_t){.message = "Only one label can be referenced per instruction"};
+
+static const uint8_t operand_class_sizes[] = {
+    [OPERAND_R8] = 8,     [OPERAND_R16] = 16,   [OPERAND_R32] = 32,
+    [OPERAND_R64] = 64,   [OPERAND_RM8] = 8,    [OPERAND_RM16] = 16,
+    [OPERAND_RM32] = 32,  [OPERAND_RM64] = 64,  [OPERAND_M] = 0,
+    [OPERAND_AL] = 8,     [OPERAND_AX] = 16,    [OPERAND_EAX] = 32,
+    [OPERAND_RAX] = 64,   [OPERAND_CL] = 8,     [OPERAND_ONE] = 0,
+    [OPERAND_IMM8] = 8,   [OPERAND_IMM16] = 16, [OPERAND_IMM32] = 32,
+    [OPERAND_IMM64] = 64, [OPERAND_REL8] = 8,   [OPERAND_REL32] = 32,
+};
+
+constexpr uint8_t rex = 0x40;
+constexpr uint8_t rex_w = 0x08;
+constexpr uint8_t rex_r = 0x04;
+constexpr uint8_t rex_x = 0x02;
+constexpr uint8_t rex_b = 0x01;
+constexpr uint8_t prefix_operand_size = 0x66;
+constexpr uint8_t prefix_address_size = 0x67;
+
+static uint64_t encoder_number(ast_node_t *number) {
+    return ast_node_child(number, 0)->value.integer.value;
+}
+
+static int encoder_number_size(ast_node_t *number) {
+    return ast_node_child(number, 0)->value.integer.size;
+}
+
+static const register_info_t *encoder_register(ast_node_t *node) {
+    return register_lookup(node->token_entry->token.value);
+}
+
+static error_t *encoder_read_memory(ast_node_t *expression,
+                                    operand_t *operand) {
+    if (expression->id == NODE_LABEL_REFERENCE) {
+        // Differences of labels are numbers, which can't be addressed
+        if (expression->value.reference.minus)
+            return err_encoder_memory;
+        operand->kind = OPERAND_KIND_LABEL_MEMORY;
+        operand->label = expression->token_entry;
+        operand->addend = expression->value.reference.addend;
+        return nullptr;
+    }
+    if (expression->id != NODE_REGISTER_EXPRESSION)
+        return err_encoder_memory;
+
+    operand->kind = OPERAND_KIND_MEMORY;
+    operand->base = encoder_register(ast_node_child(expression, 0));
+    for (size_t i = 1; i < expression->len; ++i) {
+        ast_node_t *child = ast_node_child(expression, i);
+        if (child->id == NODE_REGISTER_INDEX) {
+            operand->index = encoder_register(ast_node_child(child, 1));
+            uint64_t scale = encoder_number(ast_node_child(child, 3));
+            if (scale != 1 && scale != 2 && scale != 4 && scale != 8)
+                return err_encoder_memory;
+            operand->scale = scale;
+        } else if (child->id == NODE_REGISTER_OFFSET) {
+            bool negative = ast_node_child(child, 0)->id == NODE_MINUS;
+            ast_node_t *number = ast_node_child(child, 1);
+            uint64_t offset = encoder_number(number);
+            // A folded expression has the sign applied already
+            if (expression_folded(number)) {
+                negative = (int64_t)offset < 0;
+                offset = negative ? -offset : offset;
+            }
+            operand->displacement_size = encoder_number_size(number);
+            // Displacements are 1 or 4 bytes and sign extended
+            uint64_t limit = operand->displacement_size == 8 ? 0x7f
+                                                             : 0x7fffffff;
+            if (operand->displacement_size != 0 &&
+                operand->displacement_size != 8 &&
+                operand->displacement_size != 32)
+                return err_encoder_memory;
+            if (offset > limit + negative)
+                return err_encoder_memory;
+            operand->displacement =
+                negative ? -(int64_t)offset : (int64_t)offset;
+        }
+    }
+
+    // Only 64 and 32 bit addressing exist in long mode, the stack pointer
+    // can't be an index
+    const register_info_t *base = operand->base;
+    const register_info_t *index = operand->index;
+    if (base->size != 64 && base->size != 32)
+        return err_encoder_memory;
+    if (index && (index->size != base->size || index->number == 4))
+        return err_encoder_memory;
+    return nullptr;
+}
+
+static error_t *encoder_read_operand(ast_node_t *node, operand_t *operand) {
+    *operand = (operand_t){};
+    switch (node->id) {
+    case NODE_REGISTER:
+        operand->kind = OPERAND_KIND_REGISTER;
+        operand->reg = encoder_register(node);
+        return nullptr;
+    case NODE_MEMORY:
+        return encoder_read_memory(ast_node_child(node, 1), operand);
+    case NODE_IMMEDIATE: {
+        ast_node_t *value = ast_node_child(node, 0);
+        if (value->id == NODE_LABEL_REFERENCE) {
+            operand->kind = OPERAND_KIND_LABEL;
+            operand->label = value->token_entry;
+            operand->addend = value->value.reference.addend;
+            operand->minus = value->value.reference.minus;
+        } else {
+            operand->kind = OPERAND_KIND_IMMEDIATE;
+            operand->immediate = encoder_number(value);
+            operand->immediate_size = encoder_number_size(value);
+        }
+        return nullptr;
+    }
+    default:
+        return err_encoder_operands;
+    }
+}
+
+// Whether the immediate of the form can hold the number, a sign extended
+// immediate holds the numbers of the operand size it extends to
+static bool encoder_fits(const instruction_form_t *form, uint64_t value) {
+    uint8_t bits = form->immediate_size * 8;
+    if (bits == 64)
+        return true;
+    // Folded expressions can be negative, which is the same as the number of
+    // the operand size with the same bits
+    uint8_t size = form->operand_size;
+    if (size != 0 && size < 64 && (int64_t)value < 0 &&
+        (int64_t)value >= -(int64_t)(1ull << (size - 1)))
+        value &= (1ull << size) - 1;
+    if (!form->immediate_signed)
+        return value < 1ull << bits;
+
+    uint64_t largest = form->operand_size == 64
+                           ? UINT64_MAX
+                           : (1ull << form->operand_size) - 1;
+    uint64_t half = 1ull << (bits - 1);
+    return value < half || (value <= largest && value > largest - half);
+}
+
+static bool encoder_matches_operand(const instruction_form_t *form,
+                                    operand_class_t class,
+                                    const operand_t *operand) {
+    uint8_t size = operand_class_sizes[class];
+    switch (class) {
+    case OPERAND_R8:
+    case OPERAND_R16:
+    case OPERAND_R32:
+    case OPERAND_R64:
+        return operand->kind == OPERAND_KIND_REGISTER &&
+               operand->reg->size == size;
+    case OPERAND_RM8:
+    case OPERAND_RM16:
+    case OPERAND_RM32:
+    case OPERAND_RM64:
+        if (operand->kind == OPERAND_KIND_REGISTER)
+            return operand->reg->size == size;
+        // The size of a memory operand has to be given away by a register
+        // operand of the same size
+        return (operand->kind == OPERAND_KIND_MEMORY ||
+                operand->kind == OPERAND_KIND_LABEL_MEMORY) &&
+               form->reg_operand != -1 &&
+               operand_class_sizes[form->operands[form->reg_operand]] == size;
+    case OPERAND_M:
+        return operand->kind == OPERAND_KIND_MEMORY ||
+               operand->kind == OPERAND_KIND_LABEL_MEMORY;
+    case OPERAND_AL:
+    case OPERAND_AX:
+    case OPERAND_EAX:
+    case OPERAND_RAX:
+        return operand->kind == OPERAND_KIND_REGISTER &&
+               operand->reg->size == size && operand->reg->number == 0;
+    case OPERAND_CL:
+        return operand->kind == OPERAND_KIND_REGISTER &&
+               operand->reg->size == size && operand->reg->number == 1;
+    case OPERAND_ONE:
+        return operand->kind == OPERAND_KIND_IMMEDIATE &&
+               operand->immediate == 1 && operand->immediate_size == 0;
+    case OPERAND_IMM8:
+    case OPERAND_IMM16:
+    case OPERAND_IMM32:
+    case OPERAND_IMM64:
+        if (operand->kind == OPERAND_KIND_LABEL)
+            return size >= 32;
+        if (operand->kind != OPERAND_KIND_IMMEDIATE)
+            return false;
+        if (operand->immediate_size != 0 && operand->immediate_size != size)
+            return false;
+        return encoder_fits(form, operand->immediate);
+    case OPERAND_REL8:
+    case OPERAND_REL32:
+        return operand->kind == OPERAND_KIND_LABEL && operand->minus == nullptr;
+    }
+    return false;
+}
+
+static bool encoder_matches(const instruction_form_t *form,
+                            const operand_t *operands, size_t count) {
+    if (form->operand_count != count)
+        return false;
+    for (size_t i = 0; i < count; ++i)
+        if (!encoder_matches_operand(form, form->operands[i], &operands[i]))
+            return false;
+    // 90 is nop, which unlike xchg eax, eax doesn't clear the upper half of rax
+    if (form->opcode_register && form->opcode[0] == 0x90) {
+        const register_info_t *reg = operands[form->reg_operand].reg;
+        return reg->size != 32 || reg->number != 0;
+    }
+    return true;
+}
+
+// Tells apart operands that fit no form from memory operands without a size
+static error_t *encoder_no_match(const operand_t *operands, size_t count) {
+    bool has_memory = false;
+    for (size_t i = 0; i < count; ++i) {
+        if (operands[i].kind == OPERAND_KIND_REGISTER)
+            return err_encoder_operands;
+        has_memory = has_memory || operands[i].kind == OPERAND_KIND_MEMORY ||
+                     operands[i].kind == OPERAND_KIND_LABEL_MEMORY;
+    }
+    return has_memory ? err_encoder_operand_size : err_encoder_operands;
+}
+
+static void encoder_emit(encoding_t *encoding, uint8_t byte) {
+    encoding->bytes[encoding->len++] = byte;
+}
+
+static void encoder_emit_value(encoding_t *encoding, uint64_t value,
+                               size_t size) {
+    for (size_t i = 0; i < size; ++i)
+        encoder_emit(encoding, value >> (8 * i));
+}
+
+static uint8_t encoder_modrm(uint8_t mod, uint8_t reg, uint8_t rm) {
+    return (mod << 6) | ((reg & 7) << 3) | (rm & 7);
+}
+
+// Leaves a zero placeholder for the label's value
+static void encoder_emit_label(encoding_t *encoding, const operand_t *operand,
+                               uint8_t size, bool relative, bool is_signed) {
+    encoding->label = operand->label;
+    encoding->label_addend = operand->addend;
+    encoding->label_minus = operand->minus;
+    encoding->label_offset = encoding->len;
+    encoding->label_size = size;
+    encoding->label_relative = relative;
+    encoding->label_signed = is_signed;
+    encoder_emit_value(encoding, 0, size);
+}
+
+static void encoder_emit_memory(encoding_t *encoding, uint8_t reg,
+                                const operand_t *memory) {
+    // Labels are addressed relative to the end of the instruction, which is
+    // what mod 00 with r/m 101 means in long mode
+    if (memory->label) {
+        encoder_emit(encoding, encoder_modrm(0, reg, 5));
+        encoder_emit_label(encoding, memory, 4, true, true);
+        return;
+    }
+
+    uint8_t base = memory->base->number & 7;
+    // rsp and r12 as base need a SIB byte, rbp and r13 as base without a
+    // displacement would mean no base at all
+    bool sib = memory->index || base == 4;
+    int64_t displacement = memory->displacement;
+    int size = memory->displacement_size / 8;
+    if (size == 0 && (displacement != 0 || base == 5))
+        size = displacement >= INT8_MIN && displacement <= INT8_MAX ? 1 : 4;
+
+    encoder_emit(encoding, encoder_modrm(size == 4 ? 2 : size, reg,
+                                         sib ? 4 : base));
+    if (sib) {
+        uint8_t scale = memory->index ? __builtin_ctz(memory->scale) : 0;
+        uint8_t index = memory->index ? memory->index->number : 4;
+        encoder_emit(encoding, encoder_modrm(scale, index, base));
+    }
+    encoder_emit_value(encoding, displacement, size);
+}
+
+static void encoder_emit_form(encoding_t *encoding,
+                              const instruction_form_t *form,
+                              const operand_t *operands) {
+    const operand_t *reg =
+        form->reg_operand != -1 ? &operands[form->reg_operand] : nullptr;
+    const operand_t *rm =
+        form->rm_operand != -1 ? &operands[form->rm_operand] : nullptr;
+    const operand_t *immediate = form->immediate_operand != -1
+                                     ? &operands[form->immediate_operand]
+                                     : nullptr;
+
+    uint8_t rex_bits = form->rex_w ? rex_w : 0;
+    bool needs_rex = false;
+    bool address_size = false;
+    if (reg) {
+        if (reg->reg->number & 8)
+            rex_bits |= form->opcode_register ? rex_b : rex_r;
+        needs_rex = needs_rex || reg->reg->rex;
+    }
+    if (rm && rm->kind == OPERAND_KIND_REGISTER) {
+        if (rm->reg->number & 8)
+            rex_bits |= rex_b;
+        needs_rex = needs_rex || rm->reg->rex;
+    } else if (rm && rm->base) {
+        if (rm->base->number & 8)
+            rex_bits |= rex_b;
+        if (rm->index && rm->index->number & 8)
+            rex_bits |= rex_x;
+        address_size = rm->base->size == 32;
+    }
+
+    *encoding = (encoding_t){};
+    if (address_size)
+        encoder_emit(encoding, prefix_address_size);
+    if (form->operand_size_prefix)
+        encoder_emit(encoding, prefix_operand_size);
+    if (rex_bits || needs_rex)
+        encoder_emit(encoding, rex | rex_bits);
+
+    for (size_t i = 0; i < form->opcode_length; ++i) {
+        uint8_t opcode = form->opcode[i];
+        if (form->opcode_register && i + 1 == form->opcode_length)
+            opcode += reg->reg->number & 7;
+        encoder_emit(encoding, opcode);
+    }
+
+    if (form->modrm != modrm_none) {
+        uint8_t field =
+            form->modrm == modrm_register ? reg->reg->number : form->modrm;
+        if (rm->kind == OPERAND_KIND_REGISTER)
+            encoder_emit(encoding, encoder_modrm(3, field, rm->reg->number));
+        else
+            encoder_emit_memory(encoding, field, rm);
+    }
+
+    if (immediate && immediate->label)
+        encoder_emit_label(encoding, immediate, form->immediate_size,
+                           form->relative, form->immediate_signed);
+    else if (immediate)
+        encoder_emit_value(encoding, immediate->immediate,
+                           form->immediate_size);
+}
+
+// The instructions a conditional branch can fuse with, after the Intel
+// optimization manual. Which conditions fuse differs between them and between
+// processors, all are treated as fusing.
+static const char *encoder_fusible[] = {"cmp", "test", "add", "sub",
+                                        "and", "inc", "dec"};
+
+static flow_t encoder_flow(const char *mnemonic) {
+    if (strcmp(mnemonic, "jmp") == 0 || strcmp(mnemonic, "call") == 0 ||
+        strcmp(mnemonic, "ret") == 0)
+        return FLOW_UNCONDITIONAL;
+    // Every other mnemonic starting with j is a conditional branch
+    if (mnemonic[0] == 'j')
+        return FLOW_CONDITIONAL;
+    for (size_t i = 0; i < sizeof(encoder_fusible) / sizeof(*encoder_fusible);
+         ++i)
+        if (strcmp(mnemonic, encoder_fusible[i]) == 0)
+            return FLOW_FUSIBLE;
+    return FLOW_NONE;
+}
+
+error_t *encoder_cache_alloc(encoder_cache_t **output) {
+    *output = nullptr;
+
+    encoder_cache_t *cache = calloc(1, sizeof(encoder_cache_t));
+    if (cache == nullptr)
+        return err_allocation_failed;
+
+    *output = cache;
+    return nullptr;
+}
+
+void encoder_cache_free(encoder_cache_t *cache) {
+    free(cache);
+}
+
+static uint64_t encoder_mix(uint64_t hash, uint64_t value) {
+    hash = (hash ^ value) * 0x9e3779b97f4a7c15;
+    return hash ^ (hash >> 29);
+}
+
+static uint64_t encoder_hash(const instruction_t *instruction,
+                             const operand_t *operands, size_t count) {
+    uint64_t hash = encoder_mix(0, (uintptr_t)instruction);
+    for (size_t i = 0; i < count; ++i) {
+        const operand_t *operand = &operands[i];
+        hash = encoder_mix(hash, operand->kind);
+        hash = encoder_mix(hash, (uintptr_t)operand->reg);
+        hash = encoder_mix(hash, (uintptr_t)operand->base);
+        hash = encoder_mix(hash, (uintptr_t)operand->index);
+        hash = encoder_mix(hash, operand->displacement);
+        hash = encoder_mix(hash, operand->immediate);
+        hash = encoder_mix(hash, operand->scale |
+                                     operand->displacement_size << 8 |
+                                     operand->immediate_size << 16);
+    }
+    return hash;
+}
+
+// Compares field by field, the padding of operands isn't initialized
+static bool encoder_same_operands(const operand_t *first,
+                                  const operand_t *second, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const operand_t *a = &first[i], *b = &second[i];
+        if (a->kind != b->kind || a->reg != b->reg || a->base != b->base ||
+            a->index != b->index || a->scale != b->scale ||
+            a->displacement != b->displacement ||
+            a->immediate != b->immediate ||
+            a->displacement_size != b->displacement_size ||
+            a->immediate_size != b->immediate_size)
+            return false;
+    }
+    return true;
+}
+
+error_t *encoder_encode(ast_node_t *instruction, encoding_t *encoding) {
+    return encoder_encode_cached(instruction, nullptr, encoding);
+}
+
+error_t *encoder_encode_cached(ast_node_t *instruction, encoder_cache_t *cache,
+                               encoding_t *encoding) {
+    ast_node_t *mnemonic = ast_node_child(instruction, 0);
+    ast_node_t *operand_nodes = ast_node_child(instruction, 1);
+
+    const instruction_t *entry =
+        instruction_lookup(mnemonic->token_entry->token.value);
+    if (entry == nullptr)
+        return err_encoder_unknown_mnemonic;
+    if (operand_nodes->len > instruction_max_operands)
+        return err_encoder_operands;
+
+    operand_t operands[instruction_max_operands];
+    size_t count = operand_nodes->len;
+    size_t labels = 0;
+    for (size_t i = 0; i < count; ++i) {
+        error_t *err = encoder_read_operand(
+            ast_node_child(operand_nodes, i), &operands[i]);
+        if (err)
+            return err;
+        labels += operands[i].label != nullptr;
+    }
+    if (labels > 1)
+        return err_encoder_label;
+
+    encoder_cache_entry_t *cached = nullptr;
+    if (cache && labels) {
+        cache->bypasses += 1;
+    } else if (cache) {
+        uint64_t hash = encoder_hash(entry, operands, count);
+        cached = &cache->entries[hash & (encoder_cache_size - 1)];
+        if (cached->instruction == entry && cached->operand_count == count &&
+            encoder_same_operands(cached->operands, operands, count)) {
+            cache->hits += 1;
+            *encoding = cached->encoding;
+            return nullptr;
+        }
+        cache->misses += 1;
+    }
+
+    const instruction_form_t *form = nullptr;
+    for (size_t i = 0; i < entry->form_count && form == nullptr; ++i)
+        if (encoder_matches(&entry->forms[i], operands, count))
+            form = &entry->forms[i];
+    if (form == nullptr)
+        return encoder_no_match(operands, count);
+
+    encoder_emit_form(encoding, form, operands);
+    // Labels always match rel8 first, the table has the rel32 form right after
+    if (form->operand_count == 1 && form->operands[0] == OPERAND_REL8) {
+        const instruction_form_t *long_form = form + 1;
+        encoding->long_opcode_length = long_form->opcode_length;
+        for (size_t i = 0; i < long_form->opcode_length; ++i)
+            encoding->long_opcode[i] = long_form->opcode[i];
+    }
+    encoding->flow = encoder_flow(entry->mnemonic);
+
+    if (cached) {
+        cached->instruction = entry;
+        cached->operand_count = count;
+        for (size_t i = 0; i < count; ++i)
+            cached->operands[i] = operands[i];
+        cached->encoding = *encoding;
+    }
+    return nullptr;
+}
+
+// The recommended NOPs of 1 to 10 bytes, longer ones repeat the operand size
+// prefix in front of the 10 byte NOP
+static const uint8_t encoder_nop_forms[][10] = {
+    {0x90},
+    {0x66, 0x90},
+    {0x0f, 0x1f, 0x00},
+    {0x0f, 0x1f, 0x40, 0x00},
+    {0x0f, 0x1f, 0x44, 0x00, 0x00},
+    {0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00},
+    {0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00},
+    {0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00},
+};
+
+constexpr size_t encoder_nop_forms_len =
+    sizeof(encoder_nop_forms) / sizeof(encoder_nop_forms[0]);
+
+static void encoder_nop(uint8_t *buffer, size_t len) {
+    size_t prefixes = 0;
+    if (len > encoder_nop_forms_len) {
+        prefixes = len - encoder_nop_forms_len;
+        memset(buffer, prefix_operand_size, prefixes);
+    }
+    memcpy(buffer + prefixes, encoder_nop_forms[len - prefixes - 1],
+           len - prefixes);
+}
+
+void encoder_nops(uint8_t *buffer, size_t len) {
+    if (len < encoding_max_length) {
+        if (len)
+            encoder_nop(buffer, len);
+        return;
+    }
+
+    // Long padding is mostly copies of the longest NOP
+    size_t remainder = len % encoding_max_length;
+    encoder_nop(buffer, encoding_max_length);
+    for (size_t i = encoding_max_length; i + remainder < len;
+         i += encoding_max_length)
+        memcpy(buffer + i, buffer, encoding_max_length);
+    if (remainder)
+        encoder_nop(buffer + len - remainder, remainder);
+}
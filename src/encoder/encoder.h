@@ -0,0 +1,179 @@
+#ifndef INCLUDE_ENCODER_ENCODER_H_
+#define INCLUDE_ENCODER_ENCODER_H_
+
+#include "../ast.h"
+#include "../error.h"
+#include "../tokenlist.h"
+#include "table.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* x86-64 instructions are at most 15 bytes long */
+constexpr size_t encoding_max_length = 15;
+
+/* How an instruction changes the flow of control, for keeping branches away
+ * from the boundaries the processor fetches and caches code at */
+typedef enum flow {
+    FLOW_NONE,
+    /* compares and arithmetic a conditional branch right after them fuses
+     * with into a single micro-op */
+    FLOW_FUSIBLE,
+    FLOW_CONDITIONAL,
+    /* jumps, calls and returns */
+    FLOW_UNCONDITIONAL,
+} flow_t;
+
+typedef struct encoding {
+    size_t len;
+    uint8_t bytes[encoding_max_length];
+    /* The label referenced by the instruction, nullptr if there is none. Its
+     * value is left zero: label_size bytes at label_offset are for the caller
+     * to fill in once the label's offset is known. */
+    tokenlist_entry_t *label;
+    /* added to the label's offset, with the offset of label_minus subtracted
+     * for a difference of labels, which is never relative */
+    int64_t label_addend;
+    tokenlist_entry_t *label_minus;
+    uint8_t label_offset;
+    uint8_t label_size;
+    /* the value is relative to the end of the instruction */
+    bool label_relative;
+    /* the processor sign extends the value to the operand size */
+    bool label_signed;
+    /* Branches are encoded in their short form with a 1 byte displacement.
+     * If the label turns out to be too far away, the opcode of the long form
+     * with a 4 byte displacement replaces the short opcode. long_opcode_length
+     * is 0 for every other instruction. */
+    uint8_t long_opcode_length;
+    uint8_t long_opcode[instruction_max_opcode];
+    flow_t flow;
+} encoding_t;
+
+/* An operand as the encoder reads it from the AST */
+typedef enum operand_kind {
+    OPERAND_KIND_REGISTER,
+    OPERAND_KIND_MEMORY,
+    OPERAND_KIND_IMMEDIATE,
+    OPERAND_KIND_LABEL,
+    OPERAND_KIND_LABEL_MEMORY,
+} operand_kind_t;
+
+typedef struct operand {
+    operand_kind_t kind;
+    const register_info_t *reg;
+    /* memory operands, index is nullptr without an index register */
+    const register_info_t *base;
+    const register_info_t *index;
+    uint8_t scale;
+    int64_t displacement;
+    uint64_t immediate;
+    /* size suffixes of the displacement and the immediate in bits, 0 picks
+     * the shortest encoding */
+    int displacement_size;
+    int immediate_size;
+    /* label operands and memory operands addressing a label, plus addend and
+     * minus the label minus for differences */
+    tokenlist_entry_t *label;
+    int64_t addend;
+    tokenlist_entry_t *minus;
+} operand_t;
+
+/* The cache holds this many encodings, a power of two */
+constexpr size_t encoder_cache_size = 1024;
+
+/* A previous encoding of an instruction and the operands it had */
+typedef struct encoder_cache_entry {
+    /* nullptr for an empty entry */
+    const instruction_t *instruction;
+    size_t operand_count;
+    operand_t operands[instruction_max_operands];
+    encoding_t encoding;
+} encoder_cache_entry_t;
+
+/* Generated code repeats the same instructions with the same operands over
+ * and over. The cache remembers their encodings by the instruction and its
+ * operands as the encoder reads them, so a repeated instruction skips
+ * matching the forms and emitting the bytes. Every entry has one place in
+ * the cache, a new instruction replaces the one that was there. Instructions
+ * referencing labels aren't cached. */
+typedef struct encoder_cache {
+    size_t hits;
+    size_t misses;
+    /* instructions referencing a label, which bypass the cache */
+    size_t bypasses;
+    encoder_cache_entry_t entries[encoder_cache_size];
+} encoder_cache_t;
+
+extern error_t *err_encoder_unknown_mnemonic;
+extern error_t *err_encoder_operands;
+extern error_t *err_encoder_operand_size;
+extern error_t *err_encoder_memory;
+extern error_t *err_encoder_label;
+
+/**
+ * @brief Encode an instruction into x86-64 machine code
+ *
+ * The form is chosen from the instruction table generated from
+ * doc/instructions.txt: the first form of the mnemonic whose operand classes
+ * match the operands is encoded. The table lists shorter forms first, so a
+ * number picks the smallest immediate it fits in. Displacements are left out
+ * when they are zero and take a single byte when they fit. A :8, :16, :32 or
+ * :64 suffix on a number picks that size and nothing else.
+ *
+ * A label operand is encoded as a zero placeholder described by the label
+ * fields of the encoding, a memory operand naming a label is addressed
+ * relative to the instruction pointer.
+ *
+ * @param instruction A NODE_INSTRUCTION node as produced by the parser
+ * @param[out] encoding The encoded instruction
+ * @return error_t* nullptr on success, one of the err_encoder_* errors if the
+ *         instruction can't be encoded
+ */
+error_t *encoder_encode(ast_node_t *instruction, encoding_t *encoding);
+
+/**
+ * @brief Encode an instruction, reusing the encoding of an earlier one with
+ *        the same operands
+ *
+ * The same as encoder_encode. A cache is only ever used by one thread at a
+ * time.
+ *
+ * @param instruction A NODE_INSTRUCTION node as produced by the parser
+ * @param cache The cache to look the instruction up in and add it to,
+ *        nullptr to encode without one
+ * @param[out] encoding The encoded instruction
+ * @return error_t* see encoder_encode
+ */
+error_t *encoder_encode_cached(ast_node_t *instruction, encoder_cache_t *cache,
+                               encoding_t *encoding);
+
+/**
+ * @brief Allocate a new, empty cache of encodings
+ *
+ * @param[out] output Pointer to the allocated cache
+ * @return error_t* nullptr on success, allocation error on failure
+ */
+error_t *encoder_cache_alloc(encoder_cache_t **output);
+
+/**
+ * @brief Free the cache
+ *
+ * If cache is nullptr, the function returns without doing anything.
+ *
+ * @param cache The cache to free
+ */
+void encoder_cache_free(encoder_cache_t *cache);
+
+/**
+ * @brief Fill a buffer with as few NOP instructions as possible
+ *
+ * Uses the multi-byte NOPs recommended by the Intel and AMD manuals, made
+ * longer with operand size prefixes up to the 15 byte maximum, so padding
+ * costs a decode slot per 15 bytes instead of one per byte.
+ *
+ * @param buffer Receives len bytes of NOPs
+ * @param len Number of bytes to fill
+ */
+void encoder_nops(uint8_t *buffer, size_t len);
+
+#endif // INCLUDE_ENCODER_ENCODER_H_
@@ -0,0 +1,103 @@
+#ifndef INCLUDE_ENCODER_TABLE_H_
+#define INCLUDE_ENCODER_TABLE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* The instruction and register tables are generated from
+ * doc/instructions.txt by tools/encodergen.c, which also documents the
+ * meaning of the operand classes and encodings. Both lookups go through a
+ * perfect hash, so finding a mnemonic costs two hashes and one string
+ * comparison no matter how many instructions there are. */
+
+typedef enum operand_class {
+    OPERAND_R8,
+    OPERAND_R16,
+    OPERAND_R32,
+    OPERAND_R64,
+    OPERAND_RM8,
+    OPERAND_RM16,
+    OPERAND_RM32,
+    OPERAND_RM64,
+    OPERAND_M,
+    /* the accumulator, implied by the opcode */
+    OPERAND_AL,
+    OPERAND_AX,
+    OPERAND_EAX,
+    OPERAND_RAX,
+    /* the count register of the shifts, implied by the opcode */
+    OPERAND_CL,
+    /* the number 1, implied by the opcode */
+    OPERAND_ONE,
+    OPERAND_IMM8,
+    OPERAND_IMM16,
+    OPERAND_IMM32,
+    OPERAND_IMM64,
+    OPERAND_REL8,
+    OPERAND_REL32,
+} operand_class_t;
+
+constexpr size_t instruction_max_operands = 3;
+constexpr size_t instruction_max_opcode = 3;
+
+/* Values of instruction_form_t.modrm besides the opcode extensions 0-7 */
+constexpr int8_t modrm_none = -1;
+constexpr int8_t modrm_register = 8;
+
+typedef struct instruction_form {
+    uint8_t operand_count;
+    operand_class_t operands[instruction_max_operands];
+    bool operand_size_prefix;
+    bool rex_w;
+    uint8_t opcode_length;
+    uint8_t opcode[instruction_max_opcode];
+    /* the register of reg_operand is added to the last opcode byte */
+    bool opcode_register;
+    /* modrm_none, an opcode extension or modrm_register */
+    int8_t modrm;
+    /* operand indices, -1 if the form has no such operand */
+    int8_t reg_operand;
+    int8_t rm_operand;
+    int8_t immediate_operand;
+    /* immediate or relative displacement size in bytes */
+    uint8_t immediate_size;
+    /* operand size in bits, the size of the immediate for forms without
+     * other operands unless the form defaults to 64 bits */
+    uint8_t operand_size;
+    /* the immediate is sign extended to the larger operand size */
+    bool immediate_signed;
+    bool relative;
+} instruction_form_t;
+
+typedef struct instruction {
+    const char *mnemonic;
+    size_t form_count;
+    const instruction_form_t *forms;
+} instruction_t;
+
+typedef struct register_info {
+    const char *name;
+    /* size in bits */
+    uint8_t size;
+    uint8_t number;
+    /* only encodable with a REX prefix, even if no REX bit is set */
+    bool rex;
+} register_info_t;
+
+/**
+ * @brief Find the forms of an instruction
+ *
+ * @param mnemonic The instruction mnemonic
+ * @return const instruction_t* The instruction, nullptr if it is unknown
+ */
+const instruction_t *instruction_lookup(const char *mnemonic);
+
+/**
+ * @brief Find a register by name
+ *
+ * @param name The register name
+ * @return const register_info_t* The register, nullptr if it is unknown
+ */
+const register_info_t *register_lookup(const char *name);
+
+#endif // INCLUDE_ENCODER_TABLE_H_
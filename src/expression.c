@@ -0,0 +1,393 @@
+#include "expression.h"
+#include "error.h"
+#include <string.h>
+
+error_t *err_expression_division =
+    &(error_t){.message = "Division by zero in expression"};
+error_t *err_expression_relocatable = &(error_t){
+    .message = "Expression isn't a number, a label plus a number or the "
+               "difference of two labels plus a number"};
+error_t *err_expression_number =
+    &(error_t){.message = "Displacement has to be a number"};
+error_t *err_expression_constant = &(error_t){
+    .message = "Expression may only use numbers and defined names"};
+
+/* Longer sums of labels are fine as long as they cancel out in the end */
+constexpr size_t expression_labels_cap = 8;
+
+typedef struct expression_label {
+    /* the NODE_LABEL_REFERENCE or NODE_DOLLAR term */
+    ast_node_t *term;
+    int64_t coefficient;
+} expression_label_t;
+
+/* The value of a subexpression as a number plus a multiple of each label */
+typedef struct expression_value {
+    uint64_t constant;
+    size_t len;
+    expression_label_t labels[expression_labels_cap];
+} expression_value_t;
+
+typedef struct expression_fold {
+    /* where the error is */
+    tokenlist_entry_t *token;
+    /* the values of names in constant expressions, nullptr when names are
+     * labels */
+    const symbols_t *constants;
+} expression_fold_t;
+
+static error_t *expression_evaluate(expression_fold_t *fold,
+                                    ast_node_t *expression, bool negate,
+                                    expression_value_t *output);
+
+// The first token of a subtree, the number and expression nodes have none
+static tokenlist_entry_t *expression_token(ast_node_t *node) {
+    while (node->token_entry == nullptr && node->len)
+        node = ast_node_child(node, 0);
+    return node->token_entry;
+}
+
+static bool expression_same_label(const ast_node_t *a, const ast_node_t *b) {
+    if (a->id != b->id)
+        return false;
+    return a->id == NODE_DOLLAR || strcmp(a->token_entry->token.value,
+                                          b->token_entry->token.value) == 0;
+}
+
+static void expression_drop_zeros(expression_value_t *value) {
+    size_t len = 0;
+    for (size_t i = 0; i < value->len; ++i)
+        if (value->labels[i].coefficient != 0)
+            value->labels[len++] = value->labels[i];
+    value->len = len;
+}
+
+static void expression_scale(expression_value_t *value, uint64_t factor) {
+    value->constant *= factor;
+    for (size_t i = 0; i < value->len; ++i)
+        value->labels[i].coefficient =
+            (uint64_t)value->labels[i].coefficient * factor;
+    expression_drop_zeros(value);
+}
+
+// Adds or subtracts right from left
+static error_t *expression_add(expression_fold_t *fold, ast_node_t *operator,
+                               expression_value_t *left,
+                               const expression_value_t *right,
+                               bool subtract) {
+    uint64_t sign = subtract ? UINT64_MAX : 1;
+    left->constant += right->constant * sign;
+    for (size_t i = 0; i < right->len; ++i) {
+        const expression_label_t *label = &right->labels[i];
+        int64_t coefficient = (uint64_t)label->coefficient * sign;
+        size_t j = 0;
+        while (j < left->len &&
+               !expression_same_label(left->labels[j].term, label->term))
+            j++;
+        if (j < left->len) {
+            left->labels[j].coefficient =
+                (uint64_t)left->labels[j].coefficient + coefficient;
+            continue;
+        }
+        if (left->len == expression_labels_cap) {
+            fold->token = operator->token_entry;
+            return err_expression_relocatable;
+        }
+        left->labels[left->len++] =
+            (expression_label_t){.term = label->term,
+                                 .coefficient = coefficient};
+    }
+    expression_drop_zeros(left);
+    return nullptr;
+}
+
+static error_t *expression_apply(expression_fold_t *fold, ast_node_t *operator,
+                                 expression_value_t *left,
+                                 const expression_value_t *right) {
+    switch (operator->id) {
+    case NODE_PLUS:
+        return expression_add(fold, operator, left, right, false);
+    case NODE_MINUS:
+        return expression_add(fold, operator, left, right, true);
+    case NODE_ASTERISK:
+        // Labels can be scaled by numbers, they cancel out later or the
+        // expression can't be folded
+        if (left->len == 0) {
+            uint64_t factor = left->constant;
+            *left = *right;
+            expression_scale(left, factor);
+            return nullptr;
+        }
+        if (right->len == 0) {
+            expression_scale(left, right->constant);
+            return nullptr;
+        }
+        break;
+    default:
+        break;
+    }
+
+    fold->token = operator->token_entry;
+    if (left->len || right->len)
+        return err_expression_relocatable;
+    // Numbers are signed like in GNU as, division truncates toward zero and
+    // shifting right keeps the sign
+    uint64_t a = left->constant, b = right->constant;
+    switch (operator->id) {
+    case NODE_SLASH:
+        if (b == 0)
+            return err_expression_division;
+        // The only quotient that overflows wraps around to the dividend
+        left->constant = (int64_t)a == INT64_MIN && (int64_t)b == -1
+                             ? a
+                             : (uint64_t)((int64_t)a / (int64_t)b);
+        break;
+    case NODE_SHIFT_LEFT:
+        left->constant = b < 64 ? a << b : 0;
+        break;
+    case NODE_SHIFT_RIGHT:
+        left->constant = (uint64_t)((int64_t)a >> (b < 64 ? b : 63));
+        break;
+    case NODE_AMPERSAND:
+        left->constant = a & b;
+        break;
+    default:
+        left->constant = a | b;
+        break;
+    }
+    return nullptr;
+}
+
+static error_t *expression_term(expression_fold_t *fold, ast_node_t *term,
+                                expression_value_t *output) {
+    *output = (expression_value_t){};
+    switch (term->id) {
+    case NODE_NUMBER:
+        output->constant = ast_node_child(term, 0)->value.integer.value;
+        return nullptr;
+    case NODE_LABEL_REFERENCE:
+    case NODE_DOLLAR:
+        if (fold->constants) {
+            const symbol_t *symbol =
+                term->id == NODE_LABEL_REFERENCE
+                    ? symbols_find(fold->constants,
+                                   term->token_entry->token.value)
+                    : nullptr;
+            if (symbol == nullptr) {
+                fold->token = term->token_entry;
+                return err_expression_constant;
+            }
+            output->constant = symbol->offset;
+            return nullptr;
+        }
+        output->len = 1;
+        output->labels[0] = (expression_label_t){.term = term,
+                                                 .coefficient = 1};
+        return nullptr;
+    case NODE_UNARY: {
+        ast_node_t *operator = ast_node_child(term, 0);
+        error_t *err = expression_term(fold, ast_node_child(term, 1), output);
+        if (err)
+            return err;
+        if (operator->id == NODE_MINUS) {
+            expression_scale(output, UINT64_MAX);
+            return nullptr;
+        }
+        if (output->len) {
+            fold->token = operator->token_entry;
+            return err_expression_relocatable;
+        }
+        output->constant = ~output->constant;
+        return nullptr;
+    }
+    default:
+        // <lparen> <expression> <rparen>
+        return expression_evaluate(fold, ast_node_child(term, 1), false,
+                                   output);
+    }
+}
+
+static int expression_precedence(const ast_node_t *operation) {
+    switch (ast_node_child(operation, 0)->id) {
+    case NODE_PIPE:
+        return 1;
+    case NODE_AMPERSAND:
+        return 2;
+    case NODE_SHIFT_LEFT:
+    case NODE_SHIFT_RIGHT:
+        return 3;
+    case NODE_PLUS:
+    case NODE_MINUS:
+        return 4;
+    default:
+        return 5;
+    }
+}
+
+// Applies the operations from *index on that bind at least as strongly as
+// minimum to left. Operations that bind more strongly than the one before
+// them are applied to its right side first.
+static error_t *expression_climb(expression_fold_t *fold,
+                                 ast_node_t *expression, size_t *index,
+                                 expression_value_t *left, int minimum) {
+    while (*index < expression->len) {
+        ast_node_t *operation = ast_node_child(expression, *index);
+        int precedence = expression_precedence(operation);
+        if (precedence < minimum)
+            return nullptr;
+        *index += 1;
+
+        expression_value_t right;
+        error_t *err =
+            expression_term(fold, ast_node_child(operation, 1), &right);
+        while (err == nullptr && *index < expression->len &&
+               expression_precedence(ast_node_child(expression, *index)) >
+                   precedence)
+            err = expression_climb(fold, expression, index, &right,
+                                   precedence + 1);
+        if (err == nullptr)
+            err = expression_apply(fold, ast_node_child(operation, 0), left,
+                                   &right);
+        if (err)
+            return err;
+    }
+    return nullptr;
+}
+
+static error_t *expression_evaluate(expression_fold_t *fold,
+                                    ast_node_t *expression, bool negate,
+                                    expression_value_t *output) {
+    error_t *err = expression_term(fold, ast_node_child(expression, 0), output);
+    if (err)
+        return err;
+    if (negate)
+        expression_scale(output, UINT64_MAX);
+    size_t index = 1;
+    return expression_climb(fold, expression, &index, output, 0);
+}
+
+// Replaces the expression in the slot with the node it folds into
+static error_t *expression_fold_slot(expression_fold_t *fold,
+                                     ast_node_t **slot, bool negate,
+                                     bool number) {
+    ast_node_t *expression = *slot;
+    if (expression->id != NODE_EXPRESSION)
+        return nullptr;
+
+    ast_node_t *first = ast_node_child(expression, 0);
+    if (expression->len == 1 &&
+        (first->id == NODE_NUMBER || first->id == NODE_LABEL_REFERENCE)) {
+        if (number && first->id != NODE_NUMBER) {
+            fold->token = first->token_entry;
+            return err_expression_number;
+        }
+        *slot = first;
+        expression->len = 0;
+        ast_node_free(expression);
+        return nullptr;
+    }
+
+    expression_value_t value;
+    error_t *err = expression_evaluate(fold, expression, negate, &value);
+    if (err)
+        return err;
+
+    // The label that is added and the one that is subtracted
+    const expression_label_t *plus = nullptr, *minus = nullptr;
+    bool relocatable = true;
+    for (size_t i = 0; i < value.len; ++i) {
+        const expression_label_t *label = &value.labels[i];
+        if (label->coefficient == 1 && plus == nullptr)
+            plus = label;
+        else if (label->coefficient == -1 && minus == nullptr)
+            minus = label;
+        else
+            relocatable = false;
+    }
+    if (value.len && (number || !relocatable || plus == nullptr)) {
+        fold->token = expression_token(expression);
+        return number ? err_expression_number : err_expression_relocatable;
+    }
+
+    ast_node_t *node;
+    err = ast_node_alloc(&node);
+    if (err)
+        return err;
+    if (value.len) {
+        node->id = NODE_LABEL_REFERENCE;
+        node->token_entry = plus->term->token_entry;
+        node->value.reference.minus = minus ? minus->term->token_entry
+                                            : nullptr;
+        node->value.reference.addend = value.constant;
+    } else {
+        node->id = NODE_NUMBER;
+        expression->value.integer.value = value.constant;
+        expression->value.integer.size = 0;
+    }
+    err = ast_node_add_child(node, expression);
+    if (err) {
+        ast_node_free(node);
+        return err;
+    }
+    *slot = node;
+    return nullptr;
+}
+
+static error_t *expression_fold_operand(expression_fold_t *fold,
+                                        ast_node_t *operand) {
+    if (operand->id == NODE_IMMEDIATE)
+        return expression_fold_slot(fold, ast_node_child_slot(operand, 0),
+                                    false, false);
+    if (operand->id != NODE_MEMORY)
+        return nullptr;
+
+    ast_node_t **slot = ast_node_child_slot(operand, 1);
+    if ((*slot)->id != NODE_REGISTER_EXPRESSION)
+        return expression_fold_slot(fold, slot, false, false);
+    ast_node_t *offset = ast_node_child(*slot, (*slot)->len - 1);
+    if (offset->id != NODE_REGISTER_OFFSET)
+        return nullptr;
+    bool negative = ast_node_child(offset, 0)->id == NODE_MINUS;
+    return expression_fold_slot(fold, ast_node_child_slot(offset, 1),
+                                negative, true);
+}
+
+error_t *expression_fold(ast_node_t *statement, tokenlist_entry_t **token) {
+    ast_node_t *operands = nullptr;
+    if (statement->id == NODE_INSTRUCTION && statement->len >= 2)
+        operands = ast_node_child(statement, 1);
+    else if (statement->id == NODE_DIRECTIVE &&
+             ast_node_child(statement, 1)->id == NODE_DATA_DIRECTIVE)
+        operands = ast_node_child(statement, 1);
+    if (operands == nullptr)
+        return nullptr;
+    return expression_fold_operands(operands, token);
+}
+
+error_t *expression_fold_operands(ast_node_t *operands,
+                                  tokenlist_entry_t **token) {
+    expression_fold_t fold = {};
+    for (size_t i = 0; i < operands->len; ++i) {
+        error_t *err =
+            expression_fold_operand(&fold, ast_node_child(operands, i));
+        if (err) {
+            *token = fold.token;
+            return err;
+        }
+    }
+    return nullptr;
+}
+
+error_t *expression_constant(ast_node_t *expression,
+                             const symbols_t *constants, uint64_t *value,
+                             tokenlist_entry_t **token) {
+    expression_fold_t fold = {.constants = constants};
+    expression_value_t output;
+    error_t *err = expression_evaluate(&fold, expression, false, &output);
+    if (err) {
+        *token = fold.token;
+        return err;
+    }
+    *value = output.constant;
+    return nullptr;
+}
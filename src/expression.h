@@ -0,0 +1,81 @@
+#ifndef INCLUDE_SRC_EXPRESSION_H_
+#define INCLUDE_SRC_EXPRESSION_H_
+
+#include "ast.h"
+#include "error.h"
+#include "symbols.h"
+#include "tokenlist.h"
+
+/* Expressions in operands are folded right after their statement is parsed,
+ * so everything after the parser sees the same numbers and label references
+ * it would without them. The parser keeps the operators of an expression in
+ * a flat list, folding gives them their precedence: | binds weakest, then &,
+ * the shifts, + and -, and * and / bind strongest. Division and right shifts
+ * are unsigned, arithmetic wraps around at 64 bits. $ is the offset of the
+ * statement.
+ *
+ * An expression of nothing but numbers folds into a NODE_NUMBER. Otherwise
+ * it has to reduce to a label plus a number or to the difference of two
+ * labels plus a number, which folds into a NODE_LABEL_REFERENCE naming the
+ * first label with the rest in value.reference, so the value of a reference
+ * is a single addition once the labels are known. Either node keeps the
+ * expression as its only child, the folded number is the value of the
+ * expression node itself, where numbers have it in their token node. An
+ * expression of a single number or label reference is replaced by just that.
+ *
+ * The displacement of a register expression has to fold into a number. Its
+ * sign negates the first term of the expression, the folded number is the
+ * displacement with that sign applied. */
+
+extern error_t *err_expression_division;
+extern error_t *err_expression_relocatable;
+extern error_t *err_expression_number;
+extern error_t *err_expression_constant;
+
+/**
+ * @brief Fold the expressions in the operands of an instruction or the values
+ *        of a data directive
+ *
+ * @param statement The statement, other statements are left alone
+ * @param[out] token The token to report an expression error at
+ * @return error_t* nullptr on success, err_expression_* for expressions that
+ *         can't be folded or an allocation error, in which case expressions
+ *         may be left unfolded
+ */
+error_t *expression_fold(ast_node_t *statement, tokenlist_entry_t **token);
+
+/**
+ * @brief Fold the expressions in a NODE_OPERANDS node, like expression_fold
+ *        does for the operands of an instruction
+ *
+ * @param operands The operands
+ * @param[out] token The token to report an expression error at
+ * @return error_t* nullptr on success, err_expression_* for expressions that
+ *         can't be folded or an allocation error
+ */
+error_t *expression_fold_operands(ast_node_t *operands,
+                                  tokenlist_entry_t **token);
+
+/**
+ * @brief Evaluate an expression whose names stand for numbers, not labels
+ *
+ * @param expression A NODE_EXPRESSION
+ * @param constants The value of every name the expression may use, as the
+ *        offset of its symbol
+ * @param[out] value The value of the expression
+ * @param[out] token The token to report an error at
+ * @return error_t* nullptr on success, err_expression_constant for names
+ *         that aren't constants and $, err_expression_division
+ */
+error_t *expression_constant(ast_node_t *expression,
+                             const symbols_t *constants, uint64_t *value,
+                             tokenlist_entry_t **token);
+
+/**
+ * @brief Whether a NODE_NUMBER is a folded expression rather than a literal
+ */
+static inline bool expression_folded(const ast_node_t *number) {
+    return ast_node_child(number, 0)->id == NODE_EXPRESSION;
+}
+
+#endif // INCLUDE_SRC_EXPRESSION_H_
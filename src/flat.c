@@ -0,0 +1,188 @@
+#include "flat.h"
+#include "error.h"
+#include "symbols.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/* The binary is the code of every section at its base address with zeros in
+ * between. Only the base addresses are computed up front, the size of the
+ * binary follows from the last one. The references the object writer leaves
+ * to the linker are resolved against the address the binary is loaded at plus
+ * the base addresses. */
+
+error_t *err_flat_range =
+    &(error_t){.message = "Value doesn't fit where it goes in the binary"};
+
+static size_t flat_align(size_t value, size_t align) {
+    return align > 1 ? (value + align - 1) & ~(align - 1) : value;
+}
+
+// Base address of every section, returns the size of the binary
+static size_t flat_layout(const assembler_t *assembler, size_t *bases) {
+    size_t size = 0;
+    for (size_t i = 0; i < assembler->sections_len; ++i) {
+        const section_t *section = &assembler->sections[i];
+        bases[i] = flat_align(size, section->alignment);
+        size = bases[i] + section->len;
+    }
+    return size;
+}
+
+// The value of a relocation of the section, false if it doesn't fit
+static bool flat_value(const assembler_t *assembler, uint64_t address,
+                       const size_t *bases, size_t section,
+                       const relocation_t *relocation, uint64_t *value) {
+    int64_t target =
+        (int64_t)(address + bases[relocation->section]) + relocation->addend;
+    if (relocation->label->token.id != TOKEN_DOLLAR) {
+        const symbol_t *symbol =
+            symbols_find(assembler->symbols, relocation->label->token.value);
+        target = (int64_t)(address + bases[symbol->section] + symbol->offset) +
+                 relocation->addend;
+    }
+    int64_t position =
+        (int64_t)(address + bases[section] + relocation->position);
+    switch (relocation->kind) {
+    case RELOCATION_RELATIVE_8:
+        *value = target - position;
+        return target - position >= INT8_MIN && target - position <= INT8_MAX;
+    case RELOCATION_RELATIVE_32:
+        *value = target - position;
+        return target - position >= INT32_MIN &&
+               target - position <= INT32_MAX;
+    case RELOCATION_ABSOLUTE_32:
+        *value = target;
+        return target >= 0 && target <= UINT32_MAX;
+    case RELOCATION_ABSOLUTE_32S:
+        *value = target;
+        return target >= INT32_MIN && target <= INT32_MAX;
+    case RELOCATION_ABSOLUTE_64:
+        *value = target;
+        return true;
+    }
+    return false;
+}
+
+static size_t flat_value_size(relocation_kind_t kind) {
+    switch (kind) {
+    case RELOCATION_RELATIVE_8:
+        return 1;
+    case RELOCATION_ABSOLUTE_64:
+        return 8;
+    default:
+        return 4;
+    }
+}
+
+// Reports every relocation whose value doesn't fit, before anything is
+// written
+static error_t *flat_check(const assembler_t *assembler, uint64_t address,
+                           const size_t *bases, diagnostics_t *diagnostics) {
+    for (size_t i = 0; i < assembler->sections_len; ++i) {
+        const section_t *section = &assembler->sections[i];
+        for (size_t j = 0; j < section->relocations_len; ++j) {
+            uint64_t value;
+            if (flat_value(assembler, address, bases, i,
+                           &section->relocations[j], &value))
+                continue;
+            error_t *err =
+                diagnostics_add(diagnostics, section->relocations[j].label,
+                                err_flat_range->message);
+            if (err)
+                return err;
+        }
+    }
+    return nullptr;
+}
+
+// Copies the code of every section to its base address and fills in the
+// relocations, the gaps have to be zero already
+static void flat_fill(const assembler_t *assembler, uint64_t address,
+                      const size_t *bases, uint8_t *binary) {
+    for (size_t i = 0; i < assembler->sections_len; ++i) {
+        const section_t *section = &assembler->sections[i];
+        for (size_t offset = 0; offset < section->len;) {
+            size_t len;
+            const uint8_t *code = assembler_code(section, offset, &len);
+            memcpy(binary + bases[i] + offset, code, len);
+            offset += len;
+        }
+
+        for (size_t j = 0; j < section->relocations_len; ++j) {
+            const relocation_t *relocation = &section->relocations[j];
+            uint64_t value;
+            flat_value(assembler, address, bases, i, relocation, &value);
+            uint8_t *at = binary + bases[i] + relocation->position;
+            for (size_t k = 0; k < flat_value_size(relocation->kind); ++k)
+                at[k] = value >> (8 * k);
+        }
+    }
+}
+
+size_t flat_size(const assembler_t *assembler) {
+    size_t size = 0;
+    for (size_t i = 0; i < assembler->sections_len; ++i)
+        size = flat_align(size, assembler->sections[i].alignment) +
+               assembler->sections[i].len;
+    return size;
+}
+
+error_t *flat_load(const assembler_t *assembler, diagnostics_t *diagnostics,
+                   uint8_t *binary) {
+    size_t *bases = calloc(assembler->sections_len, sizeof(size_t));
+    if (bases == nullptr)
+        return err_allocation_failed;
+    flat_layout(assembler, bases);
+    uint64_t address = (uintptr_t)binary;
+    size_t before = diagnostics->len;
+    error_t *err = flat_check(assembler, address, bases, diagnostics);
+    if (err == nullptr && diagnostics->len == before)
+        flat_fill(assembler, address, bases, binary);
+    free(bases);
+    return err;
+}
+
+error_t *flat_write(const assembler_t *assembler, diagnostics_t *diagnostics,
+                    const char *path) {
+    size_t *bases = calloc(assembler->sections_len, sizeof(size_t));
+    if (bases == nullptr)
+        return err_allocation_failed;
+    size_t size = flat_layout(assembler, bases);
+    size_t before = diagnostics->len;
+    error_t *err = flat_check(assembler, 0, bases, diagnostics);
+    if (err || diagnostics->len != before) {
+        free(bases);
+        return err;
+    }
+
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0) {
+        free(bases);
+        return errorf("Failed to open file '%s': %s", path, strerror(errno));
+    }
+    // The file gets its final size first, so the mapping covers all of it
+    // and nothing is written through a buffer of our own
+    if (ftruncate(fd, size) != 0) {
+        err = errorf("Write error: %s", strerror(errno));
+    } else if (size) {
+        void *binary =
+            mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (binary == MAP_FAILED) {
+            err = errorf("Failed to map file '%s': %s", path, strerror(errno));
+        } else {
+            flat_fill(assembler, 0, bases, binary);
+            if (munmap(binary, size) != 0)
+                err = errorf("Write error: %s", strerror(errno));
+        }
+    }
+    if (close(fd) != 0 && err == nullptr)
+        err = errorf("Write error: %s", strerror(errno));
+
+    free(bases);
+    return err;
+}
@@ -0,0 +1,58 @@
+#ifndef INCLUDE_SRC_FLAT_H_
+#define INCLUDE_SRC_FLAT_H_
+
+#include "assembler.h"
+#include "diagnostics.h"
+#include "error.h"
+
+extern error_t *err_flat_range;
+
+/**
+ * @brief Write the assembled program as a flat binary
+ *
+ * The sections follow each other in the order of their first directive, each
+ * at a multiple of its alignment, and the binary is loaded at address 0.
+ * Without a linker the references between sections and the absolute ones are
+ * filled in here, so every label must be defined. The file is sized up front
+ * and the code copied straight into a mapping of it, included files from
+ * their own mapping.
+ *
+ * @param assembler The assembler, after assembler_relax and assembler_finish
+ *        reported no undefined labels
+ * @param diagnostics Gets an err_flat_range diagnostic for every reference
+ *        whose value doesn't fit, nothing is written if there are any
+ * @param path Path of the binary, it is created or truncated
+ * @return error_t* nullptr on success, err_diagnostics_limit if the limit of
+ *         diagnostics is reached, an error if the file can't be written,
+ *         allocation error on failure
+ */
+error_t *flat_write(const assembler_t *assembler, diagnostics_t *diagnostics,
+                    const char *path);
+
+/**
+ * @brief Size of the flat binary of the assembled program
+ *
+ * @param assembler The assembler, after assembler_relax
+ * @return size_t Number of bytes from the first section to the end of the
+ *         last one
+ */
+size_t flat_size(const assembler_t *assembler);
+
+/**
+ * @brief Lay out the flat binary in memory, loaded where it is
+ *
+ * The same as flat_write, except that the binary is loaded at its own
+ * address instead of at 0.
+ *
+ * @param assembler The assembler, after assembler_relax and assembler_finish
+ *        reported no undefined labels
+ * @param diagnostics Gets an err_flat_range diagnostic for every reference
+ *        whose value doesn't fit, the binary is left as is if there are any
+ * @param binary flat_size bytes of zeros
+ * @return error_t* nullptr on success, err_diagnostics_limit if the limit of
+ *         diagnostics is reached, allocation error on failure
+ */
+error_t *flat_load(const assembler_t *assembler, diagnostics_t *diagnostics,
+                   uint8_t *binary);
+
+#endif // INCLUDE_SRC_FLAT_H_
@@ -0,0 +1,142 @@
+#include "include.h"
+#include "error.h"
+#include "lexer.h"
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+error_t *err_include_path = &(error_t){
+    .message = "Invalid include, expected .include followed by a quoted path"};
+error_t *err_include_read =
+    &(error_t){.message = "Included file can't be read"};
+error_t *err_include_depth =
+    &(error_t){.message = "Includes nest too deeply"};
+
+constexpr size_t includes_default_cap = 16;
+
+error_t *includes_alloc(includes_t **output, conditionals_t *conditionals) {
+    *output = nullptr;
+
+    includes_t *includes = calloc(1, sizeof(includes_t));
+    if (includes == nullptr)
+        return err_allocation_failed;
+    includes->conditionals = conditionals;
+
+    *output = includes;
+    return nullptr;
+}
+
+void includes_free(includes_t *includes) {
+    if (includes == nullptr)
+        return;
+    for (size_t i = 0; i < includes->len; ++i)
+        tokenlist_free(includes->files[i].list);
+    free(includes->files);
+    for (size_t i = 0; i < includes->paths_len; ++i)
+        free(includes->paths[i]);
+    free(includes->paths);
+    free(includes);
+}
+
+// Remembers the path for the dependencies unless it already is
+static error_t *includes_add_path(includes_t *includes, const char *path) {
+    for (size_t i = 0; i < includes->paths_len; ++i)
+        if (strcmp(includes->paths[i], path) == 0)
+            return nullptr;
+
+    if (includes->paths_len == includes->paths_cap) {
+        size_t new_cap = includes->paths_cap ? includes->paths_cap * 2
+                                             : includes_default_cap;
+        char **paths = realloc(includes->paths, new_cap * sizeof(char *));
+        if (paths == nullptr)
+            return err_allocation_failed;
+        includes->paths = paths;
+        includes->paths_cap = new_cap;
+    }
+    char *copy = strdup(path);
+    if (copy == nullptr)
+        return err_allocation_failed;
+    includes->paths[includes->paths_len++] = copy;
+    return nullptr;
+}
+
+static bool includes_same_file(const include_file_t *file,
+                               const struct stat *info) {
+    return file->device == (uint64_t)info->st_dev &&
+           file->inode == (uint64_t)info->st_ino &&
+           file->size == (uint64_t)info->st_size &&
+           file->modified_seconds == info->st_mtim.tv_sec &&
+           file->modified_nanoseconds == info->st_mtim.tv_nsec;
+}
+
+// Lexes the file into a new list
+static error_t *includes_lex(includes_t *includes, const char *path,
+                             tokenlist_t **output) {
+    *output = nullptr;
+
+    lexer_t *lex = &(lexer_t){};
+    error_t *err = lexer_open(lex, (char *)path);
+    if (err) {
+        error_free(err);
+        return err_include_read;
+    }
+    tokenlist_t *list;
+    err = tokenlist_alloc(&list);
+    if (err == nullptr)
+        err = conditionals_fill(includes->conditionals, list, lex);
+    lexer_close(lex);
+    if (err) {
+        tokenlist_free(list);
+        if (err == err_allocation_failed)
+            return err;
+        error_free(err);
+        return err_include_read;
+    }
+
+    *output = list;
+    return nullptr;
+}
+
+error_t *includes_get(includes_t *includes, const char *path,
+                      tokenlist_t **list) {
+    *list = nullptr;
+
+    struct stat info;
+    if (stat(path, &info) != 0 || !S_ISREG(info.st_mode))
+        return err_include_read;
+    error_t *err = includes_add_path(includes, path);
+    if (err)
+        return err;
+
+    for (size_t i = 0; i < includes->len; ++i) {
+        if (includes_same_file(&includes->files[i], &info)) {
+            *list = includes->files[i].list;
+            return nullptr;
+        }
+    }
+
+    if (includes->len == includes->cap) {
+        size_t new_cap = includes->cap ? includes->cap * 2
+                                       : includes_default_cap;
+        include_file_t *files =
+            realloc(includes->files, new_cap * sizeof(include_file_t));
+        if (files == nullptr)
+            return err_allocation_failed;
+        includes->files = files;
+        includes->cap = new_cap;
+    }
+    // A file that changed gets a new entry, statements may still reference
+    // the tokens of the old one
+    err = includes_lex(includes, path, list);
+    if (err)
+        return err;
+    includes->files[includes->len++] = (include_file_t){
+        .device = info.st_dev,
+        .inode = info.st_ino,
+        .size = info.st_size,
+        .modified_seconds = info.st_mtim.tv_sec,
+        .modified_nanoseconds = info.st_mtim.tv_nsec,
+        .list = *list,
+    };
+    return nullptr;
+}
@@ -0,0 +1,83 @@
+#ifndef INCLUDE_SRC_INCLUDE_H_
+#define INCLUDE_SRC_INCLUDE_H_
+
+#include "conditional.h"
+#include "error.h"
+#include "tokenlist.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* Included files are lexed once per process and kept as token lists, no
+ * matter how often they are included:
+ *
+ *     .include "path"
+ *
+ * expands to the lines of the file, see macros_next. The path is relative to
+ * the working directory like the one of .incbin. A file is known by its
+ * device and inode along with its size and modification time, so a header
+ * reached through different paths is shared and one that changed is lexed
+ * again. Conditional blocks in a file are decided when it is lexed and have
+ * to end in it.
+ *
+ * The lists live as long as the cache, statements parsed from them reference
+ * their tokens. Errors in included lines are reported with their line in the
+ * included file. */
+
+extern error_t *err_include_path;
+extern error_t *err_include_read;
+extern error_t *err_include_depth;
+
+typedef struct include_file {
+    /* what stat tells about the file when it was lexed */
+    uint64_t device;
+    uint64_t inode;
+    uint64_t size;
+    int64_t modified_seconds;
+    int64_t modified_nanoseconds;
+    tokenlist_t *list;
+} include_file_t;
+
+typedef struct includes {
+    /* decides the conditional blocks of the files, not owned */
+    conditionals_t *conditionals;
+    size_t len;
+    size_t cap;
+    include_file_t *files;
+    /* every path that was included, in the order they first were */
+    size_t paths_len;
+    size_t paths_cap;
+    char **paths;
+} includes_t;
+
+/**
+ * @brief Allocate a new, empty cache
+ *
+ * @param[out] output Pointer to the allocated cache
+ * @param conditionals Decides the conditional blocks of included files, it
+ *        has to outlive the cache
+ * @return error_t* nullptr on success, allocation error on failure
+ */
+error_t *includes_alloc(includes_t **output, conditionals_t *conditionals);
+
+/**
+ * @brief Free the cache along with the token lists of the files
+ *
+ * If includes is nullptr, the function returns without doing anything.
+ *
+ * @param includes The cache to free
+ */
+void includes_free(includes_t *includes);
+
+/**
+ * @brief Get the tokens of the file at path, lexing it unless it is cached
+ *
+ * @param includes The cache
+ * @param path The path of the file
+ * @param[out] list The tokens of the file, owned by the cache
+ * @return error_t* nullptr on success, err_include_read if the file can't be
+ *         read, allocation error on failure
+ */
+error_t *includes_get(includes_t *includes, const char *path,
+                      tokenlist_t **list);
+
+#endif // INCLUDE_SRC_INCLUDE_H_
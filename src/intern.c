@@ -0,0 +1,185 @@
+#include "intern.h"
+#include "error.h"
+#include <string.h>
+
+constexpr size_t intern_default_cap = 1024;
+
+constexpr uint64_t intern_fnv_offset = 0xcbf29ce484222325;
+constexpr uint64_t intern_fnv_prime = 0x100000001b3;
+
+error_t *intern_alloc(intern_t **output) {
+    *output = nullptr;
+
+    intern_t *intern = calloc(1, sizeof(intern_t));
+    if (intern == nullptr)
+        return err_allocation_failed;
+
+    *output = intern;
+    return nullptr;
+}
+
+void intern_free(intern_t *intern) {
+    if (intern == nullptr)
+        return;
+    for (size_t i = 0; i < intern->cap; ++i)
+        ast_node_free(intern->entries[i].node);
+    free(intern->entries);
+    free(intern);
+}
+
+static const char *intern_token_value(const ast_node_t *node) {
+    return node->token_entry ? node->token_entry->token.value : nullptr;
+}
+
+static uint64_t intern_mix(uint64_t hash, uint64_t value) {
+    return (hash ^ value) * intern_fnv_prime;
+}
+
+// FNV-1a over the id, the token value and the addresses of the children,
+// which are canonical already
+static uint64_t intern_hash(const ast_node_t *node) {
+    uint64_t hash = intern_mix(intern_fnv_offset, node->id);
+    const char *value = intern_token_value(node);
+    for (; value && *value; ++value)
+        hash = intern_mix(hash, (unsigned char)*value);
+    for (size_t i = 0; i < node->len; ++i)
+        hash = intern_mix(hash, (uintptr_t)ast_node_child(node, i));
+    return hash;
+}
+
+static bool intern_equal(const ast_node_t *a, const ast_node_t *b) {
+    if (a->id != b->id || a->len != b->len)
+        return false;
+
+    const char *a_value = intern_token_value(a);
+    const char *b_value = intern_token_value(b);
+    if ((a_value == nullptr) != (b_value == nullptr))
+        return false;
+    if (a_value && strcmp(a_value, b_value) != 0)
+        return false;
+
+    for (size_t i = 0; i < a->len; ++i)
+        if (ast_node_child(a, i) != ast_node_child(b, i))
+            return false;
+    return true;
+}
+
+static intern_entry_t *intern_probe(intern_entry_t *entries, size_t cap,
+                                    uint64_t hash, const ast_node_t *node) {
+    size_t mask = cap - 1;
+    for (size_t i = hash & mask;; i = (i + 1) & mask) {
+        intern_entry_t *entry = &entries[i];
+        if (entry->node == nullptr)
+            return entry;
+        if (entry->hash == hash && intern_equal(entry->node, node))
+            return entry;
+    }
+}
+
+static error_t *intern_grow(intern_t *intern) {
+    size_t new_cap = intern->cap ? intern->cap * 2 : intern_default_cap;
+    intern_entry_t *entries = calloc(new_cap, sizeof(intern_entry_t));
+    if (entries == nullptr)
+        return err_allocation_failed;
+
+    for (size_t i = 0; i < intern->cap; ++i) {
+        intern_entry_t *entry = &intern->entries[i];
+        if (entry->node == nullptr)
+            continue;
+        *intern_probe(entries, new_cap, entry->hash, entry->node) = *entry;
+    }
+
+    free(intern->entries);
+    intern->entries = entries;
+    intern->cap = new_cap;
+    return nullptr;
+}
+
+// Label references and $ stay with their statement, since the assembler
+// reports undefined labels and relocations at their tokens. So do the nodes
+// above them, whose children aren't all canonical.
+static bool intern_shareable(ast_node_t *node) {
+    if (node->id == NODE_LABEL_REFERENCE || node->id == NODE_DOLLAR)
+        return false;
+    for (size_t i = 0; i < node->len; ++i) {
+        ast_node_t *child = ast_node_child(node, i);
+        if (child && child->shared_count == 0)
+            return false;
+    }
+    return true;
+}
+
+// Interns a single node whose children are canonical already, unless it
+// can't be shared
+static error_t *intern_slot(intern_t *intern, ast_node_t **slot) {
+    if (!intern_shareable(*slot))
+        return nullptr;
+    // Keep the load factor at or below one half
+    if ((intern->len + 1) * 2 > intern->cap) {
+        error_t *err = intern_grow(intern);
+        if (err)
+            return err;
+    }
+
+    ast_node_t *node = *slot;
+    uint64_t hash = intern_hash(node);
+    intern_entry_t *entry =
+        intern_probe(intern->entries, intern->cap, hash, node);
+
+    if (entry->node == nullptr) {
+        // The table owns a reference to every canonical node
+        entry->hash = hash;
+        entry->node = ast_node_share(node);
+        intern->len += 1;
+    } else if (entry->node != node) {
+        ast_node_free(node);
+        *slot = ast_node_share(entry->node);
+    }
+    return nullptr;
+}
+
+static error_t *intern_skip_visit(ast_node_t *node, size_t depth,
+                                  void *data) {
+    (void)depth;
+    (void)data;
+    // Shared nodes come from the table, their subtree is canonical already
+    return node->shared_count ? err_ast_walk_skip : nullptr;
+}
+
+static error_t *intern_children_visit(ast_node_t *node, size_t depth,
+                                      void *data) {
+    (void)depth;
+    intern_t *intern = data;
+    for (size_t i = 0; i < node->len; ++i) {
+        ast_node_t **slot = ast_node_child_slot(node, i);
+        if (*slot == nullptr)
+            continue;
+        error_t *err = intern_slot(intern, slot);
+        if (err)
+            return err;
+    }
+    return nullptr;
+}
+
+error_t *intern_node(intern_t *intern, ast_node_t **node) {
+    if (*node == nullptr)
+        return nullptr;
+    error_t *err = ast_node_walk(*node, intern_skip_visit,
+                                 intern_children_visit, intern);
+    if (err)
+        return err;
+    return intern_slot(intern, node);
+}
+
+error_t *intern_statement(intern_t *intern, ast_node_t *statement) {
+    if (statement->id != NODE_INSTRUCTION || statement->len < 2)
+        return nullptr;
+
+    ast_node_t *operands = ast_node_child(statement, 1);
+    for (size_t i = 0; i < operands->len; ++i) {
+        error_t *err = intern_node(intern, ast_node_child_slot(operands, i));
+        if (err)
+            return err;
+    }
+    return nullptr;
+}
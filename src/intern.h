@@ -0,0 +1,76 @@
+#ifndef INCLUDE_SRC_INTERN_H_
+#define INCLUDE_SRC_INTERN_H_
+
+#include "ast.h"
+#include "error.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* An intern table hash-conses AST subtrees: structurally identical subtrees
+ * are replaced by one shared canonical instance. Subtrees are interned bottom
+ * up, so two nodes are identical when their id and token value match and
+ * their children are the very same canonical nodes. Once interned, equality of
+ * two subtrees is a pointer comparison.
+ *
+ * A canonical node keeps the token_entry of the first occurrence that was
+ * interned, so interned nodes can't be used to report source locations of
+ * later occurrences. Label references and $ are never shared for that reason,
+ * neither are the subtrees holding them: errors about labels are reported at
+ * the tokens naming them. Interned nodes are shared and must not be
+ * modified. */
+
+typedef struct intern_entry {
+    uint64_t hash;
+    ast_node_t *node;
+} intern_entry_t;
+
+typedef struct intern {
+    size_t len;
+    size_t cap;
+    intern_entry_t *entries;
+} intern_t;
+
+/**
+ * @brief Allocate a new, empty intern table
+ *
+ * @param[out] output Pointer to the allocated table
+ * @return error_t* nullptr on success, allocation error on failure
+ */
+error_t *intern_alloc(intern_t **output);
+
+/**
+ * @brief Release the table's ownership of all canonical nodes and free it
+ *
+ * Canonical nodes that are still used by a tree stay alive until that tree is
+ * freed. If intern is nullptr, the function returns without doing anything.
+ *
+ * @param intern The table to free
+ */
+void intern_free(intern_t *intern);
+
+/**
+ * @brief Replace a subtree with its canonical instance
+ *
+ * Interns every node in the subtree bottom up. Nodes that duplicate a
+ * canonical node are freed and the slot pointing to them is updated, so on
+ * return *node may point to a different, shared node.
+ *
+ * @param intern The table to intern into
+ * @param[in,out] node Slot holding the root of the subtree
+ * @return error_t* nullptr on success, allocation error on failure. On failure
+ *         the subtree is still valid but only partially interned.
+ */
+error_t *intern_node(intern_t *intern, ast_node_t **node);
+
+/**
+ * @brief Intern the operands of a statement
+ *
+ * Does nothing for statements that aren't instructions.
+ *
+ * @param intern The table to intern into
+ * @param statement A statement node as produced by the parser
+ * @return error_t* nullptr on success, allocation error on failure
+ */
+error_t *intern_statement(intern_t *intern, ast_node_t *statement);
+
+#endif // INCLUDE_SRC_INTERN_H_
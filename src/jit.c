@@ -0,0 +1,149 @@
+// MAP_ANONYMOUS isn't part of POSIX 2008
+#define _DEFAULT_SOURCE
+#include "jit.h"
+#include "ast.h"
+#include "error.h"
+#include "flat.h"
+#include "lexer.h"
+#include "parser/parser.h"
+#include <errno.h>
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+error_t *err_jit_diagnostics =
+    &(error_t){.message = "The snippet has errors, see the diagnostics"};
+error_t *err_jit_empty = &(error_t){.message = "The snippet has no code"};
+
+error_t *jit_alloc(jit_t **output, bool perf_map) {
+    *output = nullptr;
+
+    jit_t *jit = calloc(1, sizeof(jit_t));
+    if (jit == nullptr)
+        return err_allocation_failed;
+
+    error_t *err = tokenlist_alloc(&jit->tokens);
+    if (err == nullptr)
+        err = assembler_alloc(&jit->assembler);
+    if (err == nullptr)
+        err = diagnostics_alloc(&jit->diagnostics, 0);
+    if (err == nullptr && perf_map) {
+        char path[64];
+        snprintf(path, sizeof(path), "/tmp/perf-%ld.map", (long)getpid());
+        jit->perf_map = fopen(path, "a");
+        if (jit->perf_map == nullptr)
+            err = errorf("Failed to open file '%s': %s", path,
+                         strerror(errno));
+    }
+    if (err) {
+        jit_free(jit);
+        return err;
+    }
+
+    *output = jit;
+    return nullptr;
+}
+
+void jit_free(jit_t *jit) {
+    if (jit == nullptr)
+        return;
+    tokenlist_free(jit->tokens);
+    assembler_free(jit->assembler);
+    diagnostics_free(jit->diagnostics);
+    if (jit->perf_map)
+        fclose(jit->perf_map);
+    free(jit);
+}
+
+// Lexes, parses and assembles the snippet with what is left of the last one
+// cleared first
+static error_t *jit_assemble_program(jit_t *jit, const char *source,
+                                     size_t len) {
+    tokenlist_clear(jit->tokens);
+    assembler_reset(jit->assembler);
+    diagnostics_clear(jit->diagnostics);
+
+    lexer_t lex = {};
+    error_t *err = lexer_open_memory(&lex, source, len);
+    if (err)
+        return err;
+    err = tokenlist_fill(jit->tokens, &lex);
+    lexer_close(&lex);
+    if (err)
+        return err;
+
+    parse_result_t result = parse_program(
+        jit->tokens->head, &(parse_options_t){.diagnostics = jit->diagnostics});
+    if (result.err)
+        return result.err;
+    ast_node_t *program = result.node;
+
+    // The statements point into the token list, the tree isn't needed once
+    // they are assembled
+    size_t statements = jit->diagnostics->len ? 0 : program->len;
+    for (size_t i = 0; i < statements && err == nullptr; ++i) {
+        ast_node_t *statement = ast_node_child(program, i);
+        err = assembler_statement(jit->assembler, statement);
+        if (err && err != err_allocation_failed)
+            err = diagnostics_add(jit->diagnostics,
+                                  ast_node_child(statement, 0)->token_entry,
+                                  err->message);
+    }
+    ast_node_free(program);
+    if (err == nullptr && jit->diagnostics->len == 0)
+        err = assembler_relax(jit->assembler);
+    if (err == nullptr && jit->diagnostics->len == 0)
+        err = assembler_finish(jit->assembler, jit->diagnostics);
+    return err;
+}
+
+error_t *jit_assemble(jit_t *jit, const char *source, size_t len,
+                      const char *name, jit_code_t *output) {
+    *output = (jit_code_t){};
+    if (len == 0)
+        return err_jit_empty;
+
+    error_t *err = jit_assemble_program(jit, source, len);
+    if (err == err_diagnostics_limit || jit->diagnostics->len)
+        return err_jit_diagnostics;
+    if (err)
+        return err;
+
+    size_t size = flat_size(jit->assembler);
+    if (size == 0)
+        return err_jit_empty;
+    size_t page = sysconf(_SC_PAGESIZE);
+    size_t mapped = (size + page - 1) / page * page;
+    void *code = mmap(nullptr, mapped, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (code == MAP_FAILED)
+        return errorf("Failed to map code: %s", strerror(errno));
+
+    // Absolute references get the address of the mapping, so they are only
+    // known here
+    err = flat_load(jit->assembler, jit->diagnostics, code);
+    if (err == nullptr && jit->diagnostics->len)
+        err = err_jit_diagnostics;
+    if (err == nullptr && mprotect(code, mapped, PROT_READ | PROT_EXEC) != 0)
+        err = errorf("Failed to make code executable: %s", strerror(errno));
+    if (err) {
+        munmap(code, mapped);
+        return err == err_diagnostics_limit ? err_jit_diagnostics : err;
+    }
+
+    if (jit->perf_map) {
+        fprintf(jit->perf_map, "%" PRIxPTR " %zx %s\n", (uintptr_t)code, size,
+                name);
+        fflush(jit->perf_map);
+    }
+    *output = (jit_code_t){.entry = code, .size = size, .mapped = mapped};
+    return nullptr;
+}
+
+void jit_release(jit_code_t *code) {
+    if (code->entry)
+        munmap(code->entry, code->mapped);
+    *code = (jit_code_t){};
+}
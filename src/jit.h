@@ -0,0 +1,86 @@
+#ifndef INCLUDE_SRC_JIT_H_
+#define INCLUDE_SRC_JIT_H_
+
+#include "assembler.h"
+#include "diagnostics.h"
+#include "error.h"
+#include "tokenlist.h"
+#include <stdio.h>
+
+/* Assembles snippets of source text into executable memory of the process,
+ * for code generated at runtime. A jit keeps its token list, assembler and
+ * diagnostics from one snippet to the next, so a snippet only allocates what
+ * it needs beyond the largest one before, and the tree of its statements.
+ * The code of a snippet is laid out like a flat binary loaded at the address
+ * of a mapping of its own, which is written and then switched to executable,
+ * never both at once. */
+
+extern error_t *err_jit_diagnostics;
+extern error_t *err_jit_empty;
+
+typedef struct jit {
+    tokenlist_t *tokens;
+    assembler_t *assembler;
+    /* what kept the last snippet from assembling */
+    diagnostics_t *diagnostics;
+    /* /tmp/perf-<pid>.map, which perf reads the names of the snippets from,
+     * nullptr without profiling */
+    FILE *perf_map;
+} jit_t;
+
+typedef struct jit_code {
+    /* the first byte of the snippet, where it is called */
+    void *entry;
+    size_t size;
+    /* the mapping, whole pages */
+    size_t mapped;
+} jit_code_t;
+
+/**
+ * @brief Allocate a new jit
+ *
+ * @param[out] output Pointer to the allocated jit
+ * @param perf_map Whether to add every snippet to /tmp/perf-<pid>.map, the
+ *        file is created if it doesn't exist yet
+ * @return error_t* nullptr on success, an error if the perf map can't be
+ *         opened, allocation error on failure
+ */
+error_t *jit_alloc(jit_t **output, bool perf_map);
+
+/**
+ * @brief Free the jit
+ *
+ * Code it assembled stays until jit_release. If jit is nullptr, the function
+ * returns without doing anything.
+ *
+ * @param jit The jit to free
+ */
+void jit_free(jit_t *jit);
+
+/**
+ * @brief Assemble a snippet into executable memory
+ *
+ * Every label the snippet references has to be defined in it. The entry of
+ * the code is cast to the function pointer type the snippet implements.
+ *
+ * @param jit The jit
+ * @param source The source text of the snippet
+ * @param len Length of the source text
+ * @param name Name of the snippet in the perf map
+ * @param[out] output The executable code
+ * @return error_t* nullptr on success, err_jit_diagnostics if the snippet has
+ *         errors, which are in the diagnostics of the jit,
+ *         err_jit_empty if it has no code, an error if the memory can't be
+ *         mapped, allocation error on failure
+ */
+error_t *jit_assemble(jit_t *jit, const char *source, size_t len,
+                      const char *name, jit_code_t *output);
+
+/**
+ * @brief Unmap the code of a snippet
+ *
+ * @param code The code, the snippet must not run anymore
+ */
+void jit_release(jit_code_t *code);
+
+#endif // INCLUDE_SRC_JIT_H_
@@ -56,6 +56,26 @@ const char *lexer_token_id_to_cstr(lexer_token_id_t id) {
         return "TOKEN_ASTERISK";
     case TOKEN_DOT:
         return "TOKEN_DOT";
+    case TOKEN_SLASH:
+        return "TOKEN_SLASH";
+    case TOKEN_SHIFT_LEFT:
+        return "TOKEN_SHIFT_LEFT";
+    case TOKEN_SHIFT_RIGHT:
+        return "TOKEN_SHIFT_RIGHT";
+    case TOKEN_AMPERSAND:
+        return "TOKEN_AMPERSAND";
+    case TOKEN_PIPE:
+        return "TOKEN_PIPE";
+    case TOKEN_TILDE:
+        return "TOKEN_TILDE";
+    case TOKEN_LPAREN:
+        return "TOKEN_LPAREN";
+    case TOKEN_RPAREN:
+        return "TOKEN_RPAREN";
+    case TOKEN_DOLLAR:
+        return "TOKEN_DOLLAR";
+    case TOKEN_BACKSLASH:
+        return "TOKEN_BACKSLASH";
     case TOKEN_COMMENT:
         return "TOKEN_COMMENT";
     case TOKEN_NEWLINE:
@@ -132,6 +152,20 @@ error_t *lexer_open(lexer_t *lex, char *path) {
     return nullptr;
 }
 
+error_t *lexer_open_memory(lexer_t *lex, const char *source, size_t len) {
+    if (lex->fp != nullptr)
+        return err_lexer_already_open;
+
+    // Read only, so the source is never written through the cast
+    lex->fp = fmemopen((void *)source, len, "r");
+    if (lex->fp == nullptr)
+        return errorf("Failed to open source text: %s", strerror(errno));
+    lex->line_number = 0;
+    lex->character_number = 0;
+    lex->buffer_count = 0;
+    return nullptr;
+}
+
 /**
  * Shifts the lexer's buffer by n characters, discarding the first n characters
  * and moving the remaining characters to the beginning of the buffer.
@@ -419,8 +453,127 @@ error_t *lexer_next_identifier(lexer_t *lex, lexer_token_t *token) {
 error_t *lexer_next_character(lexer_t *lex, lexer_token_t *token) {
     return lexer_not_implemented(lex, token);
 }
+
+static int lexer_hex_digit(char c) {
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+bool lexer_unescape(const char *value, char *output, size_t *len) {
+    size_t value_len = strlen(value);
+    if (value_len < 2 || value[0] != '"' || value[value_len - 1] != '"')
+        return false;
+
+    *len = 0;
+    for (size_t i = 1; i < value_len - 1; ++i) {
+        char c = value[i];
+        if (c != '\\') {
+            output[(*len)++] = c;
+            continue;
+        }
+        if (i + 1 == value_len - 1)
+            return false;
+        switch (value[++i]) {
+        case '\\':
+            c = '\\';
+            break;
+        case 'n':
+            c = '\n';
+            break;
+        case 'r':
+            c = '\r';
+            break;
+        case 't':
+            c = '\t';
+            break;
+        case '0':
+            c = '\0';
+            break;
+        case '"':
+            c = '"';
+            break;
+        case '\'':
+            c = '\'';
+            break;
+        case 'x': {
+            int high =
+                i + 2 < value_len - 1 ? lexer_hex_digit(value[i + 1]) : -1;
+            int low = high >= 0 ? lexer_hex_digit(value[i + 2]) : -1;
+            if (low < 0)
+                return false;
+            c = (char)(high << 4 | low);
+            i += 2;
+            break;
+        }
+        default:
+            return false;
+        }
+        output[(*len)++] = c;
+    }
+    return true;
+}
+
+/**
+ * Processes a string token, from the opening quote up to and including the
+ * closing one. The value keeps the quotes and escapes as written,
+ * lexer_unescape gives the characters they stand for.
+ *
+ * @param lex The lexer to read from
+ * @param token Output parameter that will be populated with the token
+ * information
+ * @return nullptr on success, an error otherwise
+ *
+ * @pre There must be at least one character in the buffer and it must be '"'
+ */
 error_t *lexer_next_string(lexer_t *lex, lexer_token_t *token) {
-    return lexer_not_implemented(lex, token);
+    constexpr size_t max_string_length = 1024;
+    size_t n = 0;
+    char buffer[max_string_length + 1] = {};
+
+    token->id = TOKEN_STRING;
+    token->line_number = lex->line_number;
+    token->character_number = lex->character_number;
+
+    // Strings end at the end of the line at the latest
+    bool escaped = false, closed = false;
+    while (!closed) {
+        error_t *err = lexer_fill_buffer(lex);
+        if (err == err_eof)
+            break;
+        if (err)
+            return err;
+        char c = lex->buffer[0];
+        if (n > 0 && (c == '\r' || c == '\n'))
+            break;
+        lexer_shift_buffer(lex, 1);
+        if (n < max_string_length)
+            buffer[n] = c;
+        n += 1;
+        closed = n > 1 && !escaped && c == '"';
+        escaped = !escaped && c == '\\';
+    }
+    lex->character_number += n;
+
+    char unescaped[max_string_length];
+    size_t len;
+    if (n > max_string_length) {
+        token->id = TOKEN_ERROR;
+        token->explanation =
+            "String length exceeds the maximum of 1024 characters";
+    } else if (!closed) {
+        token->id = TOKEN_ERROR;
+        token->explanation = "String is missing its closing quote";
+    } else if (!lexer_unescape(buffer, unescaped, &len)) {
+        token->id = TOKEN_ERROR;
+        token->explanation = "Invalid escape sequence in string";
+    }
+    token->value = strdup(buffer);
+    return nullptr;
 }
 
 bool is_whitespace_character(char c) {
@@ -494,6 +647,120 @@ error_t *lexer_next_comment(lexer_t *lex, lexer_token_t *token) {
     return nullptr;
 }
 
+/**
+ * Processes a shift operator token (<< or >>). A single < or > is an error
+ * token of its own.
+ *
+ * @param lex The lexer to read from
+ * @param token Output parameter that will be populated with the token
+ * information
+ * @return nullptr on success, an error otherwise
+ *
+ * @pre There must be at least one character in the buffer and it must be
+ * [<>]
+ */
+error_t *lexer_next_shift(lexer_t *lex, lexer_token_t *token) {
+    token->line_number = lex->line_number;
+    token->character_number = lex->character_number;
+
+    size_t n = 2;
+    if (lexer_has_prefix(lex, "<<")) {
+        token->id = TOKEN_SHIFT_LEFT;
+    } else if (lexer_has_prefix(lex, ">>")) {
+        token->id = TOKEN_SHIFT_RIGHT;
+    } else {
+        token->id = TOKEN_ERROR;
+        token->explanation = "Shifts are written << and >>";
+        n = 1;
+    }
+    token->value = strndup(lex->buffer, n);
+    lexer_shift_buffer(lex, n);
+    lex->character_number += n;
+    return nullptr;
+}
+
+typedef enum lexer_conditional {
+    LEXER_CONDITIONAL_NONE,
+    LEXER_CONDITIONAL_IF,
+    LEXER_CONDITIONAL_ELSE,
+    LEXER_CONDITIONAL_ENDIF,
+} lexer_conditional_t;
+
+// The conditional directive at the start of the buffer, which has been
+// filled
+static lexer_conditional_t lexer_conditional(lexer_t *lex) {
+    constexpr size_t longest = sizeof("ifndef") - 1;
+    if (lex->buffer_count == 0 || lex->buffer[0] != '.')
+        return LEXER_CONDITIONAL_NONE;
+    size_t len = 0;
+    while (1 + len < lex->buffer_count && len <= longest &&
+           is_identifier_character(lex->buffer[1 + len]))
+        len++;
+
+    const char *name = lex->buffer + 1;
+    if ((len == 2 && memcmp(name, "if", 2) == 0) ||
+        (len == 5 && memcmp(name, "ifdef", 5) == 0) ||
+        (len == 6 && memcmp(name, "ifndef", 6) == 0))
+        return LEXER_CONDITIONAL_IF;
+    if (len == 4 && memcmp(name, "else", 4) == 0)
+        return LEXER_CONDITIONAL_ELSE;
+    if (len == 5 && memcmp(name, "endif", 5) == 0)
+        return LEXER_CONDITIONAL_ENDIF;
+    return LEXER_CONDITIONAL_NONE;
+}
+
+error_t *lexer_skip_conditional(lexer_t *lex, bool stop_at_else) {
+    size_t depth = 0;
+    while (true) {
+        // Past the indentation, which may not fit in the buffer
+        error_t *err = lexer_fill_buffer(lex);
+        if (err)
+            return err;
+        size_t indentation = 0;
+        while (indentation < lex->buffer_count &&
+               (lex->buffer[indentation] == ' ' ||
+                lex->buffer[indentation] == '\t'))
+            indentation++;
+        lexer_shift_buffer(lex, indentation);
+        lex->character_number += indentation;
+        if (lex->buffer_count == 0)
+            continue;
+
+        err = lexer_fill_buffer(lex);
+        if (err)
+            return err;
+        switch (lexer_conditional(lex)) {
+        case LEXER_CONDITIONAL_IF:
+            depth += 1;
+            break;
+        case LEXER_CONDITIONAL_ELSE:
+            if (depth == 0 && stop_at_else)
+                return nullptr;
+            break;
+        case LEXER_CONDITIONAL_ENDIF:
+            if (depth == 0)
+                return nullptr;
+            depth -= 1;
+            break;
+        case LEXER_CONDITIONAL_NONE:
+            break;
+        }
+
+        // Drop everything up to and including the newline
+        char *newline;
+        while ((newline = memchr(lex->buffer, '\n', lex->buffer_count)) ==
+               nullptr) {
+            lex->buffer_count = 0;
+            err = lexer_fill_buffer(lex);
+            if (err)
+                return err;
+        }
+        lexer_shift_buffer(lex, newline - lex->buffer + 1);
+        lex->line_number += 1;
+        lex->character_number = 0;
+    }
+}
+
 error_t *lexer_next(lexer_t *lex, lexer_token_t *token) {
     memset(token, 0, sizeof(lexer_token_t));
     error_t *err = lexer_fill_buffer(lex);
@@ -539,6 +806,33 @@ error_t *lexer_next(lexer_t *lex, lexer_token_t *token) {
     case '.':
         token->id = TOKEN_DOT;
         break;
+    case '/':
+        token->id = TOKEN_SLASH;
+        break;
+    case '&':
+        token->id = TOKEN_AMPERSAND;
+        break;
+    case '|':
+        token->id = TOKEN_PIPE;
+        break;
+    case '~':
+        token->id = TOKEN_TILDE;
+        break;
+    case '(':
+        token->id = TOKEN_LPAREN;
+        break;
+    case ')':
+        token->id = TOKEN_RPAREN;
+        break;
+    case '$':
+        token->id = TOKEN_DOLLAR;
+        break;
+    case '\\':
+        token->id = TOKEN_BACKSLASH;
+        break;
+    case '<':
+    case '>':
+        return lexer_next_shift(lex, token);
     case '\r':
     case '\n':
         return lexer_next_newline(lex, token);
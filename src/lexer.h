@@ -24,6 +24,16 @@ typedef enum {
     TOKEN_MINUS,
     TOKEN_ASTERISK,
     TOKEN_DOT,
+    TOKEN_SLASH,
+    TOKEN_SHIFT_LEFT,
+    TOKEN_SHIFT_RIGHT,
+    TOKEN_AMPERSAND,
+    TOKEN_PIPE,
+    TOKEN_TILDE,
+    TOKEN_LPAREN,
+    TOKEN_RPAREN,
+    TOKEN_DOLLAR,
+    TOKEN_BACKSLASH,
     TOKEN_COMMENT,
     TOKEN_NEWLINE,
     TOKEN_WHITESPACE,
@@ -63,6 +73,16 @@ void lexer_close(lexer_t *lex);
  */
 error_t *lexer_open(lexer_t *lex, char *path);
 
+/**
+ * @brief Opens source text in memory for lexical analysis
+ *
+ * @param lex Pointer to the lexer to initialize
+ * @param source The source text, it has to outlive the lexer
+ * @param len Length of the source text, at least 1
+ * @return error_t* nullptr on success, or error describing the failure
+ */
+error_t *lexer_open_memory(lexer_t *lex, const char *source, size_t len);
+
 /**
  * @brief Reads the next token from the input stream
  *
@@ -72,6 +92,20 @@ error_t *lexer_open(lexer_t *lex, char *path);
  */
 error_t *lexer_next(lexer_t *lex, lexer_token_t *token);
 
+/**
+ * @brief Skips the lines of a conditional block that isn't assembled
+ *
+ * Lines are dropped with a scan for their newline instead of being lexed,
+ * only the start of each is looked at for conditional directives. Blocks
+ * opened by .if, .ifdef and .ifndef on the way are skipped as a whole.
+ *
+ * @param lex Pointer to a lexer at the start of a line
+ * @param stop_at_else Whether to stop at .else as well as at .endif
+ * @return error_t* nullptr on success, with the lexer at the directive that
+ *         ends the block, err_eof if the input ends first, or other error
+ */
+error_t *lexer_skip_conditional(lexer_t *lex, bool stop_at_else);
+
 /**
  * @brief Prints a token to stdout for debugging purposes
  *
@@ -79,6 +113,17 @@ error_t *lexer_next(lexer_t *lex, lexer_token_t *token);
  */
 void lexer_token_print(lexer_token_t *token);
 
+/**
+ * @brief Gives the characters a string token stands for
+ *
+ * @param value The value of a TOKEN_STRING token, with its quotes
+ * @param output Receives the characters, which are never more than the value
+ *        has. Not terminated, it may contain zero bytes.
+ * @param[out] len Number of characters written to output
+ * @return bool false if the value isn't a quoted string with valid escapes
+ */
+bool lexer_unescape(const char *value, char *output, size_t *len);
+
 /**
  * @brief Frees any resources associated with a token
  *
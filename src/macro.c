@@ -0,0 +1,503 @@
+#include "macro.h"
+#include "error.h"
+#include "lexer.h"
+#include "parser/generated.h"
+#include <stdlib.h>
+#include <string.h>
+
+error_t *err_macro_definition = &(error_t){
+    .message = "Invalid macro definition, expected .macro followed by a name "
+               "and parameters separated by commas"};
+error_t *err_macro_nested = &(error_t){
+    .message = "Macros can't be defined in macros or repetitions"};
+error_t *err_macro_redefined =
+    &(error_t){.message = "Macro is already defined"};
+error_t *err_macro_unterminated = &(error_t){
+    .message = "Macro or repetition is missing its .endm or .endr"};
+error_t *err_macro_unmatched = &(error_t){
+    .message = ".endm or .endr without a macro or repetition to end"};
+error_t *err_macro_arguments =
+    &(error_t){.message = "Wrong number of arguments for the macro"};
+error_t *err_macro_parameter =
+    &(error_t){.message = "Unknown macro parameter"};
+error_t *err_macro_count =
+    &(error_t){.message = "Repetition count has to be a number"};
+error_t *err_macro_depth =
+    &(error_t){.message = "Macros and repetitions nest too deeply"};
+
+constexpr size_t macros_default_cap = 16;
+constexpr size_t macro_block_entries = 1024;
+
+struct macro_block {
+    macro_block_t *next;
+    tokenlist_entry_t entries[macro_block_entries];
+};
+
+error_t *macros_alloc(macros_t **output) {
+    *output = nullptr;
+
+    macros_t *macros = calloc(1, sizeof(macros_t));
+    if (macros == nullptr)
+        return err_allocation_failed;
+
+    // The input is always at the bottom, so starting can't fail
+    macros->frames = calloc(macros_default_cap, sizeof(macro_frame_t));
+    error_t *err = macros->frames ? symbols_alloc(&macros->names)
+                                  : err_allocation_failed;
+    if (err) {
+        free(macros->frames);
+        free(macros);
+        return err;
+    }
+    macros->frames_cap = macros_default_cap;
+
+    *output = macros;
+    return nullptr;
+}
+
+static void macros_clear(macros_t *macros) {
+    for (size_t i = 0; i < macros->len; ++i)
+        free(macros->entries[i].parameters);
+    macros->len = 0;
+    symbols_clear(macros->names);
+    for (size_t i = 0; i < macros->frames_len; ++i)
+        free(macros->frames[i].arguments);
+    macros->frames_len = 0;
+}
+
+void macros_free(macros_t *macros) {
+    if (macros == nullptr)
+        return;
+    macros_clear(macros);
+    free(macros->entries);
+    free(macros->frames);
+    symbols_free(macros->names);
+    while (macros->blocks) {
+        macro_block_t *next = macros->blocks->next;
+        free(macros->blocks);
+        macros->blocks = next;
+    }
+    free(macros);
+}
+
+void macros_start(macros_t *macros, tokenlist_entry_t *current) {
+    macros_clear(macros);
+    macros->frames[0] = (macro_frame_t){.line = current};
+    macros->frames_len = 1;
+}
+
+/**
+ * Returns the next token on the same line that isn't whitespace or a comment,
+ * or nullptr if the line ends first
+ */
+static tokenlist_entry_t *macros_next_on_line(tokenlist_entry_t *current) {
+    for (current = current->next; current; current = current->next) {
+        switch (current->token.id) {
+        case TOKEN_WHITESPACE:
+        case TOKEN_COMMENT:
+            continue;
+        case TOKEN_NEWLINE:
+            return nullptr;
+        default:
+            return current;
+        }
+    }
+    return nullptr;
+}
+
+// Returns the newline token ending the line, nullptr at the end of the input
+// and of copied lines
+static tokenlist_entry_t *macros_end_of_line(tokenlist_entry_t *current) {
+    while (current && current->token.id != TOKEN_NEWLINE)
+        current = current->next;
+    return current;
+}
+
+static tokenlist_entry_t *macros_next_line(tokenlist_entry_t *line) {
+    return tokenlist_skip_trivia(macros_end_of_line(line));
+}
+
+// Whether the line starts with the directive .name
+static bool macros_is_directive(tokenlist_entry_t *line, const char *name) {
+    if (line->token.id != TOKEN_DOT)
+        return false;
+    tokenlist_entry_t *next = macros_next_on_line(line);
+    return next && next->token.id == TOKEN_IDENTIFIER &&
+           strcmp(next->token.value, name) == 0;
+}
+
+static bool macros_is_parameter(tokenlist_entry_t *entry) {
+    return entry->token.id == TOKEN_BACKSLASH && entry->next &&
+           entry->next->token.id == TOKEN_IDENTIFIER;
+}
+
+static error_t *macros_push(macros_t *macros, macro_frame_t frame) {
+    if (macros->frames_len == macros->frames_cap) {
+        size_t new_cap = macros->frames_cap * 2;
+        macro_frame_t *frames =
+            realloc(macros->frames, new_cap * sizeof(macro_frame_t));
+        if (frames == nullptr)
+            return err_allocation_failed;
+        macros->frames = frames;
+        macros->frames_cap = new_cap;
+    }
+    macros->frames[macros->frames_len++] = frame;
+    return nullptr;
+}
+
+// Appends an entry sharing the token of source to the copied line that ends
+// at *tail
+static error_t *macros_append(macros_t *macros, tokenlist_entry_t *source,
+                              tokenlist_entry_t **head,
+                              tokenlist_entry_t **tail) {
+    if (macros->blocks == nullptr ||
+        macros->block_used == macro_block_entries) {
+        macro_block_t *block = malloc(sizeof(macro_block_t));
+        if (block == nullptr)
+            return err_allocation_failed;
+        block->next = macros->blocks;
+        macros->blocks = block;
+        macros->block_used = 0;
+    }
+    tokenlist_entry_t *entry = &macros->blocks->entries[macros->block_used++];
+    *entry = (tokenlist_entry_t){.token = source->token, .prev = *tail};
+    if (*tail)
+        (*tail)->next = entry;
+    else
+        *head = entry;
+    *tail = entry;
+    return nullptr;
+}
+
+// The innermost macro being expanded, whose arguments the parameters in the
+// lines of the frames above it stand for. Included files are out of its
+// reach.
+static const macro_frame_t *macros_scope(const macros_t *macros) {
+    for (size_t i = macros->frames_len; i-- > 1;) {
+        if (macros->frames[i].included)
+            return nullptr;
+        if (macros->frames[i].macro)
+            return &macros->frames[i];
+    }
+    return nullptr;
+}
+
+// Replaces the line with a copy that has the argument of every parameter in
+// its place. Lines without parameters and lines outside of macros are left
+// as they are, the parser rejects parameters there. A line of nothing but
+// empty arguments becomes nullptr.
+static error_t *macros_substitute(macros_t *macros, tokenlist_entry_t **line,
+                                  tokenlist_entry_t **token) {
+    const macro_frame_t *scope = macros_scope(macros);
+    tokenlist_entry_t *end = macros_end_of_line(*line);
+    tokenlist_entry_t *entry = *line;
+    while (entry != end && !macros_is_parameter(entry))
+        entry = entry->next;
+    if (scope == nullptr || entry == end)
+        return nullptr;
+
+    const macro_t *macro = scope->macro;
+    tokenlist_entry_t *head = nullptr, *tail = nullptr;
+    for (entry = *line; entry != end; entry = entry->next) {
+        error_t *err;
+        if (!macros_is_parameter(entry)) {
+            err = macros_append(macros, entry, &head, &tail);
+            if (err)
+                return err;
+            continue;
+        }
+
+        entry = entry->next;
+        size_t i = 0;
+        while (i < macro->parameters_len &&
+               strcmp(macro->parameters[i]->token.value, entry->token.value))
+            i++;
+        if (i == macro->parameters_len) {
+            *token = entry;
+            return err_macro_parameter;
+        }
+        const macro_argument_t *argument = &scope->arguments[i];
+        for (tokenlist_entry_t *copied = argument->first; copied;
+             copied = copied == argument->last ? nullptr : copied->next) {
+            err = macros_append(macros, copied, &head, &tail);
+            if (err)
+                return err;
+        }
+    }
+    *line = tokenlist_skip_trivia(head);
+    return nullptr;
+}
+
+// Defines the macro of the .macro line, the lines up to its .endm are skipped
+// whether the definition is valid or not
+static error_t *macros_define(macros_t *macros, tokenlist_entry_t *line,
+                              tokenlist_entry_t **token) {
+    macro_frame_t *frame = &macros->frames[macros->frames_len - 1];
+    *token = line;
+    for (size_t i = 1; i < macros->frames_len; ++i)
+        if (!macros->frames[i].included)
+            return err_macro_nested;
+
+    tokenlist_entry_t *end = macros_next_line(line);
+    while (end && !macros_is_directive(end, "endm"))
+        end = macros_next_line(end);
+    frame->line = end ? macros_next_line(end) : nullptr;
+    if (end == nullptr)
+        return err_macro_unterminated;
+
+    // .macro name parameter, parameter, ...
+    tokenlist_entry_t *name = macros_next_on_line(macros_next_on_line(line));
+    if (name == nullptr || name->token.id != TOKEN_IDENTIFIER)
+        return err_macro_definition;
+    size_t parameters_len = 0;
+    for (tokenlist_entry_t *entry = macros_next_on_line(name); entry;
+         entry = macros_next_on_line(entry)) {
+        *token = entry;
+        if (entry->token.id != TOKEN_IDENTIFIER)
+            return err_macro_definition;
+        parameters_len += 1;
+        entry = macros_next_on_line(entry);
+        if (entry == nullptr)
+            break;
+        *token = entry;
+        if (entry->token.id != TOKEN_COMMA ||
+            macros_next_on_line(entry) == nullptr)
+            return err_macro_definition;
+    }
+
+    *token = name;
+    symbol_t *symbol;
+    error_t *err = symbols_get(macros->names, name, &symbol);
+    if (err)
+        return err;
+    if (symbol->defined)
+        return err_macro_redefined;
+
+    if (macros->len == macros->cap) {
+        size_t new_cap = macros->cap ? macros->cap * 2 : macros_default_cap;
+        macro_t *entries = realloc(macros->entries, new_cap * sizeof(macro_t));
+        if (entries == nullptr)
+            return err_allocation_failed;
+        macros->entries = entries;
+        macros->cap = new_cap;
+    }
+    // One spare entry keeps the allocation from being empty
+    tokenlist_entry_t **parameters =
+        calloc(parameters_len + 1, sizeof(tokenlist_entry_t *));
+    if (parameters == nullptr)
+        return err_allocation_failed;
+    tokenlist_entry_t *entry = name;
+    for (size_t i = 0; i < parameters_len; ++i) {
+        // Past the comma in front of the parameter
+        entry = macros_next_on_line(i ? macros_next_on_line(entry) : entry);
+        parameters[i] = entry;
+    }
+
+    symbol->defined = true;
+    symbol->offset = macros->len;
+    symbol->token = name;
+    macros->entries[macros->len++] = (macro_t){
+        .name = name,
+        .parameters_len = parameters_len,
+        .parameters = parameters,
+        .body = macros_next_line(line),
+        .end = end,
+    };
+    return nullptr;
+}
+
+// Starts repeating the body of the .rept line at source, line is what the
+// line expanded to. The body is skipped if the count isn't valid.
+static error_t *macros_repeat(macros_t *macros, tokenlist_entry_t *source,
+                              tokenlist_entry_t *line,
+                              tokenlist_entry_t **token) {
+    macro_frame_t *frame = &macros->frames[macros->frames_len - 1];
+    *token = line;
+
+    // Repetitions in the body have .endr lines of their own
+    size_t depth = 0;
+    tokenlist_entry_t *body = macros_next_line(source);
+    tokenlist_entry_t *end = body;
+    for (; end != frame->end; end = macros_next_line(end)) {
+        if (macros_is_directive(end, "rept")) {
+            depth += 1;
+        } else if (macros_is_directive(end, "endr")) {
+            if (depth == 0)
+                break;
+            depth -= 1;
+        }
+    }
+    if (end == frame->end) {
+        frame->line = end;
+        return err_macro_unterminated;
+    }
+    frame->line = macros_next_line(end);
+
+    tokenlist_entry_t *count = macros_next_on_line(macros_next_on_line(line));
+    if (count == nullptr)
+        return err_macro_count;
+    *token = count;
+    parse_result_t result = parse_generated_number(count);
+    if (result.err == err_allocation_failed)
+        return result.err;
+    if (result.err || macros_next_on_line(count)) {
+        ast_node_free(result.node);
+        return err_macro_count;
+    }
+    uint64_t repetitions = ast_node_child(result.node, 0)->value.integer.value;
+    ast_node_free(result.node);
+
+    *token = line;
+    if (macros->frames_len > macros_depth_limit)
+        return err_macro_depth;
+    return macros_push(macros, (macro_frame_t){
+                                   .line = repetitions ? body : end,
+                                   .end = end,
+                                   .body = body,
+                                   .remaining = repetitions ? repetitions - 1
+                                                            : 0,
+                               });
+}
+
+// The macro the line starts with, nullptr if it doesn't start with one
+static const macro_t *macros_lookup(const macros_t *macros,
+                                    tokenlist_entry_t *line) {
+    if (line->token.id != TOKEN_IDENTIFIER || macros->len == 0)
+        return nullptr;
+    const symbol_t *symbol = symbols_find(macros->names, line->token.value);
+    tokenlist_entry_t *next = macros_next_on_line(line);
+    // A label may have the name of a macro
+    if (symbol == nullptr || (next && next->token.id == TOKEN_COLON))
+        return nullptr;
+    return &macros->entries[symbol->offset];
+}
+
+// Starts expanding the macro named at the start of the line with the
+// arguments that follow, separated by commas
+static error_t *macros_invoke(macros_t *macros, const macro_t *macro,
+                              tokenlist_entry_t *name,
+                              tokenlist_entry_t **token) {
+    *token = name;
+    if (macros->frames_len > macros_depth_limit)
+        return err_macro_depth;
+
+    // One spare argument keeps the allocation from being empty and takes the
+    // tokens of a surplus argument until its comma is found
+    macro_argument_t *arguments =
+        calloc(macro->parameters_len + 1, sizeof(macro_argument_t));
+    if (arguments == nullptr)
+        return err_allocation_failed;
+    size_t len = 0;
+    for (tokenlist_entry_t *entry = macros_next_on_line(name);
+         entry && len <= macro->parameters_len;
+         entry = macros_next_on_line(entry)) {
+        if (len == 0)
+            len = 1;
+        if (entry->token.id == TOKEN_COMMA) {
+            len += 1;
+            continue;
+        }
+        macro_argument_t *argument = &arguments[len - 1];
+        if (argument->first == nullptr)
+            argument->first = entry;
+        argument->last = entry;
+    }
+    if (len != macro->parameters_len) {
+        free(arguments);
+        return err_macro_arguments;
+    }
+
+    error_t *err = macros_push(macros, (macro_frame_t){
+                                           .line = macro->body,
+                                           .end = macro->end,
+                                           .body = macro->body,
+                                           .macro = macro,
+                                           .arguments = arguments,
+                                       });
+    if (err)
+        free(arguments);
+    return err;
+}
+
+// Starts expanding the file named by the .include line
+static error_t *macros_include(macros_t *macros, tokenlist_entry_t *line,
+                               tokenlist_entry_t **token) {
+    tokenlist_entry_t *string = macros_next_on_line(macros_next_on_line(line));
+    *token = string ? string : line;
+    if (string == nullptr || string->token.id != TOKEN_STRING ||
+        macros_next_on_line(string))
+        return err_include_path;
+    if (macros->frames_len > macros_depth_limit)
+        return err_include_depth;
+
+    const char *value = string->token.value;
+    char *path = malloc(strlen(value) + 1);
+    if (path == nullptr)
+        return err_allocation_failed;
+    size_t len;
+    bool valid = lexer_unescape(value, path, &len) &&
+                 memchr(path, '\0', len) == nullptr;
+    path[valid ? len : 0] = '\0';
+    tokenlist_t *list = nullptr;
+    error_t *err = valid ? includes_get(macros->includes, path, &list)
+                         : err_include_path;
+    free(path);
+    if (err)
+        return err;
+    return macros_push(macros, (macro_frame_t){
+                                   .line = tokenlist_skip_trivia(list->head),
+                                   .included = true,
+                               });
+}
+
+error_t *macros_next(macros_t *macros, tokenlist_entry_t **line,
+                     tokenlist_entry_t **newline, tokenlist_entry_t **token) {
+    while (true) {
+        macro_frame_t *frame = &macros->frames[macros->frames_len - 1];
+        if (frame->line == frame->end) {
+            if (frame->remaining) {
+                frame->remaining -= 1;
+                frame->line = frame->body;
+                continue;
+            }
+            if (macros->frames_len == 1) {
+                *line = nullptr;
+                *newline = nullptr;
+                return nullptr;
+            }
+            free(frame->arguments);
+            macros->frames_len -= 1;
+            continue;
+        }
+
+        tokenlist_entry_t *source = frame->line;
+        frame->line = macros_next_line(source);
+        *line = source;
+        error_t *err = macros_substitute(macros, line, token);
+        if (err)
+            return err;
+        if (*line == nullptr)
+            continue;
+        *newline = *line == source ? macros_end_of_line(source) : nullptr;
+
+        if (macros_is_directive(*line, "macro")) {
+            err = macros_define(macros, source, token);
+        } else if (macros_is_directive(*line, "rept")) {
+            err = macros_repeat(macros, source, *line, token);
+        } else if (macros->includes &&
+                   macros_is_directive(*line, "include")) {
+            err = macros_include(macros, *line, token);
+        } else if (macros_is_directive(*line, "endm") ||
+                   macros_is_directive(*line, "endr")) {
+            *token = *line;
+            err = err_macro_unmatched;
+        } else {
+            const macro_t *macro = macros_lookup(macros, *line);
+            if (macro == nullptr)
+                return nullptr;
+            err = macros_invoke(macros, macro, *line, token);
+        }
+        if (err)
+            return err;
+    }
+}
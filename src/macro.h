@@ -0,0 +1,143 @@
+#ifndef INCLUDE_SRC_MACRO_H_
+#define INCLUDE_SRC_MACRO_H_
+
+#include "error.h"
+#include "include.h"
+#include "symbols.h"
+#include "tokenlist.h"
+#include <stddef.h>
+
+/* Macros and repetitions are expanded while the program is parsed, a line at
+ * a time. A macro is defined by the lines between
+ *
+ *     .macro name parameter, parameter, ...
+ *     .endm
+ *
+ * and expanded wherever name starts a line, followed by an argument for every
+ * parameter. In its body \parameter stands for the tokens of the argument.
+ * The lines between .rept count and .endr are expanded count times.
+ *
+ * Bodies are lexed once along with the rest of the input and never copied as
+ * text. A line of a body is parsed where it is in the token list every time
+ * it is expanded, so the statements of all expansions reference the same
+ * tokens. Only lines using parameters are copied, into entries that share the
+ * values of the body's and the argument's tokens. Repetitions are streamed,
+ * a large count costs the statements it expands to and nothing more.
+ *
+ * Macros can't be defined in macros or repetitions, included files may
+ * define them. Labels in a body are defined again by every expansion.
+ * Included files are expanded like bodies, their lines are parsed where they
+ * are in the list of the file, see include.h. */
+
+extern error_t *err_macro_definition;
+extern error_t *err_macro_nested;
+extern error_t *err_macro_redefined;
+extern error_t *err_macro_unterminated;
+extern error_t *err_macro_unmatched;
+extern error_t *err_macro_arguments;
+extern error_t *err_macro_parameter;
+extern error_t *err_macro_count;
+extern error_t *err_macro_depth;
+
+/* Expansions nesting deeper than this are taken to be endless recursion */
+constexpr size_t macros_depth_limit = 64;
+
+typedef struct macro {
+    /* the name and the parameters on the .macro line */
+    tokenlist_entry_t *name;
+    size_t parameters_len;
+    tokenlist_entry_t **parameters;
+    /* the first line of the body and the .endm line ending it */
+    tokenlist_entry_t *body;
+    tokenlist_entry_t *end;
+} macro_t;
+
+typedef struct macro_argument {
+    /* the first and last token of the argument, nullptr if it is empty */
+    tokenlist_entry_t *first;
+    tokenlist_entry_t *last;
+} macro_argument_t;
+
+typedef struct macro_frame {
+    /* the next line to expand and the line ending the body, both nullptr at
+     * the end of the input and of included files */
+    tokenlist_entry_t *line;
+    tokenlist_entry_t *end;
+    /* the first line of the body and how many more times it is expanded */
+    tokenlist_entry_t *body;
+    size_t remaining;
+    /* the macro and its arguments, nullptr for repetitions and the input */
+    const macro_t *macro;
+    macro_argument_t *arguments;
+    /* the lines are those of an included file */
+    bool included;
+} macro_frame_t;
+
+typedef struct macro_block macro_block_t;
+
+typedef struct macros {
+    size_t len;
+    size_t cap;
+    macro_t *entries;
+    /* maps names to macros, the offset of a symbol is its macro's index */
+    symbols_t *names;
+    /* the input at the bottom, then every expansion in progress */
+    size_t frames_len;
+    size_t frames_cap;
+    macro_frame_t *frames;
+    /* the entries of copied lines, which live as long as the table */
+    macro_block_t *blocks;
+    size_t block_used;
+    /* the files .include lines expand to, nullptr leaves those lines to the
+     * parser */
+    includes_t *includes;
+} macros_t;
+
+/**
+ * @brief Allocate a new, empty macro table
+ *
+ * @param[out] output Pointer to the allocated table
+ * @return error_t* nullptr on success, allocation error on failure
+ */
+error_t *macros_alloc(macros_t **output);
+
+/**
+ * @brief Free the table along with the lines it copied
+ *
+ * Statements parsed from copied lines reference their tokens, so the table
+ * has to outlive them. If macros is nullptr, the function returns without
+ * doing anything.
+ *
+ * @param macros The table to free
+ */
+void macros_free(macros_t *macros);
+
+/**
+ * @brief Start expanding the input, forgetting the macros defined so far
+ *
+ * @param macros The table
+ * @param current The first token of the input
+ */
+void macros_start(macros_t *macros, tokenlist_entry_t *current);
+
+/**
+ * @brief Get the next line to parse
+ *
+ * Lines defining, expanding or ending macros and repetitions and lines
+ * including files are taken care of and never returned. A line that is
+ * returned either ends at newline in the list it is in, or is a copy that
+ * ends on its own and newline is nullptr. When an error is returned, the
+ * line it is about has been skipped and the next call carries on after it.
+ *
+ * @param macros The table
+ * @param[out] line The first token of the line, nullptr at the end of the
+ *             input
+ * @param[out] newline The token ending the line, if the line isn't a copy
+ * @param[out] token The token to report an error at
+ * @return error_t* nullptr on success, err_macro_* or err_include_* for lines
+ *         that can't be expanded or allocation error on failure
+ */
+error_t *macros_next(macros_t *macros, tokenlist_entry_t **line,
+                     tokenlist_entry_t **newline, tokenlist_entry_t **token);
+
+#endif // INCLUDE_SRC_MACRO_H_
@@ -1,14 +1,85 @@
+#include "assembler.h"
+#include "cfg.h"
+#include "conditional.h"
+#include "diagnostics.h"
 #include "error.h"
+#include "flat.h"
+#include "include.h"
+#include "intern.h"
 #include "lexer.h"
+#include "macro.h"
+#include "object.h"
 #include "parser/parser.h"
+#include "peephole.h"
+#include "pool.h"
+#include "scan.h"
+#include "throughput.h"
 #include "tokenlist.h"
 
+#include <errno.h>
 #include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
-typedef enum mode { MODE_AST, MODE_TEXT, MODE_TOKENS } mode_t;
+typedef enum mode {
+    MODE_TOKENS,
+    MODE_TEXT,
+    MODE_AST,
+    MODE_AST_REFERENCE,
+    MODE_SYMBOLS,
+    MODE_ENCODE,
+    MODE_BOUNDARIES,
+    MODE_BIN,
+    MODE_ANALYZE,
+} mode_t;
+
+const char *mode_names[] = {
+    [MODE_TOKENS] = "tokens",
+    [MODE_TEXT] = "text",
+    [MODE_AST] = "ast",
+    [MODE_AST_REFERENCE] = "ast-reference",
+    [MODE_SYMBOLS] = "symbols",
+    [MODE_ENCODE] = "encode",
+    [MODE_BOUNDARIES] = "boundaries",
+    [MODE_BIN] = "bin",
+    [MODE_ANALYZE] = "analyze",
+};
+
+constexpr size_t mode_count = sizeof(mode_names) / sizeof(mode_names[0]);
+
+typedef struct options {
+    mode_t mode;
+    char *filename;
+    /* -s: hash-cons identical operand subtrees while parsing */
+    bool share_operands;
+    /* -e: stop after this many errors, 0 for no limit */
+    size_t error_limit;
+    /* -o: write an object file instead of printing the encoding, or the flat
+     * binary of bin */
+    char *output;
+    /* -b: pad branches and loops away from boundaries */
+    bool pad_boundaries;
+    /* -j: encode on this many threads, 0 for one per processor */
+    size_t threads;
+    /* -S: print statistics of the cache of encodings and the rewrites of -O */
+    bool statistics;
+    /* -O: rewrite instructions into smaller or faster ones */
+    bool optimize;
+    /* -d: drop code that can't be reached */
+    bool dead_code;
+    /* -m: the microarchitecture analyze estimates for */
+    const throughput_model_t *model;
+    /* -D: the names conditional assembly sees as defined, see conditional.h */
+    size_t defines_len;
+    char **defines;
+    /* -MD, -MF: write the files the output depends on for make, to the path
+     * of -MF or to the output's path with .d as its extension */
+    char *depfile;
+} options_t;
+
+constexpr size_t default_error_limit = 20;
 
 void print_tokens(tokenlist_t *list) {
     for (auto entry = list->head; entry; entry = entry->next) {
@@ -17,92 +88,821 @@ void print_tokens(tokenlist_t *list) {
     }
 }
 
-void print_text(tokenlist_t *list) {
+void print_text(tokenlist_t *list, size_t error_limit) {
+    size_t errors = 0;
     for (auto entry = list->head; entry; entry = entry->next) {
         auto token = &entry->token;
-        if (token->id == TOKEN_ERROR) {
-            printf("%s\n", token->value);
-            for (size_t i = 0; i < token->character_number; ++i)
-                printf(" ");
-            printf("^-- %s\n", token->explanation);
-            return;
-        } else {
+        if (token->id != TOKEN_ERROR) {
             printf("%s", token->value);
+            continue;
+        }
+
+        if (error_limit && errors == error_limit) {
+            printf("\nStopped after reaching the limit of %zu errors\n",
+                   error_limit);
+            return;
         }
+        errors += 1;
+
+        printf("%s\n", token->value);
+        for (size_t i = 0; i < token->character_number; ++i)
+            printf(" ");
+        printf("^-- %s\n", token->explanation);
+
+        // Indent the rest of the line so it keeps its columns
+        if (entry->next && entry->next->token.id == TOKEN_NEWLINE)
+            entry = entry->next;
+        else if (entry->next)
+            printf("%*s", (int)(token->character_number + strlen(token->value)),
+                   "");
     }
 }
 
-void print_ast(tokenlist_t *list) {
-    parse_result_t result = parse(list->head);
+// Prints the tree of the program, returns whether it could be parsed
+bool print_ast(tokenlist_t *list, const parse_options_t *options) {
+    parse_result_t result = parse_program(list->head, options);
     if (result.err) {
         puts(result.err->message);
         error_free(result.err);
-        return;
+        return false;
     }
     ast_node_print(result.node);
+    diagnostics_print(options->diagnostics);
 
-    if (result.next != nullptr) {
-        puts("First unparsed token:");
-        lexer_token_print(&result.next->token);
+    ast_node_free(result.node);
+    return true;
+}
+
+// Prints every label with its line number and section, separated by tabs.
+// Returns whether the program could be scanned.
+bool print_symbols(tokenlist_t *list, macros_t *macros) {
+    scan_t *scan;
+    error_t *err = scan_alloc(&scan);
+    if (err == nullptr)
+        err = scan_fill(scan, list, macros);
+    if (err) {
+        puts(err->message);
+        error_free(err);
+        scan_free(scan);
+        return false;
     }
 
-    ast_node_free(result.node);
+    for (size_t i = 0; i < scan->len; ++i) {
+        scan_statement_t *statement = &scan->statements[i];
+        if (statement->id != SCAN_LABEL)
+            continue;
+        printf("%s\t%zu\t%s\n", statement->token->token.value,
+               statement->token->token.line_number + 1,
+               statement->section ? statement->section->token.value : "-");
+    }
+    scan_free(scan);
+    return true;
+}
+
+// Prints a line of a listing, nothing for padding that ended up empty
+void print_code(const section_t *section, size_t start, size_t end) {
+    if (start == end)
+        return;
+    printf("%08zx ", start);
+    for (size_t offset = start; offset < end;) {
+        size_t len;
+        const uint8_t *code = assembler_code(section, offset, &len);
+        len = len < end - offset ? len : end - offset;
+        for (size_t i = 0; i < len; ++i)
+            printf(" %02x", code[i]);
+        offset += len;
+    }
+    printf("\n");
+}
+
+typedef struct assemble_options {
+    /* drop unreachable code before assembling, see cfg.h */
+    bool dead_code;
+    /* labels are symbols of the object file other objects can reference,
+     * false for flat binaries */
+    bool exported_labels;
+    /* rewrites the program before it is assembled, nullptr to leave it */
+    peephole_t *peephole;
+    boundaries_t boundaries;
+    /* encode every instruction on a pool of this many threads before
+     * assembling, see assembler_encode. 1 encodes while assembling. */
+    size_t threads;
+    /* print statistics of the cache of encodings and the rewrites to stderr */
+    bool statistics;
+} assemble_options_t;
+
+typedef struct listing_entry {
+    size_t section;
+    size_t offset;
+    size_t len;
+} listing_entry_t;
+
+// Instructions with labels are encoded anew every time, they never look into
+// the cache
+void print_cache_statistics(const encoder_cache_t *cache) {
+    size_t lookups = cache->hits + cache->misses;
+    fprintf(stderr,
+            "encoding cache: %zu hits, %zu misses, %zu bypasses, "
+            "%.1f%% hit rate\n",
+            cache->hits, cache->misses, cache->bypasses,
+            lookups ? 100.0 * (double)cache->hits / (double)lookups : 0.0);
 }
 
-int get_execution_mode(int argc, char *argv[]) {
-    if (argc != 3 || (strcmp(argv[1], "tokens") != 0 &&
-                      strcmp(argv[1], "text") != 0 && strcmp(argv[1], "ast"))) {
-        puts("Usage: oas [tokens|text|ast] <filename>");
+// Assembles every statement, the ones that fail become diagnostics. If listing
+// isn't nullptr it receives the position of every statement that emits code:
+// instructions and the padding of alignments.
+error_t *assemble(ast_node_t *program, diagnostics_t *diagnostics,
+                  const assemble_options_t *options, assembler_t *assembler,
+                  listing_entry_t *listing, size_t *listing_len) {
+    assembler->boundaries = options->boundaries;
+    // Statements that failed to parse are missing, don't assemble the rest
+    if (diagnostics->len == 0 && options->dead_code) {
+        cfg_t *cfg;
+        error_t *err = cfg_build(&cfg, program, options->exported_labels);
+        if (err)
+            return err;
+        err = cfg_eliminate(cfg, program);
+        if (err == nullptr && options->statistics)
+            cfg_print(cfg, stderr);
+        cfg_free(cfg);
+        if (err)
+            return err;
+    }
+    if (diagnostics->len == 0 && options->peephole) {
+        error_t *err = peephole_optimize(options->peephole, program);
+        if (err)
+            return err;
+    }
+    size_t statements = diagnostics->len ? 0 : program->len;
+
+    encoded_t *encoded = nullptr;
+    if (statements && options->threads != 1) {
+        pool_t *pool;
+        error_t *err = pool_alloc(&pool, options->threads);
+        if (err == nullptr)
+            err = assembler_encode(assembler, pool, program, &encoded);
+        pool_free(pool);
+        if (err)
+            return err;
+    }
+
+    for (size_t i = 0; i < statements; ++i) {
+        ast_node_t *statement = ast_node_child(program, i);
+        section_t *section = &assembler->sections[assembler->current];
+        listing_entry_t entry = {assembler->current, section->len, 0};
+
+        error_t *err =
+            encoded
+                ? assembler_encoded_statement(assembler, statement, &encoded[i])
+                : assembler_statement(assembler, statement);
+        if (err == err_allocation_failed) {
+            free(encoded);
+            return err;
+        }
+        if (err) {
+            tokenlist_entry_t *token =
+                ast_node_child(statement, 0)->token_entry;
+            err = diagnostics_add(diagnostics, token, err->message);
+            if (err) {
+                free(encoded);
+                return err;
+            }
+            continue;
+        }
+
+        // A section directive leaves the section it switches away from as is
+        entry.len = assembler->sections[entry.section].len - entry.offset;
+        if (listing && entry.len)
+            listing[(*listing_len)++] = entry;
+    }
+    free(encoded);
+    if (options->statistics)
+        print_cache_statistics(assembler->cache);
+    if (options->statistics && options->peephole)
+        peephole_print(options->peephole, stderr);
+    return nullptr;
+}
+
+// Prints the offset in its section and machine code of every instruction,
+// padding in front of an instruction on a line of its own. Returns whether
+// the program was assembled.
+bool print_encoding(tokenlist_t *list, const parse_options_t *options,
+                    const assemble_options_t *assemble_options) {
+    parse_result_t result = parse_program(list->head, options);
+    if (result.err) {
+        puts(result.err->message);
+        error_free(result.err);
+        return false;
+    }
+    ast_node_t *program = result.node;
+
+    // The code is only final once every branch is relaxed, so the listing is
+    // printed at the end. One spare entry keeps the allocation from being
+    // empty.
+    listing_entry_t *listing = calloc(program->len + 1, sizeof(*listing));
+    size_t listing_len = 0;
+    assembler_t *assembler = nullptr;
+    error_t *err =
+        listing ? assembler_alloc(&assembler) : err_allocation_failed;
+    if (err == nullptr)
+        err = assemble(program, options->diagnostics, assemble_options,
+                       assembler, listing, &listing_len);
+    if (err == nullptr)
+        err = assembler_relax(assembler);
+    if (err == nullptr)
+        err = assembler_finish(assembler, options->diagnostics);
+
+    if (err == err_allocation_failed) {
+        puts(err->message);
+    } else {
+        for (size_t i = 0; i < listing_len; ++i) {
+            size_t index = listing[i].section;
+            size_t start =
+                assembler_offset(assembler, index, listing[i].offset);
+            size_t behind =
+                assembler_label_offset(assembler, index, listing[i].offset);
+            size_t end = assembler_offset(assembler, index,
+                                          listing[i].offset + listing[i].len);
+            print_code(&assembler->sections[index], start, behind);
+            print_code(&assembler->sections[index], behind, end);
+        }
+        diagnostics_print(options->diagnostics);
+    }
+
+    free(listing);
+    assembler_free(assembler);
+    ast_node_free(program);
+    return err == nullptr;
+}
+
+// Defined labels by section and final offset
+int compare_labels(const void *a, const void *b) {
+    const symbol_t *first = *(const symbol_t **)a;
+    const symbol_t *second = *(const symbol_t **)b;
+    if (first->section != second->section)
+        return first->section < second->section ? -1 : 1;
+    return (first->offset > second->offset) - (first->offset < second->offset);
+}
+
+// Prints the branches that cross or end on a boundary and the loops that fit
+// in a cache line but straddle two, each under the last label in front
+// of it, and how many of them there are. Returns false if it ran out of
+// memory.
+bool report_boundaries(const assembler_t *assembler) {
+    const symbols_t *symbols = assembler->symbols;
+    const symbol_t **labels = malloc((symbols->len + 1) * sizeof(*labels));
+    if (labels == nullptr) {
+        puts(err_allocation_failed->message);
+        return false;
+    }
+    size_t labels_len = 0;
+    for (size_t i = 0; i < symbols->cap; ++i)
+        if (symbols->entries[i].name && symbols->entries[i].defined)
+            labels[labels_len++] = &symbols->entries[i];
+    qsort(labels, labels_len, sizeof(*labels), compare_labels);
+
+    size_t branches = 0, crossing = 0, loops = 0, straddling = 0;
+    size_t label = 0;
+    for (size_t i = 0; i < assembler->sections_len; ++i) {
+        const section_t *section = &assembler->sections[i];
+        const symbol_t *printed = nullptr;
+        bool header = false;
+        for (size_t j = 0; j < section->fragments_len; ++j) {
+            const fragment_t *fragment = &section->fragments[j];
+            if (fragment->kind != FRAGMENT_BOUNDARY &&
+                fragment->kind != FRAGMENT_LOOP)
+                continue;
+            size_t start =
+                assembler_label_offset(assembler, i, fragment->position);
+            size_t size = assembler_offset(assembler, i,
+                                           fragment->position +
+                                               fragment->span) -
+                          start;
+            size_t line = fragment->token->token.line_number + 1;
+
+            bool slow;
+            if (fragment->kind == FRAGMENT_BOUNDARY) {
+                branches += 1;
+                slow = assembler_crosses_boundary(start, size);
+                crossing += slow;
+            } else {
+                loops += size <= assembler_cache_line;
+                slow = assembler_straddles_line(start, size);
+                straddling += slow;
+            }
+            if (!slow)
+                continue;
+
+            while (label < labels_len && labels[label]->section == i &&
+                   labels[label]->offset <= start)
+                label += 1;
+            const symbol_t *owner = label && labels[label - 1]->section == i
+                                        ? labels[label - 1]
+                                        : nullptr;
+            if (!header || owner != printed) {
+                if (owner)
+                    printf("%s:\n", owner->name);
+                else
+                    printf(".%s:\n", section->name);
+                printed = owner;
+                header = true;
+            }
+
+            if (fragment->kind == FRAGMENT_LOOP) {
+                printf("  %08zx  loop of %zu bytes to line %zu straddles "
+                       "two cache lines\n",
+                       start, size, line);
+                continue;
+            }
+            printf("  %08zx  ", start);
+            if (fragment->fused)
+                printf("%s+", fragment->fused->token.value);
+            printf("%s on line %zu %s a %zu byte boundary\n",
+                   fragment->token->token.value, line,
+                   (start + size) % assembler_branch_boundary ? "crosses"
+                                                              : "ends on",
+                   assembler_branch_boundary);
+        }
+        // Labels of the section after its last finding
+        while (label < labels_len && labels[label]->section == i)
+            label += 1;
+    }
+    printf("%zu of %zu branches cross or end on a %zu byte boundary, %zu of "
+           "%zu loops that fit in a cache line straddle two\n",
+           crossing, branches, assembler_branch_boundary, straddling, loops);
+    free(labels);
+    return true;
+}
+
+// Reports where branches and loops end up, see report_boundaries. Returns
+// whether the program was assembled and reported.
+bool print_boundaries(tokenlist_t *list, const parse_options_t *options,
+                      const assemble_options_t *assemble_options) {
+    parse_result_t result = parse_program(list->head, options);
+    if (result.err) {
+        puts(result.err->message);
+        error_free(result.err);
+        return false;
+    }
+    ast_node_t *program = result.node;
+
+    assembler_t *assembler;
+    error_t *err = assembler_alloc(&assembler);
+    if (err == nullptr)
+        err = assemble(program, options->diagnostics, assemble_options,
+                       assembler, nullptr, nullptr);
+    if (err == nullptr)
+        err = assembler_relax(assembler);
+    if (err == nullptr)
+        err = assembler_finish(assembler, options->diagnostics);
+
+    bool success = err == nullptr;
+    if (err == err_allocation_failed) {
+        puts(err->message);
+    } else {
+        success = report_boundaries(assembler) && success;
+        diagnostics_print(options->diagnostics);
+    }
+
+    assembler_free(assembler);
+    ast_node_free(program);
+    return success;
+}
+
+// Prints the estimated throughput and latency of every basic block, see
+// throughput.h. Returns whether the blocks could be built.
+bool print_analysis(tokenlist_t *list, const parse_options_t *options,
+                    const throughput_model_t *model) {
+    parse_result_t result = parse_program(list->head, options);
+    if (result.err) {
+        puts(result.err->message);
+        error_free(result.err);
+        return false;
+    }
+    ast_node_t *program = result.node;
+
+    // Statements that failed to parse are missing, the blocks would be wrong
+    bool success = true;
+    if (options->diagnostics->len == 0) {
+        cfg_t *cfg;
+        error_t *err = cfg_build(&cfg, program, true);
+        if (err) {
+            puts(err->message);
+            error_free(err);
+            success = false;
+        } else {
+            throughput_print(model, cfg, program, stdout);
+        }
+        cfg_free(cfg);
+    }
+    diagnostics_print(options->diagnostics);
+
+    ast_node_free(program);
+    return success;
+}
+
+// Writes a path as a word of a makefile rule, make splits words at spaces
+// and expands $
+void write_dependency(FILE *file, const char *path) {
+    fputs(" \\\n ", file);
+    for (; *path; ++path) {
+        if (*path == ' ' || *path == '#')
+            fputc('\\', file);
+        else if (*path == '$')
+            fputc('$', file);
+        fputc(*path, file);
+    }
+}
+
+// Writes a makefile rule with the input, the files it includes and the files
+// of its .incbin directives as the prerequisites of the output
+error_t *write_depfile(const char *depfile, const char *output,
+                       const char *input, const includes_t *includes,
+                       ast_node_t *program) {
+    FILE *file = fopen(depfile, "w");
+    if (file == nullptr)
+        return errorf("Failed to open file '%s': %s", depfile,
+                      strerror(errno));
+    fputs(output, file);
+    fputc(':', file);
+    write_dependency(file, input);
+    for (size_t i = 0; i < includes->paths_len; ++i)
+        write_dependency(file, includes->paths[i]);
+
+    error_t *err = nullptr;
+    for (size_t i = 0; err == nullptr && i < program->len; ++i) {
+        ast_node_t *statement = ast_node_child(program, i);
+        if (statement->id != NODE_DIRECTIVE ||
+            ast_node_child(statement, 1)->id != NODE_INCBIN_DIRECTIVE)
+            continue;
+        // Assembling checked the path
+        const char *value = ast_node_child(ast_node_child(statement, 1), 1)
+                                ->token_entry->token.value;
+        char *path = malloc(strlen(value) + 1);
+        size_t len;
+        if (path && lexer_unescape(value, path, &len)) {
+            path[len] = '\0';
+            write_dependency(file, path);
+        }
+        err = path ? nullptr : err_allocation_failed;
+        free(path);
+    }
+    fputc('\n', file);
+    if (fclose(file) != 0 && err == nullptr)
+        err = errorf("Write error: %s", strerror(errno));
+    return err;
+}
+
+// Assembles the program into an object file or a flat binary, returns whether
+// it succeeded. The dependencies are written to depfile unless it is nullptr.
+bool write_output(tokenlist_t *list, const parse_options_t *options,
+                  const assemble_options_t *assemble_options, const char *path,
+                  bool flat, const char *input, const char *depfile) {
+    parse_result_t result = parse_program(list->head, options);
+    if (result.err) {
+        puts(result.err->message);
+        error_free(result.err);
+        return false;
+    }
+    ast_node_t *program = result.node;
+
+    assembler_t *assembler;
+    error_t *err = assembler_alloc(&assembler);
+    if (err == nullptr)
+        err = assemble(program, options->diagnostics, assemble_options,
+                       assembler, nullptr, nullptr);
+    if (err == nullptr && options->diagnostics->len == 0)
+        err = assembler_relax(assembler);
+    // Without a linker every label has to be defined in the program
+    if (err == nullptr && flat)
+        err = assembler_finish(assembler, options->diagnostics);
+    else if (err == nullptr && options->diagnostics->len == 0)
+        err = assembler_check(assembler, options->diagnostics);
+    if (err == nullptr && options->diagnostics->len == 0)
+        err = flat ? flat_write(assembler, options->diagnostics, path)
+                   : object_write(assembler, path);
+    if (err == nullptr && options->diagnostics->len == 0 && depfile)
+        err = write_depfile(depfile, path, input, options->macros->includes,
+                            program);
+
+    diagnostics_print(options->diagnostics);
+    if (err && err != err_diagnostics_limit)
+        puts(err->message);
+    bool success = err == nullptr && options->diagnostics->len == 0;
+
+    error_free(err);
+    assembler_free(assembler);
+    ast_node_free(program);
+    return success;
+}
+
+// The output's path with .d in place of its extension, like compilers name
+// the dependencies of -MD
+char *depfile_path(const char *output) {
+    const char *name = strrchr(output, '/');
+    name = name ? name + 1 : output;
+    // A name starting with a dot has no extension
+    const char *extension = strrchr(name, '.');
+    size_t len = extension && extension != name ? (size_t)(extension - output)
+                                                : strlen(output);
+    char *path = malloc(len + sizeof(".d"));
+    if (path == nullptr)
+        return nullptr;
+    memcpy(path, output, len);
+    memcpy(path + len, ".d", sizeof(".d"));
+    return path;
+}
+
+options_t get_options(int argc, char *argv[]) {
+    options_t options = {.error_limit = default_error_limit,
+                         .threads = 1,
+                         .model = throughput_model_lookup("skylake")};
+    bool model = false;
+    bool dependencies = false;
+    const char *depfile = nullptr;
+    // Every argument could be a definition
+    options.defines = malloc(argc * sizeof(char *));
+    if (options.defines == nullptr) {
+        puts(err_allocation_failed->message);
         exit(1);
     }
 
-    if (strcmp(argv[1], "tokens") == 0)
-        return MODE_TOKENS;
-    if (strcmp(argv[1], "text") == 0)
-        return MODE_TEXT;
-    return MODE_AST;
+    int option;
+    char *end;
+    while ((option = getopt(argc, argv, "se:o:bj:SOdm:D:M:")) != -1) {
+        switch (option) {
+        case 's':
+            options.share_operands = true;
+            break;
+        case 'b':
+            options.pad_boundaries = true;
+            break;
+        case 'e':
+            errno = 0;
+            options.error_limit = strtoull(optarg, &end, 10);
+            if (errno || *end != '\0' || *optarg == '\0' || *optarg == '-')
+                goto usage;
+            break;
+        case 'o':
+            options.output = optarg;
+            break;
+        case 'j':
+            errno = 0;
+            options.threads = strtoull(optarg, &end, 10);
+            if (errno || *end != '\0' || *optarg == '\0' || *optarg == '-')
+                goto usage;
+            break;
+        case 'S':
+            options.statistics = true;
+            break;
+        case 'O':
+            options.optimize = true;
+            break;
+        case 'd':
+            options.dead_code = true;
+            break;
+        case 'm':
+            options.model = throughput_model_lookup(optarg);
+            if (options.model == nullptr)
+                goto usage;
+            model = true;
+            break;
+        case 'D':
+            options.defines[options.defines_len++] = optarg;
+            break;
+        case 'M':
+            // -MD, -MF path and -MFpath
+            if (strcmp(optarg, "D") == 0) {
+                dependencies = true;
+                break;
+            }
+            if (optarg[0] != 'F' || (optarg[1] == '\0' && optind == argc))
+                goto usage;
+            depfile = optarg[1] ? optarg + 1 : argv[optind++];
+            break;
+        default:
+            goto usage;
+        }
+    }
+
+    if (argc - optind != 2)
+        goto usage;
+    for (size_t i = 0; i < mode_count; ++i) {
+        if (strcmp(argv[optind], mode_names[i]) == 0) {
+            options.mode = i;
+            options.filename = argv[optind + 1];
+            // Only the encoding can be written to an object file, and a
+            // flat binary always goes to a file
+            if (options.output && options.mode != MODE_ENCODE &&
+                options.mode != MODE_BIN)
+                goto usage;
+            if (options.mode == MODE_BIN && options.output == nullptr)
+                goto usage;
+            // and only assembled code can be padded, encoded in parallel,
+            // optimized, pruned or have statistics of its encodings
+            bool assembles = options.mode == MODE_ENCODE ||
+                             options.mode == MODE_BOUNDARIES ||
+                             options.mode == MODE_BIN;
+            if ((options.pad_boundaries || options.threads != 1 ||
+                 options.statistics || options.optimize ||
+                 options.dead_code) &&
+                !assembles)
+                goto usage;
+            // and only analyze has a model
+            if (model && options.mode != MODE_ANALYZE)
+                goto usage;
+            // Dependencies are those of the output file
+            if ((dependencies || depfile) && options.output == nullptr)
+                goto usage;
+            if (dependencies || depfile) {
+                options.depfile = depfile ? strdup(depfile)
+                                          : depfile_path(options.output);
+                if (options.depfile == nullptr) {
+                    puts(err_allocation_failed->message);
+                    exit(1);
+                }
+            }
+            return options;
+        }
+    }
+
+usage:
+    printf("Usage: oas [-s] [-b] [-O] [-d] [-S] [-j threads] [-e error_limit] "
+           "[-m skylake|zen3] [-D name[=value]]... [-o output_file] "
+           "[-MD] [-MF depfile] [");
+    for (size_t i = 0; i < mode_count; ++i)
+        printf("%s%s", i ? "|" : "", mode_names[i]);
+    puts("] <filename>");
+    exit(1);
 }
 
 int main(int argc, char *argv[]) {
-    mode_t mode = get_execution_mode(argc, argv);
-    char *filename = argv[2];
+    options_t options = get_options(argc, argv);
 
     lexer_t *lex = &(lexer_t){};
-    error_t *err = lexer_open(lex, filename);
+    error_t *err = lexer_open(lex, options.filename);
     if (err)
         goto cleanup_error;
 
+    intern_t *intern = nullptr;
+    if (options.share_operands) {
+        err = intern_alloc(&intern);
+        if (err)
+            goto cleanup_lexer;
+    }
+
+    peephole_t *peephole = nullptr;
+    if (options.optimize) {
+        err = peephole_alloc(&peephole);
+        if (err)
+            goto cleanup_intern;
+    }
+
+    macros_t *macros;
+    err = macros_alloc(&macros);
+    if (err)
+        goto cleanup_peephole;
+
+    conditionals_t *conditionals;
+    err = conditionals_alloc(&conditionals);
+    if (err)
+        goto cleanup_macros;
+    for (size_t i = 0; err == nullptr && i < options.defines_len; ++i)
+        err = conditionals_define(conditionals, options.defines[i]);
+    if (err)
+        goto cleanup_conditionals;
+
+    includes_t *includes;
+    err = includes_alloc(&includes, conditionals);
+    if (err)
+        goto cleanup_conditionals;
+    macros->includes = includes;
+
+    diagnostics_t *diagnostics;
+    err = diagnostics_alloc(&diagnostics, options.error_limit);
+    if (err)
+        goto cleanup_includes;
+
     tokenlist_t *list;
     err = tokenlist_alloc(&list);
     if (err)
-        goto cleanup_lexer;
+        goto cleanup_diagnostics;
 
-    err = tokenlist_fill(list, lex);
+    err = conditionals_fill(conditionals, list, lex);
     if (err)
         goto cleanup_tokens;
 
-    switch (mode) {
+    int status = 0;
+    switch (options.mode) {
     case MODE_TOKENS:
         print_tokens(list);
         break;
     case MODE_TEXT:
-        print_text(list);
+        print_text(list, options.error_limit);
         break;
     case MODE_AST:
-        print_ast(list);
+        if (!print_ast(list, &(parse_options_t){.intern = intern,
+                                                .diagnostics = diagnostics,
+                                                .macros = macros}))
+            status = 1;
+        break;
+    case MODE_AST_REFERENCE:
+        if (!print_ast(list, &(parse_options_t){.reference = true,
+                                                .intern = intern,
+                                                .diagnostics = diagnostics,
+                                                .macros = macros}))
+            status = 1;
+        break;
+    case MODE_SYMBOLS:
+        if (!print_symbols(list, macros))
+            status = 1;
+        break;
+    case MODE_ENCODE:
+    case MODE_BIN: {
+        parse_options_t parse_options = {.intern = intern,
+                                         .diagnostics = diagnostics,
+                                         .macros = macros};
+        assemble_options_t assemble_options = {
+            .dead_code = options.dead_code,
+            .exported_labels = options.mode != MODE_BIN,
+            .peephole = peephole,
+            .boundaries =
+                options.pad_boundaries ? BOUNDARIES_PAD : BOUNDARIES_IGNORE,
+            .threads = options.threads,
+            .statistics = options.statistics,
+        };
+        bool success =
+            options.output == nullptr
+                ? print_encoding(list, &parse_options, &assemble_options)
+                : write_output(list, &parse_options, &assemble_options,
+                               options.output, options.mode == MODE_BIN,
+                               options.filename, options.depfile);
+        if (!success)
+            status = 1;
+        break;
+    }
+    case MODE_BOUNDARIES:
+        if (!print_boundaries(
+                list,
+                &(parse_options_t){.intern = intern,
+                                   .diagnostics = diagnostics,
+                                   .macros = macros},
+                &(assemble_options_t){
+                    .dead_code = options.dead_code,
+                    .exported_labels = true,
+                    .peephole = peephole,
+                    .boundaries = options.pad_boundaries ? BOUNDARIES_PAD
+                                                         : BOUNDARIES_REPORT,
+                    .threads = options.threads,
+                    .statistics = options.statistics,
+                }))
+            status = 1;
+        break;
+    case MODE_ANALYZE:
+        if (!print_analysis(list,
+                            &(parse_options_t){.intern = intern,
+                                               .diagnostics = diagnostics,
+                                               .macros = macros},
+                            options.model))
+            status = 1;
         break;
     }
+    // Whatever the mode printed, a program with diagnostics failed
+    if (diagnostics->len != 0)
+        status = 1;
 
+    intern_free(intern);
+    peephole_free(peephole);
+    diagnostics_free(diagnostics);
+    includes_free(includes);
+    conditionals_free(conditionals);
+    macros_free(macros);
     tokenlist_free(list);
+    free(options.defines);
+    free(options.depfile);
     error_free(err);
-    return 0;
+    return status;
 
 cleanup_tokens:
     tokenlist_free(list);
+cleanup_diagnostics:
+    diagnostics_free(diagnostics);
+cleanup_includes:
+    includes_free(includes);
+cleanup_conditionals:
+    conditionals_free(conditionals);
+cleanup_macros:
+    macros_free(macros);
+cleanup_peephole:
+    peephole_free(peephole);
+cleanup_intern:
+    intern_free(intern);
 cleanup_lexer:
     lexer_close(lex);
 cleanup_error:
     puts(err->message);
     error_free(err);
+    free(options.defines);
+    free(options.depfile);
     return 1;
 }
@@ -0,0 +1,420 @@
+#include "object.h"
+#include "error.h"
+#include <elf.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+/* The file is laid out as the ELF header, the code of every section, the
+ * relocations of every section that has any, the symbol table, the symbol
+ * and section name string tables and finally the section headers. Only the
+ * metadata is built in memory, the code is written from the section buffers
+ * directly and included files from where they are mapped. */
+
+constexpr size_t object_code_align = 16;
+constexpr size_t object_table_align = 8;
+
+/* section headers besides the ones for sections and their relocations: the
+ * null section, .symtab, .strtab and .shstrtab */
+constexpr size_t object_extra_sections = 4;
+
+static const uint8_t object_padding[object_code_align] = {};
+
+typedef struct object {
+    Elf64_Ehdr header;
+    Elf64_Shdr *section_headers;
+    /* relocations of every section, nullptr for sections without any */
+    Elf64_Rela **relocations;
+    size_t *relocation_counts;
+    Elf64_Sym *symbols;
+    /* index in the symbol table of every slot of the symbol hash table */
+    size_t *symbol_indices;
+    /* the local symbols come first, up to this index */
+    size_t first_global;
+    char *names;
+    size_t names_len;
+    char *section_names;
+    size_t section_names_len;
+
+    /* pieces of the file in the order they are written */
+    struct iovec *pieces;
+    size_t pieces_len;
+    size_t size;
+} object_t;
+
+static void object_free(object_t *object, size_t sections) {
+    free(object->section_headers);
+    for (size_t i = 0; object->relocations && i < sections; ++i)
+        free(object->relocations[i]);
+    free(object->relocations);
+    free(object->relocation_counts);
+    free(object->symbols);
+    free(object->symbol_indices);
+    free(object->names);
+    free(object->section_names);
+    free(object->pieces);
+}
+
+static size_t object_align(size_t value, size_t align) {
+    return (value + align - 1) & ~(align - 1);
+}
+
+static void object_add_piece(object_t *object, const void *data, size_t len) {
+    if (len == 0)
+        return;
+    object->pieces[object->pieces_len++] =
+        (struct iovec){.iov_base = (void *)data, .iov_len = len};
+    object->size += len;
+}
+
+static void object_pad(object_t *object, size_t align) {
+    object_add_piece(object, object_padding,
+                     object_align(object->size, align) - object->size);
+}
+
+static size_t object_add_name(char *table, size_t *len, const char *prefix,
+                              const char *name) {
+    size_t offset = *len;
+    size_t prefix_len = strlen(prefix);
+    size_t name_len = strlen(name);
+    memcpy(table + offset, prefix, prefix_len);
+    memcpy(table + offset + prefix_len, name, name_len + 1);
+    *len += prefix_len + name_len + 1;
+    return offset;
+}
+
+static uint32_t object_relocation_type(relocation_kind_t kind) {
+    switch (kind) {
+    case RELOCATION_RELATIVE_8:
+        return R_X86_64_PC8;
+    case RELOCATION_RELATIVE_32:
+        return R_X86_64_PC32;
+    case RELOCATION_ABSOLUTE_32:
+        return R_X86_64_32;
+    case RELOCATION_ABSOLUTE_32S:
+        return R_X86_64_32S;
+    case RELOCATION_ABSOLUTE_64:
+        return R_X86_64_64;
+    }
+    return R_X86_64_NONE;
+}
+
+static uint64_t object_section_flags(const char *name) {
+    if (strcmp(name, "text") == 0)
+        return SHF_ALLOC | SHF_EXECINSTR;
+    if (strcmp(name, "rodata") == 0)
+        return SHF_ALLOC;
+    return SHF_ALLOC | SHF_WRITE;
+}
+
+// Whether the label is a global symbol: named by .global or left to the
+// linker because no statement defined it
+static bool object_global(const symbol_t *symbol) {
+    return symbol->global || !symbol->defined;
+}
+
+// Every section gets a local symbol for the references to $ in it, which come
+// first. ELF wants the local symbols in front of the global ones, so the
+// labels follow in two passes.
+static error_t *object_build_symbols(object_t *object,
+                                     const assembler_t *assembler) {
+    const symbols_t *symbols = assembler->symbols;
+    size_t sections = assembler->sections_len;
+    object->symbols =
+        calloc(symbols->len + sections + 1, sizeof(Elf64_Sym));
+    object->symbol_indices = calloc(symbols->cap + 1, sizeof(size_t));
+    size_t names_cap = 1;
+    for (size_t i = 0; i < symbols->cap; ++i)
+        if (symbols->entries[i].name)
+            names_cap += strlen(symbols->entries[i].name) + 1;
+    object->names = calloc(names_cap, 1);
+    if (!object->symbols || !object->symbol_indices || !object->names)
+        return err_allocation_failed;
+
+    object->names_len = 1;
+    size_t index = 1;
+    for (size_t i = 0; i < sections; ++i)
+        object->symbols[index++] = (Elf64_Sym){
+            .st_info = ELF64_ST_INFO(STB_LOCAL, STT_SECTION),
+            .st_shndx = i + 1,
+        };
+    for (int pass = STB_LOCAL; pass <= STB_GLOBAL; ++pass) {
+        if (pass == STB_GLOBAL)
+            object->first_global = index;
+        for (size_t i = 0; i < symbols->cap; ++i) {
+            const symbol_t *symbol = &symbols->entries[i];
+            if (symbol->name == nullptr ||
+                object_global(symbol) != (pass == STB_GLOBAL))
+                continue;
+            object->symbol_indices[i] = index;
+            object->symbols[index++] = (Elf64_Sym){
+                .st_name = object_add_name(object->names, &object->names_len,
+                                           "", symbol->name),
+                .st_info = ELF64_ST_INFO(pass, STT_NOTYPE),
+                .st_shndx = symbol->defined ? symbol->section + 1 : SHN_UNDEF,
+                .st_value = symbol->defined ? symbol->offset : 0,
+            };
+        }
+    }
+    return nullptr;
+}
+
+static size_t object_symbol_index(const object_t *object,
+                                  const assembler_t *assembler,
+                                  const tokenlist_entry_t *label) {
+    const symbol_t *symbol =
+        symbols_find(assembler->symbols, label->token.value);
+    return object->symbol_indices[symbol - assembler->symbols->entries];
+}
+
+static Elf64_Rela object_relocation(const object_t *object,
+                                    const assembler_t *assembler,
+                                    const relocation_t *relocation) {
+    size_t symbol =
+        relocation->label->token.id == TOKEN_DOLLAR
+            ? relocation->section + 1
+            : object_symbol_index(object, assembler, relocation->label);
+    return (Elf64_Rela){
+        .r_offset = relocation->position,
+        .r_info = ELF64_R_INFO(symbol,
+                               object_relocation_type(relocation->kind)),
+        .r_addend = relocation->addend,
+    };
+}
+
+// The relocations of a section are the ones the assembler recorded and the
+// fixups that are still waiting for a label no statement defined
+static error_t *object_build_relocations(object_t *object,
+                                         const assembler_t *assembler) {
+    size_t sections = assembler->sections_len;
+    object->relocations = calloc(sections, sizeof(Elf64_Rela *));
+    object->relocation_counts = calloc(sections, sizeof(size_t));
+    if (!object->relocations || !object->relocation_counts)
+        return err_allocation_failed;
+
+    size_t *counts = object->relocation_counts;
+    for (size_t i = 0; i < sections; ++i)
+        counts[i] = assembler->sections[i].relocations_len;
+    for (size_t i = 0; i < assembler->fixups_len; ++i)
+        if (!assembler->fixups[i].defined)
+            counts[assembler->fixups[i].section] += 1;
+
+    for (size_t i = 0; i < sections; ++i) {
+        if (counts[i] == 0)
+            continue;
+        object->relocations[i] = calloc(counts[i], sizeof(Elf64_Rela));
+        if (object->relocations[i] == nullptr)
+            return err_allocation_failed;
+
+        const section_t *section = &assembler->sections[i];
+        for (size_t j = 0; j < section->relocations_len; ++j)
+            object->relocations[i][j] =
+                object_relocation(object, assembler, &section->relocations[j]);
+        counts[i] = section->relocations_len;
+    }
+
+    for (size_t i = 0; i < assembler->fixups_len; ++i) {
+        const fixup_t *fixup = &assembler->fixups[i];
+        if (fixup->defined)
+            continue;
+        relocation_t relocation = {
+            .position = fixup->position,
+            .kind = fixup->kind,
+            .addend = fixup->addend,
+            .label = fixup->token,
+        };
+        if (fixup->kind == RELOCATION_RELATIVE_32)
+            relocation.addend +=
+                (int64_t)fixup->position - (int64_t)fixup->origin;
+        object->relocations[fixup->section][counts[fixup->section]++] =
+            object_relocation(object, assembler, &relocation);
+    }
+    return nullptr;
+}
+
+// Lays out the file and fills in the section headers
+static error_t *object_build(object_t *object, const assembler_t *assembler) {
+    size_t sections = assembler->sections_len;
+    size_t relocation_sections = 0;
+    size_t section_names_cap =
+        1 + sizeof(".symtab") + sizeof(".strtab") + sizeof(".shstrtab");
+    for (size_t i = 0; i < sections; ++i) {
+        size_t name_len = strlen(assembler->sections[i].name);
+        section_names_cap += name_len + 2;
+        if (object->relocation_counts[i]) {
+            relocation_sections += 1;
+            section_names_cap += name_len + sizeof(".rela.");
+        }
+    }
+
+    size_t header_count =
+        sections + relocation_sections + object_extra_sections;
+    object->section_headers = calloc(header_count, sizeof(Elf64_Shdr));
+    object->section_names = calloc(section_names_cap, 1);
+    // Every section header and its padding, the ELF header and the headers,
+    // and the code around every blob
+    size_t pieces_cap = 2 * header_count + 2;
+    for (size_t i = 0; i < sections; ++i)
+        pieces_cap += 2 * assembler->sections[i].blobs_len;
+    object->pieces = calloc(pieces_cap, sizeof(struct iovec));
+    if (!object->section_headers || !object->section_names || !object->pieces)
+        return err_allocation_failed;
+
+    Elf64_Shdr *headers = object->section_headers;
+    char *names = object->section_names;
+    size_t *names_len = &object->section_names_len;
+    *names_len = 1;
+    object_add_piece(object, &object->header, sizeof(Elf64_Ehdr));
+
+    for (size_t i = 0; i < sections; ++i) {
+        const section_t *section = &assembler->sections[i];
+        object_pad(object, object_code_align);
+        headers[i + 1] = (Elf64_Shdr){
+            .sh_name = object_add_name(names, names_len, ".", section->name),
+            .sh_type = SHT_PROGBITS,
+            .sh_flags = object_section_flags(section->name),
+            .sh_offset = object->size,
+            .sh_size = section->len,
+            .sh_addralign = section->alignment > object_code_align
+                                ? section->alignment
+                                : object_code_align,
+        };
+        // Blobs are written from where their files are mapped
+        for (size_t offset = 0; offset < section->len;) {
+            size_t len;
+            const uint8_t *code = assembler_code(section, offset, &len);
+            object_add_piece(object, code, len);
+            offset += len;
+        }
+    }
+
+    size_t symtab = sections + relocation_sections + 1;
+    size_t next = sections + 1;
+    for (size_t i = 0; i < sections; ++i) {
+        size_t count = object->relocation_counts[i];
+        if (count == 0)
+            continue;
+        object_pad(object, object_table_align);
+        headers[next++] = (Elf64_Shdr){
+            .sh_name = object_add_name(names, names_len, ".rela.",
+                                       assembler->sections[i].name),
+            .sh_type = SHT_RELA,
+            .sh_flags = SHF_INFO_LINK,
+            .sh_offset = object->size,
+            .sh_size = count * sizeof(Elf64_Rela),
+            .sh_link = symtab,
+            .sh_info = i + 1,
+            .sh_addralign = object_table_align,
+            .sh_entsize = sizeof(Elf64_Rela),
+        };
+        object_add_piece(object, object->relocations[i],
+                         count * sizeof(Elf64_Rela));
+    }
+
+    object_pad(object, object_table_align);
+    size_t symbols_size =
+        (assembler->symbols->len + sections + 1) * sizeof(Elf64_Sym);
+    headers[symtab] = (Elf64_Shdr){
+        .sh_name = object_add_name(names, names_len, "", ".symtab"),
+        .sh_type = SHT_SYMTAB,
+        .sh_offset = object->size,
+        .sh_size = symbols_size,
+        .sh_link = symtab + 1,
+        // Index of the first global symbol, after the local labels
+        .sh_info = object->first_global,
+        .sh_addralign = object_table_align,
+        .sh_entsize = sizeof(Elf64_Sym),
+    };
+    object_add_piece(object, object->symbols, symbols_size);
+
+    headers[symtab + 1] = (Elf64_Shdr){
+        .sh_name = object_add_name(names, names_len, "", ".strtab"),
+        .sh_type = SHT_STRTAB,
+        .sh_offset = object->size,
+        .sh_size = object->names_len,
+        .sh_addralign = 1,
+    };
+    object_add_piece(object, object->names, object->names_len);
+
+    // The name of the section name table is in the table itself
+    size_t shstrtab_name = object_add_name(names, names_len, "", ".shstrtab");
+    headers[symtab + 2] = (Elf64_Shdr){
+        .sh_name = shstrtab_name,
+        .sh_type = SHT_STRTAB,
+        .sh_offset = object->size,
+        .sh_size = *names_len,
+        .sh_addralign = 1,
+    };
+    object_add_piece(object, names, *names_len);
+
+    object_pad(object, object_table_align);
+    object->header = (Elf64_Ehdr){
+        .e_ident = {ELFMAG0, ELFMAG1, ELFMAG2, ELFMAG3, ELFCLASS64,
+                    ELFDATA2LSB, EV_CURRENT, ELFOSABI_SYSV},
+        .e_type = ET_REL,
+        .e_machine = EM_X86_64,
+        .e_version = EV_CURRENT,
+        .e_shoff = object->size,
+        .e_ehsize = sizeof(Elf64_Ehdr),
+        .e_shentsize = sizeof(Elf64_Shdr),
+        .e_shnum = header_count,
+        .e_shstrndx = symtab + 2,
+    };
+    object_add_piece(object, headers, header_count * sizeof(Elf64_Shdr));
+    return nullptr;
+}
+
+// Writes all pieces, writev may write less than asked and takes a limited
+// number of pieces per call
+static error_t *object_write_pieces(object_t *object, int fd) {
+    long max_pieces = sysconf(_SC_IOV_MAX);
+    struct iovec *pieces = object->pieces;
+    size_t remaining = object->pieces_len;
+    while (remaining) {
+        int count = remaining < (size_t)max_pieces ? remaining : max_pieces;
+        ssize_t written = writev(fd, pieces, count);
+        if (written < 0 && errno == EINTR)
+            continue;
+        if (written < 0)
+            return errorf("Write error: %s", strerror(errno));
+
+        while (remaining && (size_t)written >= pieces->iov_len) {
+            written -= pieces->iov_len;
+            pieces += 1;
+            remaining -= 1;
+        }
+        if (remaining) {
+            pieces->iov_base = (uint8_t *)pieces->iov_base + written;
+            pieces->iov_len -= written;
+        }
+    }
+    return nullptr;
+}
+
+error_t *object_write(const assembler_t *assembler, const char *path) {
+    object_t object = {};
+    error_t *err = object_build_symbols(&object, assembler);
+    if (err == nullptr)
+        err = object_build_relocations(&object, assembler);
+    if (err == nullptr)
+        err = object_build(&object, assembler);
+    if (err) {
+        object_free(&object, assembler->sections_len);
+        return err;
+    }
+
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0) {
+        object_free(&object, assembler->sections_len);
+        return errorf("Failed to open file '%s': %s", path, strerror(errno));
+    }
+    err = object_write_pieces(&object, fd);
+    if (close(fd) != 0 && err == nullptr)
+        err = errorf("Write error: %s", strerror(errno));
+
+    object_free(&object, assembler->sections_len);
+    return err;
+}
@@ -0,0 +1,24 @@
+#ifndef INCLUDE_SRC_OBJECT_H_
+#define INCLUDE_SRC_OBJECT_H_
+
+#include "assembler.h"
+#include "error.h"
+
+/**
+ * @brief Write the assembled program as an ELF64 relocatable object file
+ *
+ * Every section of the assembler becomes a section named after it with a dot
+ * in front, every label a symbol. Labels are local unless a .global directive
+ * names them, so objects using the same label names link together. Label
+ * references that are still waiting for their label refer to global symbols
+ * of other objects. The file is
+ * written with a single writev straight from the section buffers.
+ *
+ * @param assembler The assembler, after assembler_relax
+ * @param path Path of the object file, it is created or truncated
+ * @return error_t* nullptr on success, an error if the file can't be written,
+ *         allocation error on failure
+ */
+error_t *object_write(const assembler_t *assembler, const char *path);
+
+#endif // INCLUDE_SRC_OBJECT_H_
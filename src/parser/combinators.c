@@ -13,20 +13,18 @@ parse_result_t parse_list(tokenlist_entry_t *current, node_id_t id,
     many->id = id;
 
     while (current) {
-        // Skip beyond the delimiter on all but the first iteration
+        // All but the first element follow a delimiter, which is only consumed
+        // along with the element. A trailing delimiter is left for the caller.
+        tokenlist_entry_t *element = current;
         if (many->len > 0) {
             if (current->token.id != delimiter_id)
                 break;
-            current = tokenlist_next(current);
-            if (current == nullptr) {
-                // FIXME: this isn't quite right, we can't consume the delimiter
-                // if the next element will fail to parse but it's late and I
-                // must think this through tomorrow
+            element = tokenlist_next(current);
+            if (element == nullptr)
                 break;
-            }
         }
 
-        result = parser(current);
+        result = parser(element);
         if (result.err == err_parse_no_match)
             break;
         if (result.err) {
@@ -108,7 +106,7 @@ parse_result_t parse_consecutive(tokenlist_entry_t *current, node_id_t id,
     all->id = id;
 
     parser_t parser;
-    while ((parser = *parsers++) && current) {
+    while ((parser = *parsers++)) {
         result = parser(current);
         if (result.err) {
             ast_node_free(all);
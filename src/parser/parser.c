@@ -1,8 +1,11 @@
 #include "parser.h"
 #include "../ast.h"
+#include "../expression.h"
 #include "../lexer.h"
+#include "../macro.h"
 #include "../tokenlist.h"
 #include "combinators.h"
+#include "parser/generated.h"
 #include "primitives.h"
 #include "util.h"
 
@@ -18,6 +21,68 @@ parse_result_t parse_plus_or_minus(tokenlist_entry_t *current) {
     return parse_any(current, parsers);
 }
 
+parse_result_t parse_expression(tokenlist_entry_t *current);
+
+parse_result_t parse_operator(tokenlist_entry_t *current) {
+    parser_t parsers[] = {parse_plus,        parse_minus,     parse_asterisk,
+                          parse_slash,       parse_shift_left,
+                          parse_shift_right, parse_ampersand, parse_pipe,
+                          nullptr};
+    return parse_any(current, parsers);
+}
+
+parse_result_t parse_unary_operator(tokenlist_entry_t *current) {
+    parser_t parsers[] = {parse_minus, parse_tilde, nullptr};
+    return parse_any(current, parsers);
+}
+
+parse_result_t parse_term(tokenlist_entry_t *current);
+
+parse_result_t parse_unary(tokenlist_entry_t *current) {
+    parser_t parsers[] = {parse_unary_operator, parse_term, nullptr};
+    return parse_consecutive(current, NODE_UNARY, parsers);
+}
+
+parse_result_t parse_parenthesized(tokenlist_entry_t *current) {
+    parser_t parsers[] = {parse_lparen, parse_expression, parse_rparen,
+                          nullptr};
+    return parse_consecutive(current, NODE_PARENTHESIZED, parsers);
+}
+
+parse_result_t parse_term(tokenlist_entry_t *current) {
+    parser_t parsers[] = {parse_number, parse_label_reference, parse_dollar,
+                          parse_unary, parse_parenthesized, nullptr};
+    return parse_any(current, parsers);
+}
+
+parse_result_t parse_operation(tokenlist_entry_t *current) {
+    parser_t parsers[] = {parse_operator, parse_term, nullptr};
+    return parse_consecutive(current, NODE_OPERATION, parsers);
+}
+
+parse_result_t parse_expression(tokenlist_entry_t *current) {
+    parser_t parsers[] = {parse_term, nullptr};
+    parse_result_t result =
+        parse_consecutive(current, NODE_EXPRESSION, parsers);
+    if (result.err)
+        return result;
+    ast_node_t *expression = result.node;
+
+    // <operation>*
+    result = parse_many(result.next, NODE_INVALID, true, parse_operation);
+    if (result.err) {
+        ast_node_free(expression);
+        return result;
+    }
+    error_t *err = ast_node_move_children(expression, result.node);
+    ast_node_free(result.node);
+    if (err) {
+        ast_node_free(expression);
+        return parse_error(err);
+    }
+    return parse_success(expression, result.next);
+}
+
 parse_result_t parse_register_index(tokenlist_entry_t *current) {
     parser_t parsers[] = {parse_plus, parse_register, parse_asterisk,
                           parse_number, nullptr};
@@ -25,7 +90,7 @@ parse_result_t parse_register_index(tokenlist_entry_t *current) {
 }
 
 parse_result_t parse_register_offset(tokenlist_entry_t *current) {
-    parser_t parsers[] = {parse_plus_or_minus, parse_number, nullptr};
+    parser_t parsers[] = {parse_plus_or_minus, parse_expression, nullptr};
     return parse_consecutive(current, NODE_REGISTER_OFFSET, parsers);
 }
 
@@ -83,13 +148,12 @@ parse_result_t parse_register_expression(tokenlist_entry_t *current) {
 }
 
 parse_result_t parse_immediate(tokenlist_entry_t *current) {
-    parser_t parsers[] = {parse_number, parse_identifier, nullptr};
-    parse_result_t result = parse_any(current, parsers);
-    return parse_result_wrap(NODE_IMMEDIATE, result);
+    return parse_result_wrap(NODE_IMMEDIATE, parse_expression(current));
 }
 
 parse_result_t parse_memory_expression(tokenlist_entry_t *current) {
-    parser_t parsers[] = {parse_register_expression, parse_identifier, nullptr};
+    parser_t parsers[] = {parse_register_expression, parse_expression,
+                          nullptr};
     return parse_any(current, parsers);
 }
 
@@ -119,8 +183,93 @@ parse_result_t parse_section_directive(tokenlist_entry_t *current) {
     return parse_consecutive(current, NODE_SECTION_DIRECTIVE, parsers);
 }
 
+parse_result_t parse_align_directive(tokenlist_entry_t *current) {
+    parser_t parsers[] = {parse_align, parse_number, nullptr};
+    parse_result_t result =
+        parse_consecutive(current, NODE_ALIGN_DIRECTIVE, parsers);
+    if (result.err)
+        return result;
+    ast_node_t *directive = result.node;
+    current = result.next;
+
+    // ( <comma> <number> )?
+    parser_t fill_parsers[] = {parse_comma, parse_number, nullptr};
+    result = parse_consecutive(current, NODE_INVALID, fill_parsers);
+    if (result.err) {
+        error_free(result.err);
+        return parse_success(directive, current);
+    }
+    error_t *err = ast_node_move_children(directive, result.node);
+    ast_node_free(result.node);
+    if (err) {
+        ast_node_free(directive);
+        return parse_error(err);
+    }
+    return parse_success(directive, result.next);
+}
+
+parse_result_t parse_data_directive(tokenlist_entry_t *current) {
+    parser_t parsers[] = {parse_data, nullptr};
+    parse_result_t result =
+        parse_consecutive(current, NODE_DATA_DIRECTIVE, parsers);
+    if (result.err)
+        return result;
+    ast_node_t *directive = result.node;
+
+    // <immediate> ( <comma> <immediate> )*
+    result = parse_list(result.next, NODE_INVALID, false, TOKEN_COMMA,
+                        parse_immediate);
+    if (result.err) {
+        ast_node_free(directive);
+        return result;
+    }
+    error_t *err = ast_node_move_children(directive, result.node);
+    ast_node_free(result.node);
+    if (err) {
+        ast_node_free(directive);
+        return parse_error(err);
+    }
+    return parse_success(directive, result.next);
+}
+
+parse_result_t parse_incbin_directive(tokenlist_entry_t *current) {
+    parser_t parsers[] = {parse_incbin, parse_string, nullptr};
+    return parse_consecutive(current, NODE_INCBIN_DIRECTIVE, parsers);
+}
+
+parse_result_t parse_global_directive(tokenlist_entry_t *current) {
+    parser_t parsers[] = {parse_global, nullptr};
+    parse_result_t result =
+        parse_consecutive(current, NODE_GLOBAL_DIRECTIVE, parsers);
+    if (result.err)
+        return result;
+    ast_node_t *directive = result.node;
+
+    // <identifier> ( <comma> <identifier> )*
+    result = parse_list(result.next, NODE_INVALID, false, TOKEN_COMMA,
+                        parse_identifier);
+    if (result.err) {
+        ast_node_free(directive);
+        return result;
+    }
+    error_t *err = ast_node_move_children(directive, result.node);
+    ast_node_free(result.node);
+    if (err) {
+        ast_node_free(directive);
+        return parse_error(err);
+    }
+    return parse_success(directive, result.next);
+}
+
+parse_result_t parse_directive_kind(tokenlist_entry_t *current) {
+    parser_t parsers[] = {parse_section_directive, parse_align_directive,
+                          parse_data_directive, parse_incbin_directive,
+                          parse_global_directive, nullptr};
+    return parse_any(current, parsers);
+}
+
 parse_result_t parse_directive(tokenlist_entry_t *current) {
-    parser_t parsers[] = {parse_dot, parse_section_directive, nullptr};
+    parser_t parsers[] = {parse_dot, parse_directive_kind, nullptr};
     return parse_consecutive(current, NODE_DIRECTIVE, parsers);
 }
 
@@ -135,6 +284,150 @@ parse_result_t parse_statement(tokenlist_entry_t *current) {
     return parse_any(current, parsers);
 }
 
+parse_result_t parse_reference(tokenlist_entry_t *current) {
+    return parse_program(current, &(parse_options_t){.reference = true});
+}
+
 parse_result_t parse(tokenlist_entry_t *current) {
-    return parse_many(current, NODE_PROGRAM, true, parse_statement);
+    return parse_program(current, &(parse_options_t){});
+}
+
+/**
+ * Records diagnostics for the statement that failed to parse at current and
+ * moves current past the end of the line. Lexer errors on the line are
+ * reported by themselves, they are what made the statement fail.
+ */
+static error_t *parse_recover(tokenlist_entry_t **current,
+                              diagnostics_t *diagnostics) {
+    tokenlist_entry_t *entry = *current;
+    bool lexer_error = false;
+    error_t *err;
+
+    for (; entry && entry->token.id != TOKEN_NEWLINE; entry = entry->next) {
+        if (entry->token.id != TOKEN_ERROR)
+            continue;
+        lexer_error = true;
+        err = diagnostics_add(diagnostics, entry, entry->token.explanation);
+        if (err)
+            return err;
+    }
+    if (!lexer_error) {
+        err = diagnostics_add(diagnostics, *current, "Invalid statement");
+        if (err)
+            return err;
+    }
+
+    *current = tokenlist_skip_trivia(entry);
+    return nullptr;
+}
+
+/**
+ * Parses the statements of the line that starts at current. The caller cut the
+ * line off from the rest of the list, so on success current is nullptr. On
+ * failure current points at the statement that failed to parse.
+ */
+static error_t *parse_line(tokenlist_entry_t **current,
+                           const parse_options_t *options,
+                           ast_node_t *program) {
+    parser_t statement =
+        options->reference ? parse_statement : parse_generated_statement;
+    error_t *err;
+
+    while (*current) {
+        parse_result_t result = statement(*current);
+        if (result.err == err_parse_no_match && options->diagnostics)
+            return parse_recover(current, options->diagnostics);
+        if (result.err)
+            return result.err;
+
+        // A statement whose expressions can't be folded is reported and
+        // left out, like one that doesn't parse
+        tokenlist_entry_t *token = nullptr;
+        err = expression_fold(result.node, &token);
+        if (err && err != err_allocation_failed && options->diagnostics) {
+            ast_node_free(result.node);
+            err = diagnostics_add(options->diagnostics, token, err->message);
+            if (err)
+                return err;
+            *current = result.next;
+            continue;
+        }
+        if (err == nullptr && options->intern)
+            err = intern_statement(options->intern, result.node);
+        if (err == nullptr)
+            err = ast_node_add_child(program, result.node);
+        if (err) {
+            ast_node_free(result.node);
+            return err;
+        }
+        *current = result.next;
+    }
+    return nullptr;
+}
+
+// Moves on to the next line with the macros expanded, the lines that can't
+// be expanded are reported and skipped
+static error_t *parse_expand(tokenlist_entry_t **line,
+                             tokenlist_entry_t **newline,
+                             const parse_options_t *options) {
+    while (true) {
+        tokenlist_entry_t *token = nullptr;
+        error_t *err = macros_next(options->macros, line, newline, &token);
+        if (err == nullptr || err == err_allocation_failed ||
+            options->diagnostics == nullptr)
+            return err;
+        *line = token;
+        err = diagnostics_add(options->diagnostics, token, err->message);
+        if (err)
+            return err;
+    }
+}
+
+parse_result_t parse_program(tokenlist_entry_t *current,
+                             const parse_options_t *options) {
+    ast_node_t *program;
+    error_t *err = ast_node_alloc(&program);
+    if (err)
+        return parse_error(err);
+    program->id = NODE_PROGRAM;
+
+    current = tokenlist_skip_trivia(current);
+    if (options->macros)
+        macros_start(options->macros, current);
+    while (true) {
+        // Trivia includes newlines, so a statement could otherwise continue
+        // on the next line: "ret" would take the next mnemonic as its operand
+        tokenlist_entry_t *newline = current;
+        if (options->macros)
+            err = parse_expand(&current, &newline, options);
+        else
+            while (newline && newline->token.id != TOKEN_NEWLINE)
+                newline = newline->next;
+        if (err == err_diagnostics_limit)
+            break;
+        if (err) {
+            ast_node_free(program);
+            return parse_error(err);
+        }
+        if (current == nullptr)
+            break;
+        tokenlist_entry_t *last = newline ? newline->prev : nullptr;
+        if (last)
+            last->next = nullptr;
+
+        err = parse_line(&current, options, program);
+
+        if (last)
+            last->next = newline;
+        if (err == err_parse_no_match || err == err_diagnostics_limit)
+            break;
+        if (err) {
+            ast_node_free(program);
+            return parse_error(err);
+        }
+        if (options->macros == nullptr)
+            current = tokenlist_skip_trivia(newline);
+    }
+
+    return parse_success(program, current);
 }
@@ -1,9 +1,52 @@
 #ifndef INCLUDE_PARSER_PARSER_H_
 #define INCLUDE_PARSER_PARSER_H_
 
+#include "../diagnostics.h"
+#include "../intern.h"
+#include "../macro.h"
 #include "../tokenlist.h"
 #include "util.h"
 
+/**
+ * Parses a program using the parser generated from doc/parser_grammar.txt
+ */
 parse_result_t parse(tokenlist_entry_t *current);
 
+/**
+ * Parses a program using the hand written parser combinators. This is the
+ * reference implementation the generated parser is tested against, both must
+ * produce identical trees.
+ */
+parse_result_t parse_reference(tokenlist_entry_t *current);
+
+typedef struct parse_options {
+    /* use the reference parser combinators instead of the generated parser */
+    bool reference;
+    /* hash-cons the operands of every statement into this table as soon as
+     * the statement is parsed, so duplicate operand subtrees never pile up.
+     * See intern.h for what sharing means for users of the tree. */
+    intern_t *intern;
+    /* record a diagnostic for every statement that can't be parsed and resume
+     * at the next line. Without diagnostics parsing stops at the first such
+     * statement. */
+    diagnostics_t *diagnostics;
+    /* expand macros and repetitions with this table, which has to outlive
+     * the program since statements reference the lines it copies. Without
+     * it the lines defining and using them don't parse. See macro.h. */
+    macros_t *macros;
+} parse_options_t;
+
+/**
+ * Parses a program statement by statement. Statements never continue on the
+ * next line, while parsing a line it is cut off from the rest of the list.
+ * When the diagnostics limit is reached parsing stops and next points at the
+ * statement that failed. The expressions of every statement are folded as
+ * soon as it is parsed, see expression.h, statements with expressions that
+ * can't be folded fail like statements that don't parse. Lines that expand
+ * macros and repetitions are replaced by their expansions before they are
+ * parsed, next may point into a macro's body then.
+ */
+parse_result_t parse_program(tokenlist_entry_t *current,
+                             const parse_options_t *options);
+
 #endif // INCLUDE_PARSER_PARSER_H_
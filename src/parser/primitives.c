@@ -62,6 +62,42 @@ parse_result_t parse_dot(tokenlist_entry_t *current) {
     return parse_token(current, TOKEN_DOT, NODE_DOT, nullptr);
 }
 
+parse_result_t parse_slash(tokenlist_entry_t *current) {
+    return parse_token(current, TOKEN_SLASH, NODE_SLASH, nullptr);
+}
+
+parse_result_t parse_shift_left(tokenlist_entry_t *current) {
+    return parse_token(current, TOKEN_SHIFT_LEFT, NODE_SHIFT_LEFT, nullptr);
+}
+
+parse_result_t parse_shift_right(tokenlist_entry_t *current) {
+    return parse_token(current, TOKEN_SHIFT_RIGHT, NODE_SHIFT_RIGHT, nullptr);
+}
+
+parse_result_t parse_ampersand(tokenlist_entry_t *current) {
+    return parse_token(current, TOKEN_AMPERSAND, NODE_AMPERSAND, nullptr);
+}
+
+parse_result_t parse_pipe(tokenlist_entry_t *current) {
+    return parse_token(current, TOKEN_PIPE, NODE_PIPE, nullptr);
+}
+
+parse_result_t parse_tilde(tokenlist_entry_t *current) {
+    return parse_token(current, TOKEN_TILDE, NODE_TILDE, nullptr);
+}
+
+parse_result_t parse_lparen(tokenlist_entry_t *current) {
+    return parse_token(current, TOKEN_LPAREN, NODE_LPAREN, nullptr);
+}
+
+parse_result_t parse_rparen(tokenlist_entry_t *current) {
+    return parse_token(current, TOKEN_RPAREN, NODE_RPAREN, nullptr);
+}
+
+parse_result_t parse_dollar(tokenlist_entry_t *current) {
+    return parse_token(current, TOKEN_DOLLAR, NODE_DOLLAR, nullptr);
+}
+
 parse_result_t parse_label_reference(tokenlist_entry_t *current) {
     return parse_token(current, TOKEN_IDENTIFIER, NODE_LABEL_REFERENCE,
                        nullptr);
@@ -101,3 +137,39 @@ parse_result_t parse_section(tokenlist_entry_t *current) {
     return parse_token(current, TOKEN_IDENTIFIER, NODE_SECTION,
                        is_section_token);
 }
+
+bool is_align_token(lexer_token_t *token) {
+    return strcmp(token->value, "align") == 0;
+}
+
+parse_result_t parse_align(tokenlist_entry_t *current) {
+    return parse_token(current, TOKEN_IDENTIFIER, NODE_ALIGN, is_align_token);
+}
+
+bool is_data_token(lexer_token_t *token) {
+    return strcmp(token->value, "db") == 0 || strcmp(token->value, "dw") == 0 ||
+           strcmp(token->value, "dd") == 0 || strcmp(token->value, "dq") == 0;
+}
+
+parse_result_t parse_data(tokenlist_entry_t *current) {
+    return parse_token(current, TOKEN_IDENTIFIER, NODE_DATA, is_data_token);
+}
+
+bool is_incbin_token(lexer_token_t *token) {
+    return strcmp(token->value, "incbin") == 0;
+}
+
+parse_result_t parse_incbin(tokenlist_entry_t *current) {
+    return parse_token(current, TOKEN_IDENTIFIER, NODE_INCBIN,
+                       is_incbin_token);
+}
+
+bool is_global_token(lexer_token_t *token) {
+    return strcmp(token->value, "global") == 0 ||
+           strcmp(token->value, "globl") == 0;
+}
+
+parse_result_t parse_global(tokenlist_entry_t *current) {
+    return parse_token(current, TOKEN_IDENTIFIER, NODE_GLOBAL,
+                       is_global_token);
+}
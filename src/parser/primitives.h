@@ -18,6 +18,15 @@ parse_result_t parse_plus(tokenlist_entry_t *current);
 parse_result_t parse_minus(tokenlist_entry_t *current);
 parse_result_t parse_asterisk(tokenlist_entry_t *current);
 parse_result_t parse_dot(tokenlist_entry_t *current);
+parse_result_t parse_slash(tokenlist_entry_t *current);
+parse_result_t parse_shift_left(tokenlist_entry_t *current);
+parse_result_t parse_shift_right(tokenlist_entry_t *current);
+parse_result_t parse_ampersand(tokenlist_entry_t *current);
+parse_result_t parse_pipe(tokenlist_entry_t *current);
+parse_result_t parse_tilde(tokenlist_entry_t *current);
+parse_result_t parse_lparen(tokenlist_entry_t *current);
+parse_result_t parse_rparen(tokenlist_entry_t *current);
+parse_result_t parse_dollar(tokenlist_entry_t *current);
 parse_result_t parse_label_reference(tokenlist_entry_t *current);
 
 /* These are "primitives" with a different name and some extra validation on top
@@ -26,5 +35,9 @@ parse_result_t parse_label_reference(tokenlist_entry_t *current);
  */
 parse_result_t parse_register(tokenlist_entry_t *current);
 parse_result_t parse_section(tokenlist_entry_t *current);
+parse_result_t parse_align(tokenlist_entry_t *current);
+parse_result_t parse_data(tokenlist_entry_t *current);
+parse_result_t parse_incbin(tokenlist_entry_t *current);
+parse_result_t parse_global(tokenlist_entry_t *current);
 
 #endif // INCLUDE_PARSER_PRIMITIVES_H_
@@ -1,5 +1,6 @@
 #include "util.h"
 #include "../tokenlist.h"
+#include <stdlib.h>
 
 error_t *err_parse_no_match =
     &(error_t){.message = "parsing failed to find the correct token sequence"};
@@ -17,13 +18,51 @@ parse_result_t parse_success(ast_node_t *ast, tokenlist_entry_t *next) {
     return (parse_result_t){.node = ast, .next = next};
 }
 
-parse_result_t parse_token(tokenlist_entry_t *current,
-                           lexer_token_id_t token_id, node_id_t ast_id,
-                           token_validator_t is_valid) {
-    if (current->token.id != token_id ||
-        (is_valid && !is_valid(&current->token)))
-        return parse_no_match();
+/**
+ * Converts the value of a number token and its optional size suffix. Returns
+ * false if the number doesn't fit in 64 bits.
+ */
+static bool parse_number_value(ast_node_t *node) {
+    const char *value = node->token_entry->token.value;
+    uint64_t base = 10;
+    switch (node->id) {
+    case NODE_HEXADECIMAL:
+        base = 16;
+        value += 2;
+        break;
+    case NODE_OCTAL:
+        base = 8;
+        value += 2;
+        break;
+    case NODE_BINARY:
+        base = 2;
+        value += 2;
+        break;
+    default:
+        break;
+    }
+
+    uint64_t result = 0;
+    for (; *value && *value != ':'; ++value) {
+        uint64_t digit;
+        if (*value >= '0' && *value <= '9')
+            digit = *value - '0';
+        else if (*value >= 'a' && *value <= 'f')
+            digit = *value - 'a' + 10;
+        else
+            digit = *value - 'A' + 10;
+        if (result > (UINT64_MAX - digit) / base)
+            return false;
+        result = result * base + digit;
+    }
+
+    node->value.integer.value = result;
+    node->value.integer.size = *value == ':' ? atoi(value + 1) : 0;
+    return true;
+}
 
+// Creates the node for a token that has already been matched
+parse_result_t parse_token_node(tokenlist_entry_t *current, node_id_t ast_id) {
     ast_node_t *node;
     error_t *err = ast_node_alloc(&node);
     if (err)
@@ -31,9 +70,32 @@ parse_result_t parse_token(tokenlist_entry_t *current,
     node->id = ast_id;
     node->token_entry = current;
 
+    switch (ast_id) {
+    case NODE_DECIMAL:
+    case NODE_HEXADECIMAL:
+    case NODE_OCTAL:
+    case NODE_BINARY:
+        if (!parse_number_value(node)) {
+            ast_node_free(node);
+            return parse_no_match();
+        }
+        break;
+    default:
+        break;
+    }
+
     return parse_success(node, current->next);
 }
 
+parse_result_t parse_token(tokenlist_entry_t *current,
+                           lexer_token_id_t token_id, node_id_t ast_id,
+                           token_validator_t is_valid) {
+    if (current == nullptr || current->token.id != token_id ||
+        (is_valid && !is_valid(&current->token)))
+        return parse_no_match();
+    return parse_token_node(current, ast_id);
+}
+
 parse_result_t parse_result_wrap(node_id_t id, parse_result_t result) {
     if (result.err)
         return result;
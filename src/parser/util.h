@@ -16,6 +16,7 @@ typedef bool (*token_validator_t)(lexer_token_t *);
 parse_result_t parse_error(error_t *err);
 parse_result_t parse_no_match();
 parse_result_t parse_success(ast_node_t *ast, tokenlist_entry_t *next);
+parse_result_t parse_token_node(tokenlist_entry_t *current, node_id_t ast_id);
 parse_result_t parse_token(tokenlist_entry_t *current,
                            lexer_token_id_t token_id, node_id_t ast_id,
                            token_validator_t is_valid);
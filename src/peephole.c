@@ -0,0 +1,384 @@
+#include "peephole.h"
+#include "ast.h"
+#include "encoder/table.h"
+#include "error.h"
+#include "expression.h"
+#include "tokenlist.h"
+#include <stdlib.h>
+#include <string.h>
+
+constexpr size_t peephole_default_cap = 16;
+/* How many instructions the pass looks ahead for one that sets the flags */
+constexpr size_t peephole_flags_window = 16;
+
+/* Set every arithmetic flag without reading any */
+static const char *peephole_flag_writers[] = {
+    "add", "sub", "cmp", "test", "and", "or", "xor", "neg",
+};
+
+/* Neither read nor write the flags */
+static const char *peephole_flag_keepers[] = {
+    "mov",  "movzx", "movsx", "movsxd", "lea",    "push",   "pop",
+    "not",  "bswap", "xchg",  "nop",    "pause",  "cbw",    "cwde",
+    "cdqe", "cwd",   "cdq",   "cqo",    "lfence", "mfence", "sfence",
+};
+
+static bool peephole_contains(const char **mnemonics, size_t len,
+                              const char *mnemonic) {
+    for (size_t i = 0; i < len; ++i)
+        if (strcmp(mnemonics[i], mnemonic) == 0)
+            return true;
+    return false;
+}
+
+static const char *peephole_mnemonic(ast_node_t *statement) {
+    return ast_node_child(statement, 0)->token_entry->token.value;
+}
+
+// Whether flags set at the statement are set again before anything could read
+// them. Labels, directives, jumps and the end of the program might lead to
+// code reading them.
+static bool peephole_flags_dead(ast_node_t *program, size_t statement) {
+    size_t end = statement + 1 + peephole_flags_window;
+    for (size_t i = statement + 1; i < program->len && i < end; ++i) {
+        ast_node_t *next = ast_node_child(program, i);
+        if (next->id != NODE_INSTRUCTION)
+            return false;
+        const char *mnemonic = peephole_mnemonic(next);
+        if (peephole_contains(peephole_flag_writers,
+                              sizeof(peephole_flag_writers) /
+                                  sizeof(peephole_flag_writers[0]),
+                              mnemonic))
+            return true;
+        if (!peephole_contains(peephole_flag_keepers,
+                               sizeof(peephole_flag_keepers) /
+                                   sizeof(peephole_flag_keepers[0]),
+                               mnemonic))
+            return false;
+    }
+    return false;
+}
+
+static const register_info_t *peephole_register(ast_node_t *node) {
+    return register_lookup(node->token_entry->token.value);
+}
+
+// Creates a token for a name the original doesn't have, where its mnemonic is
+static error_t *peephole_token(peephole_t *peephole, ast_node_t *instruction,
+                               const char *value, tokenlist_entry_t **output) {
+    *output = nullptr;
+
+    tokenlist_entry_t *entry;
+    error_t *err = tokenlist_entry_alloc(&entry);
+    if (err)
+        return err;
+    entry->token = ast_node_child(instruction, 0)->token_entry->token;
+    entry->token.explanation = nullptr;
+    entry->token.value = strdup(value);
+    if (entry->token.value == nullptr) {
+        free(entry);
+        return err_allocation_failed;
+    }
+    tokenlist_append(peephole->tokens, entry);
+
+    *output = entry;
+    return nullptr;
+}
+
+static error_t *peephole_node(node_id_t id, tokenlist_entry_t *token,
+                              ast_node_t **output) {
+    error_t *err = ast_node_alloc(output);
+    if (err)
+        return err;
+    (*output)->id = id;
+    (*output)->token_entry = token;
+    return nullptr;
+}
+
+// Adds the child or frees it, so callers can hand over children unchecked
+static error_t *peephole_add_child(ast_node_t *node, ast_node_t *child) {
+    error_t *err = ast_node_add_child(node, child);
+    if (err)
+        ast_node_free(child);
+    return err;
+}
+
+// Creates an instruction of the original's tokens with another mnemonic. The
+// operands are taken over, even on failure.
+static error_t *peephole_instruction(peephole_t *peephole,
+                                     ast_node_t *original,
+                                     const char *mnemonic,
+                                     ast_node_t **operands, size_t count,
+                                     ast_node_t **output) {
+    *output = nullptr;
+
+    ast_node_t *instruction = nullptr, *mnemonic_node = nullptr,
+               *operands_node = nullptr;
+    tokenlist_entry_t *token;
+    error_t *err = peephole_token(peephole, original, mnemonic, &token);
+    if (err == nullptr)
+        err = peephole_node(original->id, original->token_entry, &instruction);
+    if (err == nullptr)
+        err = peephole_node(NODE_IDENTIFIER, token, &mnemonic_node);
+    if (err == nullptr)
+        err = peephole_add_child(instruction, mnemonic_node);
+    if (err == nullptr)
+        err = peephole_node(NODE_OPERANDS,
+                            ast_node_child(original, 1)->token_entry,
+                            &operands_node);
+    if (err == nullptr)
+        err = peephole_add_child(instruction, operands_node);
+
+    size_t i = 0;
+    for (; err == nullptr && i < count; ++i)
+        err = peephole_add_child(operands_node, operands[i]);
+    if (err) {
+        for (; i < count; ++i)
+            ast_node_free(operands[i]);
+        ast_node_free(instruction);
+        return err;
+    }
+
+    *output = instruction;
+    return nullptr;
+}
+
+static bool peephole_zero_applies(ast_node_t *operands) {
+    ast_node_t *number = ast_node_child(ast_node_child(operands, 1), 0);
+    if (number->id != NODE_NUMBER)
+        return false;
+    // A size suffix picks a form, which may not even exist
+    ast_node_t *value = ast_node_child(number, 0);
+    return value->value.integer.value == 0 && value->value.integer.size == 0;
+}
+
+// mov reg, 0 to xor reg, reg. Writing a 32 bit register clears the upper half
+// of the 64 bit one, which saves the REX prefix.
+static error_t *peephole_zero(peephole_t *peephole, ast_node_t *instruction,
+                              ast_node_t **output) {
+    ast_node_t *reg = ast_node_child(ast_node_child(instruction, 1), 0);
+    const register_info_t *info = peephole_register(reg);
+
+    char name[8] = {};
+    if (info->size == 64) {
+        // rax to eax and r8 to r8d
+        if (info->name[1] >= '0' && info->name[1] <= '9')
+            snprintf(name, sizeof(name), "%sd", info->name);
+        else
+            snprintf(name, sizeof(name), "e%s", info->name + 1);
+    }
+    const register_info_t *narrow = name[0] ? register_lookup(name) : nullptr;
+
+    if (narrow == nullptr) {
+        ast_node_t *operands[] = {ast_node_share(reg), ast_node_share(reg)};
+        return peephole_instruction(peephole, instruction, "xor", operands, 2,
+                                    output);
+    }
+
+    tokenlist_entry_t *token;
+    ast_node_t *narrow_reg;
+    error_t *err = peephole_token(peephole, instruction, narrow->name, &token);
+    if (err == nullptr)
+        err = peephole_node(NODE_REGISTER, token, &narrow_reg);
+    if (err)
+        return err;
+    ast_node_t *operands[] = {narrow_reg, ast_node_share(narrow_reg)};
+    return peephole_instruction(peephole, instruction, "xor", operands, 2,
+                                output);
+}
+
+static bool peephole_lea_applies(ast_node_t *operands) {
+    ast_node_t *reg = ast_node_child(operands, 0);
+    ast_node_t *expression = ast_node_child(ast_node_child(operands, 1), 1);
+    if (expression->id != NODE_REGISTER_EXPRESSION || expression->len != 2)
+        return false;
+    ast_node_t *offset = ast_node_child(expression, 1);
+    if (offset->id != NODE_REGISTER_OFFSET)
+        return false;
+
+    const register_info_t *info = peephole_register(reg);
+    if (peephole_register(ast_node_child(expression, 0)) != info ||
+        (info->size != 32 && info->size != 64))
+        return false;
+
+    // The immediate is sign extended like the displacement, but negating it
+    // can leave the range of either. Negative folded displacements are left
+    // alone for the same reason.
+    ast_node_t *number = ast_node_child(ast_node_child(offset, 1), 0);
+    uint64_t limit = number->value.integer.size == 8 ? 0x7f : 0x7fffffff;
+    return number->value.integer.value != 0 &&
+           number->value.integer.value <= limit;
+}
+
+// lea reg, [reg + n] to add reg, n and lea reg, [reg - n] to sub reg, n
+static error_t *peephole_lea(peephole_t *peephole, ast_node_t *instruction,
+                             ast_node_t **output) {
+    ast_node_t *operands = ast_node_child(instruction, 1);
+    ast_node_t *reg = ast_node_child(operands, 0);
+    ast_node_t *expression = ast_node_child(ast_node_child(operands, 1), 1);
+    ast_node_t *offset = ast_node_child(expression, 1);
+    ast_node_t *number = ast_node_child(offset, 1);
+    bool negative = ast_node_child(offset, 0)->id == NODE_MINUS &&
+                    !expression_folded(number);
+
+    ast_node_t *immediate;
+    error_t *err = peephole_node(NODE_IMMEDIATE, nullptr, &immediate);
+    if (err == nullptr)
+        err = peephole_add_child(immediate, ast_node_share(number));
+    if (err) {
+        ast_node_free(immediate);
+        return err;
+    }
+    ast_node_t *replacement[] = {ast_node_share(reg), immediate};
+    return peephole_instruction(peephole, instruction, negative ? "sub" : "add",
+                                replacement, 2, output);
+}
+
+// Writing a 32 bit register clears the upper half, so only moves of other
+// sizes do nothing
+static bool peephole_self_move_applies(ast_node_t *operands) {
+    const register_info_t *destination =
+        peephole_register(ast_node_child(operands, 0));
+    return destination->size != 32 &&
+           peephole_register(ast_node_child(operands, 1)) == destination;
+}
+
+static error_t *peephole_drop(peephole_t *, ast_node_t *,
+                              ast_node_t **output) {
+    *output = nullptr;
+    return nullptr;
+}
+
+static const peephole_rule_t peephole_rules[] = {
+    {
+        .name = "mov reg, 0 to xor reg, reg",
+        .mnemonic = "mov",
+        .operand_count = 2,
+        .operands = {NODE_REGISTER, NODE_IMMEDIATE},
+        .clobbers_flags = true,
+        .applies = peephole_zero_applies,
+        .rewrite = peephole_zero,
+    },
+    {
+        .name = "lea reg, [reg + n] to add reg, n",
+        .mnemonic = "lea",
+        .operand_count = 2,
+        .operands = {NODE_REGISTER, NODE_MEMORY},
+        .clobbers_flags = true,
+        .applies = peephole_lea_applies,
+        .rewrite = peephole_lea,
+    },
+    {
+        .name = "mov reg, reg removed",
+        .mnemonic = "mov",
+        .operand_count = 2,
+        .operands = {NODE_REGISTER, NODE_REGISTER},
+        .clobbers_flags = false,
+        .applies = peephole_self_move_applies,
+        .rewrite = peephole_drop,
+    },
+};
+
+constexpr size_t peephole_rule_count =
+    sizeof(peephole_rules) / sizeof(peephole_rules[0]);
+
+static const peephole_rule_t *peephole_match(ast_node_t *program,
+                                             size_t statement) {
+    ast_node_t *instruction = ast_node_child(program, statement);
+    if (instruction->id != NODE_INSTRUCTION)
+        return nullptr;
+    const char *mnemonic = peephole_mnemonic(instruction);
+    ast_node_t *operands = ast_node_child(instruction, 1);
+
+    for (size_t i = 0; i < peephole_rule_count; ++i) {
+        const peephole_rule_t *rule = &peephole_rules[i];
+        if (strcmp(rule->mnemonic, mnemonic) != 0 ||
+            operands->len != rule->operand_count)
+            continue;
+        bool matches = true;
+        for (size_t j = 0; j < rule->operand_count && matches; ++j)
+            matches = ast_node_child(operands, j)->id == rule->operands[j];
+        if (matches && rule->applies(operands) &&
+            (!rule->clobbers_flags || peephole_flags_dead(program, statement)))
+            return rule;
+    }
+    return nullptr;
+}
+
+error_t *peephole_alloc(peephole_t **output) {
+    *output = nullptr;
+
+    peephole_t *peephole = calloc(1, sizeof(peephole_t));
+    if (peephole == nullptr)
+        return err_allocation_failed;
+    error_t *err = tokenlist_alloc(&peephole->tokens);
+    if (err) {
+        free(peephole);
+        return err;
+    }
+
+    *output = peephole;
+    return nullptr;
+}
+
+void peephole_free(peephole_t *peephole) {
+    if (peephole == nullptr)
+        return;
+    tokenlist_free(peephole->tokens);
+    free(peephole->rewrites);
+    free(peephole);
+}
+
+static error_t *peephole_add_rewrite(peephole_t *peephole,
+                                     const peephole_rule_t *rule,
+                                     tokenlist_entry_t *token) {
+    if (peephole->len == peephole->cap) {
+        size_t new_cap =
+            peephole->cap ? peephole->cap * 2 : peephole_default_cap;
+        peephole_rewrite_t *rewrites =
+            realloc(peephole->rewrites, new_cap * sizeof(*rewrites));
+        if (rewrites == nullptr)
+            return err_allocation_failed;
+        peephole->rewrites = rewrites;
+        peephole->cap = new_cap;
+    }
+    peephole->rewrites[peephole->len++] = (peephole_rewrite_t){rule, token};
+    return nullptr;
+}
+
+error_t *peephole_optimize(peephole_t *peephole, ast_node_t *program) {
+    // Statements move to the front over the dropped ones. Only the ones in
+    // front of the current statement move, flags are always looked up in the
+    // statements behind it as they were written.
+    error_t *err = nullptr;
+    size_t kept = 0;
+    for (size_t i = 0; i < program->len; ++i) {
+        ast_node_t *statement = ast_node_child(program, i);
+        const peephole_rule_t *rule =
+            err ? nullptr : peephole_match(program, i);
+        if (rule) {
+            ast_node_t *replacement;
+            tokenlist_entry_t *token =
+                ast_node_child(statement, 0)->token_entry;
+            err = rule->rewrite(peephole, statement, &replacement);
+            if (err == nullptr) {
+                err = peephole_add_rewrite(peephole, rule, token);
+                ast_node_free(statement);
+                statement = replacement;
+            }
+        }
+        if (statement)
+            *ast_node_child_slot(program, kept++) = statement;
+    }
+    program->len = kept;
+    return err;
+}
+
+void peephole_print(const peephole_t *peephole, FILE *file) {
+    for (size_t i = 0; i < peephole->len; ++i) {
+        lexer_token_t *token = &peephole->rewrites[i].token->token;
+        fprintf(file, "%zu:%zu: %s\n", token->line_number + 1,
+                token->character_number + 1, peephole->rewrites[i].rule->name);
+    }
+    fprintf(file, "peephole: %zu rewrites\n", peephole->len);
+}
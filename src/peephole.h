@@ -0,0 +1,93 @@
+#ifndef INCLUDE_SRC_PEEPHOLE_H_
+#define INCLUDE_SRC_PEEPHOLE_H_
+
+#include "ast.h"
+#include "error.h"
+#include "tokenlist.h"
+#include <stddef.h>
+#include <stdio.h>
+
+/* The peephole pass rewrites instructions of a parsed program into smaller or
+ * faster equivalents before they are encoded. Every rewrite is a rule of a
+ * table: the mnemonic and operand nodes it matches, a further condition on the
+ * operands and whether the replacement sets flags the original left alone.
+ * Such rewrites only fire when a later instruction in the same straight line
+ * of code sets every flag before any instruction could read them.
+ *
+ * Replacements share the operand subtrees of the instructions they replace,
+ * so they work on trees with interned operands. Mnemonics and registers that
+ * don't appear in the original get tokens of the pass, placed where the
+ * mnemonic of the original is. */
+
+typedef struct peephole peephole_t;
+
+typedef struct peephole_rule {
+    /* the rewrite as shown in the report */
+    const char *name;
+    const char *mnemonic;
+    size_t operand_count;
+    node_id_t operands[2];
+    /* the replacement sets flags the original leaves alone */
+    bool clobbers_flags;
+    /* further conditions on the operands node */
+    bool (*applies)(ast_node_t *operands);
+    /* creates the replacement, an output of nullptr drops the instruction */
+    error_t *(*rewrite)(peephole_t *peephole, ast_node_t *instruction,
+                        ast_node_t **output);
+} peephole_rule_t;
+
+/* A rewrite that fired, at the mnemonic of the original instruction */
+typedef struct peephole_rewrite {
+    const peephole_rule_t *rule;
+    tokenlist_entry_t *token;
+} peephole_rewrite_t;
+
+struct peephole {
+    /* tokens of the mnemonics and registers the replacements introduce */
+    tokenlist_t *tokens;
+    size_t len;
+    size_t cap;
+    peephole_rewrite_t *rewrites;
+};
+
+/**
+ * @brief Allocate a new peephole pass without any rewrites
+ *
+ * @param[out] output Pointer to the allocated pass
+ * @return error_t* nullptr on success, allocation error on failure
+ */
+error_t *peephole_alloc(peephole_t **output);
+
+/**
+ * @brief Free the pass and the tokens of its replacements
+ *
+ * Programs it rewrote can't be used anymore. If peephole is nullptr, the
+ * function returns without doing anything.
+ *
+ * @param peephole The pass to free
+ */
+void peephole_free(peephole_t *peephole);
+
+/**
+ * @brief Rewrite the instructions of a program
+ *
+ * Replaced instructions are freed and dropped ones are removed from the
+ * program, so it may have fewer statements afterwards. Every rewrite is added
+ * to the report of the pass.
+ *
+ * @param peephole The pass
+ * @param program The program, which must have parsed without diagnostics
+ * @return error_t* nullptr on success, allocation error on failure. On failure
+ *         the program is still valid but only partially rewritten.
+ */
+error_t *peephole_optimize(peephole_t *peephole, ast_node_t *program);
+
+/**
+ * @brief Print every rewrite with its line and column and how many there are
+ *
+ * @param peephole The pass
+ * @param file The file to print to
+ */
+void peephole_print(const peephole_t *peephole, FILE *file);
+
+#endif // INCLUDE_SRC_PEEPHOLE_H_
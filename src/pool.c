@@ -0,0 +1,116 @@
+#include "pool.h"
+#include "error.h"
+#include <stdlib.h>
+#include <unistd.h>
+
+typedef struct pool_worker {
+    pool_t *pool;
+    size_t index;
+    pthread_t thread;
+    bool started;
+} pool_worker_t;
+
+error_t *pool_alloc(pool_t **output, size_t threads) {
+    *output = nullptr;
+
+    if (threads == 0) {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = online > 0 ? online : 1;
+    }
+
+    pool_t *pool = calloc(1, sizeof(pool_t));
+    if (pool == nullptr)
+        return err_allocation_failed;
+    pool->shares = calloc(threads, sizeof(pool_share_t));
+    if (pool->shares == nullptr) {
+        free(pool);
+        return err_allocation_failed;
+    }
+    for (size_t i = 0; i < threads; ++i)
+        pthread_mutex_init(&pool->shares[i].lock, nullptr);
+    pool->threads = threads;
+
+    *output = pool;
+    return nullptr;
+}
+
+void pool_free(pool_t *pool) {
+    if (pool == nullptr)
+        return;
+    for (size_t i = 0; i < pool->threads; ++i)
+        pthread_mutex_destroy(&pool->shares[i].lock);
+    free(pool->shares);
+    free(pool);
+}
+
+// Takes the next task of the share, returns false if it is empty
+static bool pool_take(pool_share_t *share, size_t *task) {
+    pthread_mutex_lock(&share->lock);
+    bool taken = share->begin < share->end;
+    if (taken)
+        *task = share->begin++;
+    pthread_mutex_unlock(&share->lock);
+    return taken;
+}
+
+// Moves the back half of the first share of another worker that has tasks
+// left to the share of self, returns false if none has any
+static bool pool_steal(pool_t *pool, size_t self) {
+    for (size_t i = 1; i < pool->threads; ++i) {
+        pool_share_t *victim = &pool->shares[(self + i) % pool->threads];
+        pthread_mutex_lock(&victim->lock);
+        size_t begin = victim->begin + (victim->end - victim->begin) / 2;
+        size_t end = victim->end;
+        victim->end = begin;
+        pthread_mutex_unlock(&victim->lock);
+        if (begin == end)
+            continue;
+
+        // Only its owner refills a share, so it is still empty
+        pool_share_t *share = &pool->shares[self];
+        pthread_mutex_lock(&share->lock);
+        share->begin = begin;
+        share->end = end;
+        pthread_mutex_unlock(&share->lock);
+        return true;
+    }
+    return false;
+}
+
+static void pool_work(pool_t *pool, size_t self) {
+    for (;;) {
+        size_t task;
+        while (pool_take(&pool->shares[self], &task))
+            pool->task(pool->context, task, self);
+        if (!pool_steal(pool, self))
+            return;
+    }
+}
+
+static void *pool_thread(void *argument) {
+    pool_worker_t *worker = argument;
+    pool_work(worker->pool, worker->index);
+    return nullptr;
+}
+
+void pool_run(pool_t *pool, size_t count, pool_task_t task, void *context) {
+    pool->task = task;
+    pool->context = context;
+    for (size_t i = 0; i < pool->threads; ++i) {
+        pool->shares[i].begin = count * i / pool->threads;
+        pool->shares[i].end = count * (i + 1) / pool->threads;
+    }
+
+    // Without workers the calling thread steals every share
+    pool_worker_t *workers = calloc(pool->threads, sizeof(pool_worker_t));
+    for (size_t i = 1; workers && i < pool->threads; ++i) {
+        workers[i] = (pool_worker_t){.pool = pool, .index = i};
+        workers[i].started = pthread_create(&workers[i].thread, nullptr,
+                                            pool_thread, &workers[i]) == 0;
+    }
+    pool_work(pool, 0);
+    for (size_t i = 1; workers && i < pool->threads; ++i)
+        if (workers[i].started)
+            pthread_join(workers[i].thread, nullptr);
+    free(workers);
+}
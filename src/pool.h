@@ -0,0 +1,67 @@
+#ifndef INCLUDE_SRC_POOL_H_
+#define INCLUDE_SRC_POOL_H_
+
+#include "error.h"
+#include <pthread.h>
+#include <stddef.h>
+
+/* A work stealing pool of threads for numbered tasks that don't depend on
+ * each other. Every worker starts out with an equal share of consecutive
+ * tasks and runs them from the front. A worker whose share runs out steals
+ * the back half of the share of another one, so a few slow tasks don't keep
+ * the rest of the workers idle. Tasks write their results to slots of their
+ * own, so the results are the same however the tasks were spread over the
+ * workers. */
+
+/* Runs a task. Worker is the number of the worker running it, below the
+ * number of threads of the pool, for state of each worker that tasks share. */
+typedef void (*pool_task_t)(void *context, size_t task, size_t worker);
+
+/* The tasks a worker has left, from begin up to end */
+typedef struct pool_share {
+    pthread_mutex_t lock;
+    size_t begin;
+    size_t end;
+} pool_share_t;
+
+typedef struct pool {
+    size_t threads;
+    pool_share_t *shares;
+    /* the tasks of the current pool_run */
+    pool_task_t task;
+    void *context;
+} pool_t;
+
+/**
+ * @brief Allocate a new pool
+ *
+ * @param[out] output Pointer to the allocated pool
+ * @param threads Number of workers including the thread calling pool_run,
+ *        0 for one per online processor
+ * @return error_t* nullptr on success, allocation error on failure
+ */
+error_t *pool_alloc(pool_t **output, size_t threads);
+
+/**
+ * @brief Free the pool
+ *
+ * If pool is nullptr, the function returns without doing anything.
+ *
+ * @param pool The pool to free
+ */
+void pool_free(pool_t *pool);
+
+/**
+ * @brief Run tasks 0 to count - 1 and wait for all of them
+ *
+ * The calling thread is one of the workers. Workers that can't be started
+ * leave their share to the others to steal, so every task runs even then.
+ *
+ * @param pool The pool
+ * @param count Number of tasks
+ * @param task Called once for every task
+ * @param context Passed to every task
+ */
+void pool_run(pool_t *pool, size_t count, pool_task_t task, void *context);
+
+#endif // INCLUDE_SRC_POOL_H_
@@ -0,0 +1,177 @@
+#include "scan.h"
+#include "error.h"
+#include "expression.h"
+#include "parser/generated.h"
+#include <string.h>
+
+error_t *err_scan_operands = &(error_t){
+    .message = "Operands don't make up the rest of the instruction's line"};
+
+constexpr size_t scan_default_cap = 256;
+
+error_t *scan_alloc(scan_t **output) {
+    *output = nullptr;
+
+    scan_t *scan = calloc(1, sizeof(scan_t));
+    if (scan == nullptr)
+        return err_allocation_failed;
+
+    *output = scan;
+    return nullptr;
+}
+
+void scan_free(scan_t *scan) {
+    if (scan == nullptr)
+        return;
+    free(scan->statements);
+    free(scan);
+}
+
+static error_t *scan_append(scan_t *scan, scan_statement_t statement) {
+    if (scan->len == scan->cap) {
+        size_t new_cap = scan->cap ? scan->cap * 2 : scan_default_cap;
+        scan_statement_t *statements =
+            realloc(scan->statements, new_cap * sizeof(scan_statement_t));
+        if (statements == nullptr)
+            return err_allocation_failed;
+        scan->statements = statements;
+        scan->cap = new_cap;
+    }
+    scan->statements[scan->len] = statement;
+    scan->len += 1;
+    return nullptr;
+}
+
+/**
+ * Returns the next token on the same line that isn't whitespace or a comment,
+ * or nullptr if the line ends first
+ */
+static tokenlist_entry_t *scan_next_on_line(tokenlist_entry_t *current) {
+    for (current = current->next; current; current = current->next) {
+        switch (current->token.id) {
+        case TOKEN_WHITESPACE:
+        case TOKEN_COMMENT:
+            continue;
+        case TOKEN_NEWLINE:
+            return nullptr;
+        default:
+            return current;
+        }
+    }
+    return nullptr;
+}
+
+// Returns the newline token ending the line, nullptr at the end of the input
+static tokenlist_entry_t *scan_end_of_line(tokenlist_entry_t *current) {
+    while (current && current->token.id != TOKEN_NEWLINE)
+        current = current->next;
+    return current;
+}
+
+static bool scan_is_identifier(tokenlist_entry_t *entry, const char *value) {
+    return entry && entry->token.id == TOKEN_IDENTIFIER &&
+           strcmp(entry->token.value, value) == 0;
+}
+
+// Scans the statements of the line that starts at current
+static error_t *scan_line(scan_t *scan, tokenlist_entry_t *current,
+                          tokenlist_entry_t **section) {
+    while (current) {
+        tokenlist_entry_t *next = scan_next_on_line(current);
+        scan_statement_t statement = {.token = current, .section = *section};
+
+        if (current->token.id == TOKEN_IDENTIFIER && next &&
+            next->token.id == TOKEN_COLON) {
+            statement.id = SCAN_LABEL;
+            error_t *err = scan_append(scan, statement);
+            if (err)
+                return err;
+            // Another statement may follow the label on the same line
+            current = scan_next_on_line(next);
+            continue;
+        }
+
+        if (current->token.id == TOKEN_DOT &&
+            scan_is_identifier(next, "section")) {
+            tokenlist_entry_t *name = scan_next_on_line(next);
+            if (name && name->token.id == TOKEN_IDENTIFIER) {
+                *section = name;
+                statement.id = SCAN_SECTION;
+                statement.token = name;
+                statement.section = name;
+                return scan_append(scan, statement);
+            }
+        } else if (current->token.id == TOKEN_IDENTIFIER) {
+            statement.id = SCAN_INSTRUCTION;
+            statement.operands = next;
+            statement.operands_end = scan_end_of_line(current);
+            return scan_append(scan, statement);
+        }
+        return nullptr;
+    }
+    return nullptr;
+}
+
+// Moves on to the next line with the macros expanded, the lines that can't
+// be expanded are skipped like any other line the scan doesn't know
+static error_t *scan_expand(macros_t *macros, tokenlist_entry_t **line) {
+    while (true) {
+        tokenlist_entry_t *newline;
+        tokenlist_entry_t *token;
+        error_t *err = macros_next(macros, line, &newline, &token);
+        if (err == nullptr || err == err_allocation_failed)
+            return err;
+    }
+}
+
+error_t *scan_fill(scan_t *scan, tokenlist_t *list, macros_t *macros) {
+    tokenlist_entry_t *section = nullptr;
+    tokenlist_entry_t *current = tokenlist_skip_trivia(list->head);
+
+    if (macros)
+        macros_start(macros, current);
+    while (true) {
+        if (macros) {
+            error_t *err = scan_expand(macros, &current);
+            if (err)
+                return err;
+        }
+        if (current == nullptr)
+            return nullptr;
+
+        error_t *err = scan_line(scan, current, &section);
+        if (err)
+            return err;
+        if (macros == nullptr)
+            current = tokenlist_skip_trivia(scan_end_of_line(current));
+    }
+}
+
+parse_result_t scan_parse_operands(scan_statement_t *statement) {
+    tokenlist_entry_t *end = tokenlist_skip_trivia(statement->operands_end);
+
+    if (statement->operands == nullptr) {
+        ast_node_t *node;
+        error_t *err = ast_node_alloc(&node);
+        if (err)
+            return parse_error(err);
+        node->id = NODE_OPERANDS;
+        return parse_success(node, end);
+    }
+
+    parse_result_t result = parse_generated_operands(statement->operands);
+    if (result.err)
+        return result;
+    if (result.next != end) {
+        ast_node_free(result.node);
+        return parse_error(err_scan_operands);
+    }
+    // The operands are those the parser would have built
+    tokenlist_entry_t *token;
+    error_t *err = expression_fold_operands(result.node, &token);
+    if (err) {
+        ast_node_free(result.node);
+        return parse_error(err);
+    }
+    return result;
+}
@@ -0,0 +1,76 @@
+#ifndef INCLUDE_SRC_SCAN_H_
+#define INCLUDE_SRC_SCAN_H_
+
+#include "error.h"
+#include "macro.h"
+#include "parser/util.h"
+#include "tokenlist.h"
+
+/* A scan finds the statements in a token list without parsing their operands,
+ * which is all tools that only need labels and sections have to pay for.
+ * Unlike the parser it treats every line as its own statement, though a label
+ * may still be followed by another statement on the same line. Given a macro
+ * table, the scan reads the lines macros_next returns like the parser does,
+ * so it sees the statements of expanded macros, repetitions and included
+ * files and never those of the bodies themselves. */
+
+typedef enum scan_statement_id {
+    SCAN_LABEL,
+    SCAN_SECTION,
+    SCAN_INSTRUCTION,
+} scan_statement_id_t;
+
+typedef struct scan_statement {
+    scan_statement_id_t id;
+    /* label name, section name or instruction mnemonic */
+    tokenlist_entry_t *token;
+    /* name of the section the statement is in, nullptr before any .section */
+    tokenlist_entry_t *section;
+    /* instructions only: first operand token and the token ending the line,
+     * which is nullptr for the last line of the input and copied lines */
+    tokenlist_entry_t *operands;
+    tokenlist_entry_t *operands_end;
+} scan_statement_t;
+
+typedef struct scan {
+    size_t len;
+    size_t cap;
+    scan_statement_t *statements;
+} scan_t;
+
+extern error_t *err_scan_operands;
+
+/**
+ * @brief Allocate a new, empty scan
+ */
+error_t *scan_alloc(scan_t **scan);
+
+void scan_free(scan_t *scan);
+
+/**
+ * @brief Finds all labels, sections and instructions in the token list
+ *
+ * Lines that aren't any of those are skipped, as are lines macros can't
+ * expand, parse the token list to get diagnostics for them.
+ *
+ * @param scan The scan to append the statements to
+ * @param list The token list
+ * @param macros Expands the lines of the list, nullptr scans the lines as
+ *        they are. The statements of copied lines reference tokens the table
+ *        owns, so it has to outlive the scan.
+ * @return error_t* nullptr on success, allocation error on failure
+ */
+error_t *scan_fill(scan_t *scan, tokenlist_t *list, macros_t *macros);
+
+/**
+ * @brief Parses the operands of a scanned instruction on demand
+ *
+ * The expressions in the operands are folded like the parser folds them.
+ *
+ * @return parse_result_t a NODE_OPERANDS tree on success, err_scan_operands
+ *         if the operands don't make up the rest of the instruction's line,
+ *         err_expression_* for expressions that can't be folded
+ */
+parse_result_t scan_parse_operands(scan_statement_t *statement);
+
+#endif // INCLUDE_SRC_SCAN_H_
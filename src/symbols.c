@@ -0,0 +1,107 @@
+#include "symbols.h"
+#include "error.h"
+#include <stdlib.h>
+#include <string.h>
+
+constexpr size_t symbols_default_cap = 256;
+
+constexpr uint64_t symbols_fnv_offset = 0xcbf29ce484222325;
+constexpr uint64_t symbols_fnv_prime = 0x100000001b3;
+
+error_t *symbols_alloc(symbols_t **output) {
+    *output = nullptr;
+
+    symbols_t *symbols = calloc(1, sizeof(symbols_t));
+    if (symbols == nullptr)
+        return err_allocation_failed;
+
+    *output = symbols;
+    return nullptr;
+}
+
+void symbols_free(symbols_t *symbols) {
+    if (symbols == nullptr)
+        return;
+    free(symbols->entries);
+    free(symbols);
+}
+
+void symbols_clear(symbols_t *symbols) {
+    if (symbols->cap)
+        memset(symbols->entries, 0, symbols->cap * sizeof(symbol_t));
+    symbols->len = 0;
+}
+
+// FNV-1a over the name
+static uint64_t symbols_hash(const char *name) {
+    uint64_t hash = symbols_fnv_offset;
+    for (; *name; ++name)
+        hash = (hash ^ (unsigned char)*name) * symbols_fnv_prime;
+    return hash;
+}
+
+static symbol_t *symbols_probe(symbol_t *entries, size_t cap, uint64_t hash,
+                               const char *name) {
+    size_t mask = cap - 1;
+    for (size_t i = hash & mask;; i = (i + 1) & mask) {
+        symbol_t *entry = &entries[i];
+        if (entry->name == nullptr)
+            return entry;
+        if (entry->hash == hash && strcmp(entry->name, name) == 0)
+            return entry;
+    }
+}
+
+static error_t *symbols_grow(symbols_t *symbols) {
+    size_t new_cap = symbols->cap ? symbols->cap * 2 : symbols_default_cap;
+    symbol_t *entries = calloc(new_cap, sizeof(symbol_t));
+    if (entries == nullptr)
+        return err_allocation_failed;
+
+    for (size_t i = 0; i < symbols->cap; ++i) {
+        symbol_t *entry = &symbols->entries[i];
+        if (entry->name == nullptr)
+            continue;
+        *symbols_probe(entries, new_cap, entry->hash, entry->name) = *entry;
+    }
+
+    free(symbols->entries);
+    symbols->entries = entries;
+    symbols->cap = new_cap;
+    return nullptr;
+}
+
+const symbol_t *symbols_find(const symbols_t *symbols, const char *name) {
+    if (symbols->cap == 0)
+        return nullptr;
+    symbol_t *symbol = symbols_probe(symbols->entries, symbols->cap,
+                                     symbols_hash(name), name);
+    return symbol->name ? symbol : nullptr;
+}
+
+error_t *symbols_get(symbols_t *symbols, tokenlist_entry_t *token,
+                     symbol_t **output) {
+    // Keep the load factor at or below one half
+    if ((symbols->len + 1) * 2 > symbols->cap) {
+        error_t *err = symbols_grow(symbols);
+        if (err)
+            return err;
+    }
+
+    const char *name = token->token.value;
+    uint64_t hash = symbols_hash(name);
+    symbol_t *symbol =
+        symbols_probe(symbols->entries, symbols->cap, hash, name);
+    if (symbol->name == nullptr) {
+        *symbol = (symbol_t){
+            .hash = hash,
+            .name = name,
+            .token = token,
+            .fixups = symbol_no_fixup,
+        };
+        symbols->len += 1;
+    }
+
+    *output = symbol;
+    return nullptr;
+}
@@ -0,0 +1,84 @@
+#ifndef INCLUDE_SRC_SYMBOLS_H_
+#define INCLUDE_SRC_SYMBOLS_H_
+
+#include "error.h"
+#include "tokenlist.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/* A symbol table maps label names to their offsets. It is an open addressing
+ * hash table keyed by the name, a symbol is added the first time a label is
+ * defined or referenced, whichever comes first. Names aren't copied, they
+ * point into the token list, which has to outlive the table. */
+
+constexpr size_t symbol_no_fixup = SIZE_MAX;
+
+typedef struct symbol {
+    uint64_t hash;
+    const char *name;
+    bool defined;
+    /* named by a .global directive, other objects can reference it */
+    bool global;
+    /* section and offset of the label, only valid once it is defined */
+    size_t section;
+    size_t offset;
+    /* the label's definition, or its first reference while undefined */
+    tokenlist_entry_t *token;
+    /* index of the first fixup waiting for the label to be defined, the
+     * fixups chain on from there. symbol_no_fixup if there are none. */
+    size_t fixups;
+} symbol_t;
+
+typedef struct symbols {
+    size_t len;
+    size_t cap;
+    symbol_t *entries;
+} symbols_t;
+
+/**
+ * @brief Allocate a new, empty symbol table
+ *
+ * @param[out] output Pointer to the allocated table
+ * @return error_t* nullptr on success, allocation error on failure
+ */
+error_t *symbols_alloc(symbols_t **output);
+
+/**
+ * @brief Free the symbol table
+ *
+ * If symbols is nullptr, the function returns without doing anything.
+ *
+ * @param symbols The table to free
+ */
+void symbols_free(symbols_t *symbols);
+
+/**
+ * @brief Remove every symbol, the table keeps its capacity
+ *
+ * @param symbols The table to clear
+ */
+void symbols_clear(symbols_t *symbols);
+
+/**
+ * @brief Find a symbol, adding it as undefined if it isn't in the table yet
+ *
+ * The returned pointer is only valid until the next symbol is added.
+ *
+ * @param symbols The table to search
+ * @param token The token naming the symbol
+ * @param[out] output The symbol
+ * @return error_t* nullptr on success, allocation error on failure
+ */
+error_t *symbols_get(symbols_t *symbols, tokenlist_entry_t *token,
+                     symbol_t **output);
+
+/**
+ * @brief Find a symbol by name
+ *
+ * @param symbols The table to search
+ * @param name The name of the symbol
+ * @return const symbol_t* The symbol, nullptr if it isn't in the table
+ */
+const symbol_t *symbols_find(const symbols_t *symbols, const char *name);
+
+#endif // INCLUDE_SRC_SYMBOLS_H_
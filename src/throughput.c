@@ -0,0 +1,520 @@
+#include "throughput.h"
+#include "ast.h"
+#include "encoder/table.h"
+#include "tokenlist.h"
+#include <stdint.h>
+#include <string.h>
+
+/* What the execution of an instruction costs, by the kind of work it does */
+typedef enum throughput_class {
+    THROUGHPUT_ALU,
+    THROUGHPUT_SHIFT,
+    /* conditional moves and sets */
+    THROUGHPUT_CONDITIONAL,
+    THROUGHPUT_LEA,
+    /* lea with a base, an index and a displacement */
+    THROUGHPUT_LEA_COMPLEX,
+    THROUGHPUT_MULTIPLY,
+    /* multiplies into rdx:rax */
+    THROUGHPUT_MULTIPLY_WIDE,
+    THROUGHPUT_DIVIDE,
+    THROUGHPUT_DIVIDE_64,
+    THROUGHPUT_BRANCH,
+    THROUGHPUT_JUMP,
+    THROUGHPUT_EXCHANGE,
+    /* handled when registers are renamed: nops, zero idioms and moves
+     * between registers */
+    THROUGHPUT_ELIMINATED,
+    /* nothing but its loads and stores */
+    THROUGHPUT_MEMORY,
+    THROUGHPUT_FENCE,
+    /* microcoded, a rough stand-in */
+    THROUGHPUT_SYSTEM,
+    THROUGHPUT_CLASSES,
+} throughput_class_t;
+
+/* Cycles of work, each on the least busy port of the mask */
+typedef struct throughput_uop {
+    uint16_t ports;
+    uint8_t cycles;
+} throughput_uop_t;
+
+typedef struct throughput_cost {
+    /* cycles from the sources to the result */
+    uint8_t latency;
+    /* micro-ops the front end issues */
+    uint8_t uops;
+    throughput_uop_t work[2];
+} throughput_cost_t;
+
+struct throughput_model {
+    const char *name;
+    /* micro-ops issued per cycle */
+    size_t width;
+    size_t ports_len;
+    const char *ports[throughput_ports_cap];
+    size_t load_latency;
+    uint16_t load;
+    uint16_t store_address;
+    /* 0 if the model doesn't have ports of their own for the data */
+    uint16_t store_data;
+    throughput_cost_t costs[THROUGHPUT_CLASSES];
+};
+
+#define P(n) (1u << (n))
+
+static const throughput_model_t throughput_models[] = {
+    {
+        .name = "skylake",
+        .width = 4,
+        .ports_len = 8,
+        .ports = {"p0", "p1", "p2", "p3", "p4", "p5", "p6", "p7"},
+        .load_latency = 5,
+        .load = P(2) | P(3),
+        .store_address = P(2) | P(3) | P(7),
+        .store_data = P(4),
+        .costs =
+            {
+                [THROUGHPUT_ALU] = {1, 1, {{P(0) | P(1) | P(5) | P(6), 1}}},
+                [THROUGHPUT_SHIFT] = {1, 1, {{P(0) | P(6), 1}}},
+                [THROUGHPUT_CONDITIONAL] = {1, 1, {{P(0) | P(6), 1}}},
+                [THROUGHPUT_LEA] = {1, 1, {{P(1) | P(5), 1}}},
+                [THROUGHPUT_LEA_COMPLEX] = {3, 1, {{P(1), 1}}},
+                [THROUGHPUT_MULTIPLY] = {3, 1, {{P(1), 1}}},
+                [THROUGHPUT_MULTIPLY_WIDE] = {4, 2, {{P(1), 1}, {P(5), 1}}},
+                [THROUGHPUT_DIVIDE] = {26, 10, {{P(0), 6}, {P(1) | P(5), 4}}},
+                [THROUGHPUT_DIVIDE_64] = {42,
+                                          36,
+                                          {{P(0), 24}, {P(1) | P(5), 12}}},
+                [THROUGHPUT_BRANCH] = {1, 1, {{P(0) | P(6), 1}}},
+                [THROUGHPUT_JUMP] = {1, 1, {{P(6), 1}}},
+                [THROUGHPUT_EXCHANGE] = {2,
+                                         3,
+                                         {{P(0) | P(1) | P(5) | P(6), 3}}},
+                [THROUGHPUT_ELIMINATED] = {0, 1, {}},
+                [THROUGHPUT_MEMORY] = {0, 0, {}},
+                [THROUGHPUT_FENCE] = {33,
+                                      3,
+                                      {{P(0) | P(1) | P(5) | P(6), 3}}},
+                [THROUGHPUT_SYSTEM] = {100,
+                                       100,
+                                       {{P(0) | P(1) | P(5) | P(6), 100}}},
+            },
+    },
+    {
+        .name = "zen3",
+        .width = 6,
+        .ports_len = 7,
+        .ports = {"alu0", "alu1", "alu2", "alu3", "agu0", "agu1", "agu2"},
+        .load_latency = 4,
+        .load = P(4) | P(5) | P(6),
+        .store_address = P(4) | P(5),
+        .costs =
+            {
+                [THROUGHPUT_ALU] = {1, 1, {{P(0) | P(1) | P(2) | P(3), 1}}},
+                [THROUGHPUT_SHIFT] = {1, 1, {{P(1) | P(2), 1}}},
+                [THROUGHPUT_CONDITIONAL] = {1, 1, {{P(0) | P(3), 1}}},
+                [THROUGHPUT_LEA] = {1, 1, {{P(0) | P(1) | P(2) | P(3), 1}}},
+                [THROUGHPUT_LEA_COMPLEX] = {2,
+                                            1,
+                                            {{P(0) | P(1) | P(2) | P(3), 1}}},
+                [THROUGHPUT_MULTIPLY] = {3, 1, {{P(1), 1}}},
+                [THROUGHPUT_MULTIPLY_WIDE] = {3, 2, {{P(1), 2}}},
+                [THROUGHPUT_DIVIDE] = {12, 2, {{P(2), 6}}},
+                [THROUGHPUT_DIVIDE_64] = {18, 2, {{P(2), 12}}},
+                [THROUGHPUT_BRANCH] = {1, 1, {{P(0) | P(3), 1}}},
+                [THROUGHPUT_JUMP] = {1, 1, {{P(0) | P(3), 1}}},
+                [THROUGHPUT_EXCHANGE] = {1,
+                                         2,
+                                         {{P(0) | P(1) | P(2) | P(3), 2}}},
+                [THROUGHPUT_ELIMINATED] = {0, 1, {}},
+                [THROUGHPUT_MEMORY] = {0, 0, {}},
+                [THROUGHPUT_FENCE] = {20,
+                                      7,
+                                      {{P(0) | P(1) | P(2) | P(3), 7}}},
+                [THROUGHPUT_SYSTEM] = {100,
+                                       100,
+                                       {{P(0) | P(1) | P(2) | P(3), 100}}},
+            },
+    },
+};
+
+/* How an instruction uses its operands, beyond reading every operand after
+ * the first and the registers of every address */
+typedef enum throughput_access {
+    /* the first operand */
+    THROUGHPUT_READS = 1 << 0,
+    THROUGHPUT_WRITES = 1 << 1,
+    THROUGHPUT_READS_FLAGS = 1 << 2,
+    THROUGHPUT_WRITES_FLAGS = 1 << 3,
+    /* the second operand too */
+    THROUGHPUT_SWAPS = 1 << 4,
+    /* copies, a memory operand makes it a plain load or store */
+    THROUGHPUT_MOVES = 1 << 5,
+    /* the stack, whose pointer the stack engine keeps track of, so it doesn't
+     * wait for anything */
+    THROUGHPUT_LOADS = 1 << 6,
+    THROUGHPUT_STORES = 1 << 7,
+} throughput_access_t;
+
+typedef struct throughput_form {
+    const char *mnemonic;
+    /* matches every mnemonic starting with it */
+    bool prefix;
+    throughput_class_t class;
+    uint8_t access;
+    /* registers read and written without being operands */
+    uint32_t reads;
+    uint32_t writes;
+} throughput_form_t;
+
+/* rax, rcx, rdx, rbx and rbp by their numbers, the flags after r15 */
+constexpr uint32_t throughput_rax = 1u << 0;
+constexpr uint32_t throughput_rcx = 1u << 1;
+constexpr uint32_t throughput_rdx = 1u << 2;
+constexpr uint32_t throughput_rbx = 1u << 3;
+constexpr uint32_t throughput_rbp = 1u << 5;
+constexpr size_t throughput_flags = 16;
+constexpr size_t throughput_dependencies = 17;
+
+#define R THROUGHPUT_READS
+#define W THROUGHPUT_WRITES
+#define RW (R | W)
+#define RF THROUGHPUT_READS_FLAGS
+#define WF THROUGHPUT_WRITES_FLAGS
+#define MV THROUGHPUT_MOVES
+#define LD THROUGHPUT_LOADS
+#define ST THROUGHPUT_STORES
+
+/* Searched in order, so exact mnemonics come before prefixes of them */
+static const throughput_form_t throughput_forms[] = {
+    {"add", false, THROUGHPUT_ALU, RW | WF, 0, 0},
+    {"sub", false, THROUGHPUT_ALU, RW | WF, 0, 0},
+    {"and", false, THROUGHPUT_ALU, RW | WF, 0, 0},
+    {"or", false, THROUGHPUT_ALU, RW | WF, 0, 0},
+    {"xor", false, THROUGHPUT_ALU, RW | WF, 0, 0},
+    {"adc", false, THROUGHPUT_ALU, RW | RF | WF, 0, 0},
+    {"sbb", false, THROUGHPUT_ALU, RW | RF | WF, 0, 0},
+    {"cmp", false, THROUGHPUT_ALU, R | WF, 0, 0},
+    {"test", false, THROUGHPUT_ALU, R | WF, 0, 0},
+    {"inc", false, THROUGHPUT_ALU, RW | WF, 0, 0},
+    {"dec", false, THROUGHPUT_ALU, RW | WF, 0, 0},
+    {"neg", false, THROUGHPUT_ALU, RW | WF, 0, 0},
+    {"not", false, THROUGHPUT_ALU, RW, 0, 0},
+    {"bswap", false, THROUGHPUT_ALU, RW, 0, 0},
+    {"shl", false, THROUGHPUT_SHIFT, RW | WF, 0, 0},
+    {"sal", false, THROUGHPUT_SHIFT, RW | WF, 0, 0},
+    {"shr", false, THROUGHPUT_SHIFT, RW | WF, 0, 0},
+    {"sar", false, THROUGHPUT_SHIFT, RW | WF, 0, 0},
+    {"rol", false, THROUGHPUT_SHIFT, RW | WF, 0, 0},
+    {"ror", false, THROUGHPUT_SHIFT, RW | WF, 0, 0},
+    {"rcl", false, THROUGHPUT_SHIFT, RW | RF | WF, 0, 0},
+    {"rcr", false, THROUGHPUT_SHIFT, RW | RF | WF, 0, 0},
+    {"mov", false, THROUGHPUT_ALU, W | MV, 0, 0},
+    {"movzx", false, THROUGHPUT_ALU, W | MV, 0, 0},
+    {"movsx", false, THROUGHPUT_ALU, W | MV, 0, 0},
+    {"movsxd", false, THROUGHPUT_ALU, W | MV, 0, 0},
+    {"lea", false, THROUGHPUT_LEA, W, 0, 0},
+    {"imul", false, THROUGHPUT_MULTIPLY, RW | WF, 0, 0},
+    {"mul", false, THROUGHPUT_MULTIPLY_WIDE, R | WF,
+     throughput_rax, throughput_rax | throughput_rdx},
+    {"div", false, THROUGHPUT_DIVIDE, R | WF,
+     throughput_rax | throughput_rdx, throughput_rax | throughput_rdx},
+    {"idiv", false, THROUGHPUT_DIVIDE, R | WF,
+     throughput_rax | throughput_rdx, throughput_rax | throughput_rdx},
+    {"cmov", true, THROUGHPUT_CONDITIONAL, RW | RF, 0, 0},
+    {"set", true, THROUGHPUT_CONDITIONAL, W | RF, 0, 0},
+    {"jmp", false, THROUGHPUT_JUMP, R, 0, 0},
+    {"j", true, THROUGHPUT_BRANCH, R | RF, 0, 0},
+    {"call", false, THROUGHPUT_JUMP, R | ST, 0, 0},
+    {"ret", false, THROUGHPUT_JUMP, LD, 0, 0},
+    {"push", false, THROUGHPUT_MEMORY, R | ST, 0, 0},
+    {"pop", false, THROUGHPUT_MEMORY, W | LD, 0, 0},
+    {"leave", false, THROUGHPUT_ALU, LD, throughput_rbp, throughput_rbp},
+    {"xchg", false, THROUGHPUT_EXCHANGE, RW | THROUGHPUT_SWAPS, 0, 0},
+    {"cbw", false, THROUGHPUT_ALU, 0, throughput_rax, throughput_rax},
+    {"cwde", false, THROUGHPUT_ALU, 0, throughput_rax, throughput_rax},
+    {"cdqe", false, THROUGHPUT_ALU, 0, throughput_rax, throughput_rax},
+    {"cwd", false, THROUGHPUT_ALU, 0, throughput_rax, throughput_rdx},
+    {"cdq", false, THROUGHPUT_ALU, 0, throughput_rax, throughput_rdx},
+    {"cqo", false, THROUGHPUT_ALU, 0, throughput_rax, throughput_rdx},
+    {"clc", false, THROUGHPUT_ALU, WF, 0, 0},
+    {"stc", false, THROUGHPUT_ALU, WF, 0, 0},
+    {"cmc", false, THROUGHPUT_ALU, RF | WF, 0, 0},
+    {"cld", false, THROUGHPUT_ALU, 0, 0, 0},
+    {"std", false, THROUGHPUT_ALU, 0, 0, 0},
+    {"nop", false, THROUGHPUT_ELIMINATED, 0, 0, 0},
+    {"lfence", false, THROUGHPUT_FENCE, 0, 0, 0},
+    {"mfence", false, THROUGHPUT_FENCE, 0, 0, 0},
+    {"sfence", false, THROUGHPUT_FENCE, 0, 0, 0},
+    {"pause", false, THROUGHPUT_SYSTEM, 0, 0, 0},
+    {"cpuid", false, THROUGHPUT_SYSTEM, 0, throughput_rax | throughput_rcx,
+     throughput_rax | throughput_rbx | throughput_rcx | throughput_rdx},
+    {"rdtsc", false, THROUGHPUT_SYSTEM, 0, 0, throughput_rax | throughput_rdx},
+};
+
+/* The instructions the encoder knows but the table doesn't are system
+ * instructions like syscall and hlt, mnemonics neither knows cost what a
+ * simple instruction costs */
+static const throughput_form_t throughput_system_form = {
+    nullptr, false, THROUGHPUT_SYSTEM, 0, 0, 0};
+static const throughput_form_t throughput_unknown_form = {
+    nullptr, false, THROUGHPUT_ALU, RW, 0, 0};
+
+#undef R
+#undef W
+#undef RW
+#undef RF
+#undef WF
+#undef MV
+#undef LD
+#undef ST
+#undef P
+
+const throughput_model_t *throughput_model_lookup(const char *name) {
+    for (size_t i = 0;
+         i < sizeof(throughput_models) / sizeof(throughput_models[0]); ++i)
+        if (strcmp(throughput_models[i].name, name) == 0)
+            return &throughput_models[i];
+    return nullptr;
+}
+
+static const throughput_form_t *throughput_form(const char *mnemonic) {
+    for (size_t i = 0;
+         i < sizeof(throughput_forms) / sizeof(throughput_forms[0]); ++i) {
+        const throughput_form_t *form = &throughput_forms[i];
+        if (form->prefix ? strncmp(form->mnemonic, mnemonic,
+                                   strlen(form->mnemonic)) == 0
+                         : strcmp(form->mnemonic, mnemonic) == 0)
+            return form;
+    }
+    return instruction_lookup(mnemonic) ? &throughput_system_form
+                                        : &throughput_unknown_form;
+}
+
+static const register_info_t *throughput_register(ast_node_t *operand) {
+    return operand->id == NODE_REGISTER
+               ? register_lookup(operand->token_entry->token.value)
+               : nullptr;
+}
+
+static uint32_t throughput_mask(ast_node_t *operand) {
+    const register_info_t *reg = throughput_register(operand);
+    return reg ? 1u << reg->number : 0;
+}
+
+// The registers of an address and whether it has a base, an index and a
+// displacement
+static uint32_t throughput_address(ast_node_t *memory, bool *complex) {
+    *complex = false;
+    ast_node_t *expression = ast_node_child(memory, 1);
+    if (expression->id != NODE_REGISTER_EXPRESSION)
+        return 0;
+    uint32_t registers = throughput_mask(ast_node_child(expression, 0));
+    bool index = false, displacement = false;
+    for (size_t i = 1; i < expression->len; ++i) {
+        ast_node_t *part = ast_node_child(expression, i);
+        if (part->id == NODE_REGISTER_INDEX) {
+            index = true;
+            registers |= throughput_mask(ast_node_child(part, 1));
+        } else {
+            displacement = true;
+        }
+    }
+    *complex = index && displacement;
+    return registers;
+}
+
+typedef struct throughput_state {
+    const throughput_model_t *model;
+    /* when each register and the flags are written, in cycles from the start
+     * of the block */
+    size_t ready[throughput_dependencies];
+    throughput_block_t *block;
+} throughput_state_t;
+
+static size_t throughput_ready(const throughput_state_t *state,
+                               uint32_t registers) {
+    size_t ready = 0;
+    for (size_t i = 0; i < throughput_dependencies; ++i)
+        if (registers & (1u << i) && state->ready[i] > ready)
+            ready = state->ready[i];
+    return ready;
+}
+
+static void throughput_work(throughput_state_t *state, uint16_t ports,
+                            size_t cycles) {
+    const throughput_model_t *model = state->model;
+    for (size_t cycle = 0; cycle < cycles; ++cycle) {
+        size_t least = SIZE_MAX;
+        for (size_t i = 0; i < model->ports_len; ++i)
+            if (ports & (1u << i) &&
+                (least == SIZE_MAX ||
+                 state->block->ports[i] < state->block->ports[least]))
+                least = i;
+        if (least != SIZE_MAX)
+            state->block->ports[least] += 1;
+    }
+}
+
+// Adds the micro-ops of the instruction to the ports and the front end and
+// moves the registers it writes forward in time
+static void throughput_instruction(throughput_state_t *state,
+                                   ast_node_t *instruction) {
+    const char *mnemonic =
+        ast_node_child(instruction, 0)->token_entry->token.value;
+    ast_node_t *operands = ast_node_child(instruction, 1);
+    // imul with one operand multiplies into rdx:rax, with three it doesn't
+    // read the first
+    bool imul = strcmp(mnemonic, "imul") == 0;
+    const throughput_form_t *form =
+        throughput_form(imul && operands->len == 1 ? "mul" : mnemonic);
+    throughput_class_t class = form->class;
+    uint8_t access = form->access;
+    if (imul && operands->len == 3)
+        access &= ~THROUGHPUT_READS;
+    uint32_t reads = form->reads, writes = form->writes, address = 0;
+    bool loads = access & THROUGHPUT_LOADS, stores = access & THROUGHPUT_STORES;
+
+    for (size_t i = 0; i < operands->len; ++i) {
+        ast_node_t *operand = ast_node_child(operands, i);
+        const register_info_t *reg = throughput_register(operand);
+        bool first = i == 0;
+        if (reg) {
+            uint32_t mask = 1u << reg->number;
+            // Writes of 8 and 16 bits merge into what the register holds
+            if (first && access & THROUGHPUT_WRITES && reg->size < 32)
+                reads |= mask;
+            if (!first || access & THROUGHPUT_READS)
+                reads |= mask;
+            if ((first && access & THROUGHPUT_WRITES) ||
+                access & THROUGHPUT_SWAPS)
+                writes |= mask;
+            if (first && (class == THROUGHPUT_DIVIDE ||
+                          class == THROUGHPUT_MULTIPLY_WIDE) &&
+                reg->size == 8)
+                writes &= ~throughput_rdx;
+            if (first && class == THROUGHPUT_DIVIDE && reg->size == 64)
+                class = THROUGHPUT_DIVIDE_64;
+            continue;
+        }
+        if (operand->id != NODE_MEMORY)
+            continue;
+
+        bool complex;
+        uint32_t registers = throughput_address(operand, &complex);
+        if (class == THROUGHPUT_LEA) {
+            reads |= registers;
+            if (complex)
+                class = THROUGHPUT_LEA_COMPLEX;
+            continue;
+        }
+        address |= registers;
+        if (!first || access & THROUGHPUT_READS)
+            loads = true;
+        if (first && access & THROUGHPUT_WRITES)
+            stores = true;
+        if (access & THROUGHPUT_MOVES)
+            class = THROUGHPUT_MEMORY;
+    }
+
+    if (operands->len == 2) {
+        const register_info_t *first =
+            throughput_register(ast_node_child(operands, 0));
+        const register_info_t *second =
+            throughput_register(ast_node_child(operands, 1));
+        bool wide = first && second && first->size >= 32 &&
+                    first->size == second->size;
+        // Zero idioms don't wait for the register they clear
+        if (wide && first->number == second->number &&
+            (strcmp(mnemonic, "xor") == 0 || strcmp(mnemonic, "sub") == 0)) {
+            class = THROUGHPUT_ELIMINATED;
+            reads = 0;
+        } else if (wide && first->number != second->number &&
+                   strcmp(mnemonic, "mov") == 0) {
+            class = THROUGHPUT_ELIMINATED;
+        }
+    }
+    if (access & THROUGHPUT_READS_FLAGS)
+        reads |= 1u << throughput_flags;
+    if (access & THROUGHPUT_WRITES_FLAGS)
+        writes |= 1u << throughput_flags;
+
+    const throughput_model_t *model = state->model;
+    const throughput_cost_t *cost = &model->costs[class];
+    size_t start = throughput_ready(state, reads);
+    if (loads) {
+        size_t loaded = throughput_ready(state, address) + model->load_latency;
+        start = loaded > start ? loaded : start;
+    }
+    size_t end = start + cost->latency;
+    for (size_t i = 0; i < throughput_dependencies; ++i)
+        if (writes & (1u << i))
+            state->ready[i] = end;
+    if (end > state->block->latency)
+        state->block->latency = end;
+
+    // Loads ride along with the micro-op they feed, if there is one
+    state->block->uops += cost->uops + stores + (loads && cost->uops == 0);
+    for (size_t i = 0; i < sizeof(cost->work) / sizeof(cost->work[0]); ++i)
+        throughput_work(state, cost->work[i].ports, cost->work[i].cycles);
+    if (loads)
+        throughput_work(state, model->load, 1);
+    if (stores) {
+        throughput_work(state, model->store_address, 1);
+        throughput_work(state, model->store_data, 1);
+    }
+}
+
+void throughput_block(const throughput_model_t *model, ast_node_t *program,
+                      const cfg_block_t *block, throughput_block_t *output) {
+    *output = (throughput_block_t){.bottleneck = SIZE_MAX};
+    throughput_state_t state = {.model = model, .block = output};
+    for (size_t i = block->first; i < block->end; ++i) {
+        ast_node_t *statement = ast_node_child(program, i);
+        if (statement->id != NODE_INSTRUCTION)
+            continue;
+        output->instructions += 1;
+        throughput_instruction(&state, statement);
+    }
+
+    output->throughput = (double)output->uops / (double)model->width;
+    for (size_t i = 0; i < model->ports_len; ++i) {
+        if (output->ports[i] <= output->throughput)
+            continue;
+        output->throughput = output->ports[i];
+        output->bottleneck = i;
+    }
+}
+
+void throughput_print(const throughput_model_t *model, const cfg_t *cfg,
+                      ast_node_t *program, FILE *file) {
+    for (size_t i = 0; i < cfg->blocks_len; ++i) {
+        const cfg_block_t *block = &cfg->blocks[i];
+        throughput_block_t estimate;
+        throughput_block(model, program, block, &estimate);
+        if (estimate.instructions == 0)
+            continue;
+
+        ast_node_t *first = ast_node_child(program, block->first);
+        fprintf(file, "{\"block\":%zu,\"line\":%zu,\"label\":", i,
+                ast_node_child(first, 0)->token_entry->token.line_number + 1);
+        if (first->id == NODE_LABEL)
+            fprintf(file, "\"%s\"",
+                    ast_node_child(first, 0)->token_entry->token.value);
+        else
+            fprintf(file, "null");
+        fprintf(file,
+                ",\"instructions\":%zu,\"uops\":%zu,\"throughput\":%.2f,"
+                "\"latency\":%zu,\"bottleneck\":\"%s\",\"ports\":{",
+                estimate.instructions, estimate.uops, estimate.throughput,
+                estimate.latency,
+                estimate.bottleneck == SIZE_MAX
+                    ? "issue"
+                    : model->ports[estimate.bottleneck]);
+        for (size_t j = 0; j < model->ports_len; ++j)
+            fprintf(file, "%s\"%s\":%.2f", j ? "," : "", model->ports[j],
+                    estimate.ports[j]);
+        fprintf(file, "}}\n");
+    }
+}
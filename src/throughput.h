@@ -0,0 +1,75 @@
+#ifndef INCLUDE_SRC_THROUGHPUT_H_
+#define INCLUDE_SRC_THROUGHPUT_H_
+
+#include "ast.h"
+#include "cfg.h"
+#include "error.h"
+#include <stddef.h>
+#include <stdio.h>
+
+/* Estimates how fast the basic blocks of a program run on a model of a
+ * microarchitecture, without running them. Every instruction falls into a
+ * class of the model, which has its latency, how many micro-ops it issues and
+ * the execution ports they can go to. Memory operands add loads and stores.
+ *
+ * The reciprocal throughput of a block is the number of cycles one run of it
+ * takes when runs follow each other without waiting for one another: either
+ * the front end issuing its micro-ops or the busiest port, with every micro-op
+ * on the least busy port it can go to. The latency is the longest chain of
+ * instructions in the block where each needs a register or the flags the one
+ * before writes. Dependencies through memory aren't followed, and neither are
+ * the ones from one run of a block to the next. */
+
+/* More than either model has */
+constexpr size_t throughput_ports_cap = 10;
+
+typedef struct throughput_model throughput_model_t;
+
+typedef struct throughput_block {
+    size_t instructions;
+    /* micro-ops the front end issues */
+    size_t uops;
+    /* cycles the micro-ops keep each port of the model busy */
+    double ports[throughput_ports_cap];
+    /* cycles per run of the block */
+    double throughput;
+    size_t latency;
+    /* the port that limits the throughput, SIZE_MAX for the front end */
+    size_t bottleneck;
+} throughput_block_t;
+
+/**
+ * @brief Find a model by name
+ *
+ * @param name skylake or zen3
+ * @return const throughput_model_t* The model, nullptr if it is unknown
+ */
+const throughput_model_t *throughput_model_lookup(const char *name);
+
+/**
+ * @brief Estimate the throughput and latency of a block
+ *
+ * @param model The model
+ * @param program The program the graph was built from
+ * @param block The block
+ * @param[out] output The estimate
+ */
+void throughput_block(const throughput_model_t *model, ast_node_t *program,
+                      const cfg_block_t *block, throughput_block_t *output);
+
+/**
+ * @brief Print the estimate of every block with instructions
+ *
+ * One JSON object per line and block: its index, first line, the label it
+ * starts with or null, the instructions and micro-ops it has, the reciprocal
+ * throughput, the latency, the bottleneck and the busy cycles of every port.
+ *
+ * @param model The model
+ * @param cfg The graph of the program
+ * @param program The program, which must have parsed without diagnostics
+ * @param file The file to print to
+ */
+void throughput_print(const throughput_model_t *model, const cfg_t *cfg,
+                      ast_node_t *program, FILE *file);
+
+#endif // INCLUDE_SRC_THROUGHPUT_H_
@@ -60,22 +60,59 @@ void tokenlist_free(tokenlist_t *list) {
         tokenlist_entry_free(current);
         current = next;
     }
+    // Spare entries have no token left
+    while (list->spare) {
+        tokenlist_entry_t *next = list->spare->next;
+        free(list->spare);
+        list->spare = next;
+    }
 
     free(list);
 }
 
+void tokenlist_truncate(tokenlist_t *list, tokenlist_entry_t *entry) {
+    list->tail = entry->prev;
+    if (list->tail)
+        list->tail->next = nullptr;
+    else
+        list->head = nullptr;
+    while (entry) {
+        tokenlist_entry_t *next = entry->next;
+        lexer_token_cleanup(&entry->token);
+        entry->next = list->spare;
+        list->spare = entry;
+        entry = next;
+    }
+}
+
+void tokenlist_clear(tokenlist_t *list) {
+    if (list->head)
+        tokenlist_truncate(list, list->head);
+}
+
+error_t *tokenlist_add(tokenlist_t *list, lexer_token_t *token) {
+    tokenlist_entry_t *entry = list->spare;
+    error_t *err = nullptr;
+    if (entry)
+        list->spare = entry->next;
+    else
+        err = tokenlist_entry_alloc(&entry);
+    if (err) {
+        lexer_token_cleanup(token);
+        return err;
+    }
+    entry->token = *token;
+    tokenlist_append(list, entry);
+    return nullptr;
+}
+
 error_t *tokenlist_fill(tokenlist_t *list, lexer_t *lex) {
     error_t *err = nullptr;
     lexer_token_t token = {};
     while ((err = lexer_next(lex, &token)) == nullptr) {
-        tokenlist_entry_t *entry;
-        err = tokenlist_entry_alloc(&entry);
-        if (err) {
-            lexer_token_cleanup(&token);
+        err = tokenlist_add(list, &token);
+        if (err)
             return err;
-        }
-        entry->token = token;
-        tokenlist_append(list, entry);
     }
     if (err != err_eof)
         return err;
@@ -13,6 +13,9 @@ struct tokenlist_entry {
 typedef struct tokenlist {
     tokenlist_entry_t *head;
     tokenlist_entry_t *tail;
+    /* entries of cleared tokens, which tokenlist_fill takes before it
+     * allocates new ones */
+    tokenlist_entry_t *spare;
 } tokenlist_t;
 
 /**
@@ -27,6 +30,33 @@ error_t *tokenlist_fill(tokenlist_t *list, lexer_t *lex);
 
 void tokenlist_free(tokenlist_t *list);
 
+/**
+ * Empty the list, its entries are kept to be filled again
+ */
+void tokenlist_clear(tokenlist_t *list);
+
+/**
+ * Remove entry and every entry after it from the list, the entries are kept
+ * to be filled again
+ */
+void tokenlist_truncate(tokenlist_t *list, tokenlist_entry_t *entry);
+
+/**
+ * Add a token to the end of the list, in a spare entry if there is one. The
+ * list owns the token from then on, on failure the token is cleaned up.
+ */
+error_t *tokenlist_add(tokenlist_t *list, lexer_token_t *token);
+
+/**
+ * Allocate an entry that isn't part of any list yet
+ */
+error_t *tokenlist_entry_alloc(tokenlist_entry_t **output);
+
+/**
+ * Add an entry to the end of the list, which frees it along with the others
+ */
+void tokenlist_append(tokenlist_t *list, tokenlist_entry_t *entry);
+
 /**
  * Return the first token entry that isn't whitespace, newline or comment
  */
@@ -0,0 +1,24 @@
+; Blocks whose throughput and latency are known for the models: a loop bound
+; by the load of its memory operand, a chain through a divide and code that
+; renames away its zero idioms and moves between registers.
+
+sum:
+    xor eax, eax
+    xor ecx, ecx
+    mov rdx, rdi
+again:
+    add rax, [rdx + rcx * 8]
+    add rcx, 1
+    cmp rcx, rsi
+    jne again
+    ret
+divide:
+    mov rax, rdi
+    cqo
+    idiv rsi
+    imul rax, rax, 3
+    lea rdx, [rax + rax * 2 + 8]
+    mov [rdi], rdx
+    push rbx
+    pop rbx
+    ret
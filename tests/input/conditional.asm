@@ -0,0 +1,31 @@
+.section text
+
+; Blocks are kept or dropped depending on the names defined with -D, the
+; lines of dropped blocks are skipped without being lexed.
+
+start:
+.ifdef LARGE
+    mov rax, 0x123456789
+.else
+    mov eax, 1
+.endif
+.if 0
+    this line isn't lexed, so ' " < and > are fine
+    .if 1
+        nor are the lines of blocks in a dropped one
+    .else
+        no matter which
+    .endif
+.endif
+.ifdef VERSION
+    .if VERSION >> 1
+        add eax, 2 * 3
+    .else
+        .ifndef LARGE
+            sub eax, 1
+        .endif
+    .endif
+.else
+    xor eax, eax
+.endif
+    ret
@@ -0,0 +1,17 @@
+.section text
+
+; Data directives, tables of labels and an included file. The included file
+; starts 16 bytes into the section.
+
+.global _start
+_start:
+    .db 0x01, 0x02, 0x03, 0xff
+    .dw 0x1234, 0xffff
+    .dd 0xdeadbeef, _start
+    .incbin "tests/input/encode.asm"
+    jmp _start
+table:
+    .dq _start, table, done, 0x1122334455667788
+    .dd done
+done:
+    ret
@@ -0,0 +1,37 @@
+; Code that can't be reached: behind jumps and returns, and labels only dead
+; code or nothing names. The labels .global names are symbols other objects
+; can call, so only flat binaries lose them and what only they lead to.
+
+.global _start, helper
+_start:
+    mov eax, 1
+    jmp done
+    mov eax, 2
+    add eax, 3
+skipped:
+    mov eax, 4
+done:
+    call helper
+    ret
+    nop
+    nop
+helper:
+    lea rax, [table]
+    ret
+unused:
+    ret
+table:
+    jmp [rax]
+tail:
+    .dq target, skip
+    int3
+target:
+    ret
+    jne _start
+; The graph can't tell which statement a jump to $ or a label plus a number
+; lands on, everything behind the jump is kept
+skip:
+    jmp $ + 7
+    mov eax, 1
+    mov ebx, 2
+    ret
@@ -0,0 +1,127 @@
+.section text
+
+; Instructions the encoder supports, one of every kind of form. Instructions
+; without operands are followed by more instructions on purpose, statements
+; must not continue on the next line.
+
+.global _start
+_start:
+    ret
+    nop
+    mov eax, ebx
+    mov r12, [rsp + 8]
+    mov [rbp - 16], r8b
+    mov rax, 0x123456789
+    mov cx, 7
+    movzx eax, cl
+    movsx rdx, cx
+    movsxd rax, r9d
+    lea rsi, [rax + rbx * 2 + 1000]
+    lea eax, [r10d + ebx * 4]
+    xchg rcx, r12
+    xchg eax, ecx
+    push r15
+    pop rbp
+    add r10, 1000
+    sub [r8], edx
+    cmp spl, dil
+    test al, al
+    imul rdx, rsi, 12
+    neg r8
+    idiv r11
+    inc ebx
+    shl r9d, 3
+    sar rdx, cl
+    bswap r13
+    cmovne rax, rdx
+    sete al
+    jmp rax
+    call [rbx + 8]
+    leave
+    cqo
+    syscall
+    int3
+    int 0x80
+    ret 16
+
+; Numbers and displacements take the shortest encoding unless a size suffix
+; picks one
+    add ecx, 1
+    add ecx, 1:32
+    xor eax, 0xDEADBEEF
+    and rdx, 0xfffffffffffffff0
+    test al, 0x80
+    imul rdx, rsi, 12
+    push 0o777:16
+    push 5
+    push 0x80
+    shl r9, 1
+    shl r9, 1:8
+    lea eax, [esp - 24]
+    lea eax, [esp - 24:32]
+    mov [rbp], eax
+    mov [rbx + 0:8], eax
+    mov [rbx + 200], eax
+
+; Labels referenced before and after their definition
+    jmp forward
+    lea rax, [data]
+    call _start
+backward:
+    jne backward
+forward:
+    mov eax, forward
+    push backward
+data:
+    jz data
+
+; Growing the second branch pushes the first one out of reach
+    jmp reach
+    je beyond
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    cqo
+    leave
+reach:
+    jne reach
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+beyond:
+    jmp reach
+
+; Alignments pad code with NOPs unless they have a fill byte
+    nop
+.align 16
+aligned:
+    ret
+.align 8, 0xcc
+    jmp aligned
+
+; A compare fuses with the branch after it, -b pads them and the loop away
+; from the boundaries together
+spin:
+    mov rax, 0x1122334455667788
+    mov rax, 0x1122334455667788
+    cmp rcx, 0x1000
+    jne spin
@@ -0,0 +1,30 @@
+.section text
+
+; Expressions fold into numbers, labels plus numbers and differences of
+; labels. $ is where the statement starts.
+
+start:
+    mov eax, (1 << 4) | 3 * 2 - 1
+    mov ecx, -1
+    add eax, ~0xf & 0xff
+    mov rdx, 100 / 7 >> 1
+    ; numbers are signed, division truncates toward zero and shifting right
+    ; keeps the sign
+    mov eax, -8 / 2
+    add rax, -12 / 4
+    mov ecx, (0 - 16) >> 2
+    mov esi, -7 / 2
+    mov edx, 1 + 2 << 3 - 1 | 1
+    lea rax, [rbx + 4 * 2 - 1]
+    mov rax, [rbp - 2 * 8]
+    lea rsi, [table + 8]
+    mov eax, table_end - table
+    jmp $ + 2
+    nop
+    jmp start
+table:
+    .dq table_end - table, $, table + 8, start - $ + 16
+    .dd 4 * 1024 - 1, table_end - start
+    .db -1, 1 << 7
+table_end:
+    ret
@@ -0,0 +1,15 @@
+.section text
+
+; Included files expand to their lines wherever they are included and are
+; lexed once, however often that is. Paths are relative to the working
+; directory.
+
+.macro twice path
+    .include \path
+    .include \path
+.endm
+
+start:
+    .include "tests/input/include.inc"
+    twice "tests/input/include.inc"
+    ret
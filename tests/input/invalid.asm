@@ -0,0 +1,26 @@
+; Every statement that can't be parsed is reported, parsing resumes at the
+; next line after each of them. With DATA defined the program parses and the
+; data that doesn't fit its size is reported when it is assembled.
+
+_start:
+.ifndef DATA
+    mov eax, 1 / (2 - 2)
+    mov 0xZZ, eax
+    lea eax, [eax +
+    mov eax, ebx
+    ] ebx
+    push 0b2
+    ; a trailing comma is left over after the list
+    push rax,
+    .db 1,
+.else
+    .db 256
+    .db 0x1ff
+    .dw 70000
+    .dd 0x100000000
+    ; negative values down to the lowest signed one fit
+    .db -128, 255
+    .dw -32768
+    .dd -1
+.endif
+    ret
@@ -0,0 +1,51 @@
+.section text
+
+; Macros expand where their name starts a line, \name stands for the tokens
+; of an argument. Repetitions expand their body count times.
+
+.macro save first, second
+    push \first
+    push \second
+.endm
+
+.macro restore first, second
+    pop \second
+    pop \first
+.endm
+
+.macro clear register
+    xor \register, \register
+cleared:
+.endm
+
+; Labels of bodies are defined where the body expands, never where it is
+.macro unused
+never:
+    ud2
+.endm
+
+.macro zero_table count, value
+    .rept \count
+        .dq \value
+    .endr
+.endm
+
+start:
+    save rbx, rbp
+    clear eax
+    .rept 3
+        add eax, 2 * 4
+        .rept 2
+            nop
+        .endr
+    .endr
+    restore rbx, rbp
+    mov rax, [rbx + 8]
+    .rept 0
+skipped:
+        ud2
+    .endr
+    ret
+table:
+    zero_table 4, table_end - table
+table_end:
@@ -0,0 +1,31 @@
+.section text
+
+; Instructions the peephole pass rewrites, and ones it has to leave alone
+; because a later instruction reads the flags or the rewrite would change
+; what they do.
+
+_start:
+    mov eax, 0
+    mov rbx, 0
+    mov r9, 0
+    add eax, ebx
+    lea eax, [eax + 8]
+    lea rcx, [rcx - 16]
+    test rcx, rcx
+    mov rax, rax
+    mov ax, ax
+    mov eax, eax
+    mov dl, 0:8
+    lea rdx, [rdx + 8]
+    lea rsi, [rdi + 8]
+    lea r8, [r8 + rax * 2 + 8]
+    jne _start
+    mov ecx, 0
+    cmp ecx, edx
+    mov edx, 0
+    sbb eax, eax
+    lea eax, [eax - 128:8]
+    add eax, 1
+    mov r10, 0
+_end:
+    ret
@@ -2,6 +2,7 @@
 
 ; Small valid code snippet that should contain all different AST nodes
 
+.global _start
 _start:
     mov eax, ebx
     lea eax, [eax + ebx * 4 + 8]
@@ -13,6 +14,8 @@ _start:
     mov eax, _start
     mov eax, 555
     push 0o777
+.align 16
+.align 8, 0xcc
     xor eax, 0xDEADBEEF
     and ecx, 0o770
     mov edx, 0b01010101
@@ -0,0 +1,677 @@
+/**
+ * Generates the instruction and register tables of the encoder from the
+ * instruction table in doc/instructions.txt.
+ *
+ * Usage: encodergen <instructions> <output.c>
+ *
+ * The output implements the lookups declared in src/encoder/table.h. Both
+ * tables are perfect hashed with hash and displace: a first hash picks a
+ * bucket, every bucket stores the seed of a second hash that sends each key in
+ * the bucket to its own slot. The seeds are searched here, so a lookup is two
+ * hashes and a single string comparison.
+ */
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+constexpr size_t max_forms = 2048;
+constexpr size_t max_registers = 128;
+constexpr size_t max_words = 16;
+constexpr size_t max_operands = 3;
+constexpr size_t max_opcode = 3;
+constexpr uint32_t max_seed = UINT16_MAX;
+
+typedef enum operand_class {
+    OPERAND_R8,
+    OPERAND_R16,
+    OPERAND_R32,
+    OPERAND_R64,
+    OPERAND_RM8,
+    OPERAND_RM16,
+    OPERAND_RM32,
+    OPERAND_RM64,
+    OPERAND_M,
+    OPERAND_AL,
+    OPERAND_AX,
+    OPERAND_EAX,
+    OPERAND_RAX,
+    OPERAND_CL,
+    OPERAND_ONE,
+    OPERAND_IMM8,
+    OPERAND_IMM16,
+    OPERAND_IMM32,
+    OPERAND_IMM64,
+    OPERAND_REL8,
+    OPERAND_REL32,
+    OPERAND_CLASS_COUNT,
+} operand_class_t;
+
+/* Spelling in the instruction table, name of the enum constant and size in
+ * bits, 0 for classes without a size */
+static const struct {
+    const char *name;
+    const char *constant;
+    int size;
+} operand_classes[] = {
+    [OPERAND_R8] = {"r8", "OPERAND_R8", 8},
+    [OPERAND_R16] = {"r16", "OPERAND_R16", 16},
+    [OPERAND_R32] = {"r32", "OPERAND_R32", 32},
+    [OPERAND_R64] = {"r64", "OPERAND_R64", 64},
+    [OPERAND_RM8] = {"rm8", "OPERAND_RM8", 8},
+    [OPERAND_RM16] = {"rm16", "OPERAND_RM16", 16},
+    [OPERAND_RM32] = {"rm32", "OPERAND_RM32", 32},
+    [OPERAND_RM64] = {"rm64", "OPERAND_RM64", 64},
+    [OPERAND_M] = {"m", "OPERAND_M", 0},
+    [OPERAND_AL] = {"al", "OPERAND_AL", 8},
+    [OPERAND_AX] = {"ax", "OPERAND_AX", 16},
+    [OPERAND_EAX] = {"eax", "OPERAND_EAX", 32},
+    [OPERAND_RAX] = {"rax", "OPERAND_RAX", 64},
+    [OPERAND_CL] = {"cl", "OPERAND_CL", 8},
+    [OPERAND_ONE] = {"1", "OPERAND_ONE", 0},
+    [OPERAND_IMM8] = {"imm8", "OPERAND_IMM8", 8},
+    [OPERAND_IMM16] = {"imm16", "OPERAND_IMM16", 16},
+    [OPERAND_IMM32] = {"imm32", "OPERAND_IMM32", 32},
+    [OPERAND_IMM64] = {"imm64", "OPERAND_IMM64", 64},
+    [OPERAND_REL8] = {"rel8", "OPERAND_REL8", 8},
+    [OPERAND_REL32] = {"rel32", "OPERAND_REL32", 32},
+};
+
+typedef struct form {
+    char *mnemonic;
+    char *source;
+    size_t operand_count;
+    operand_class_t operands[max_operands];
+    bool operand_size_prefix;
+    bool rex_w;
+    bool default_64;
+    size_t opcode_length;
+    unsigned opcode[max_opcode];
+    bool opcode_register;
+    int modrm;
+    int reg_operand;
+    int rm_operand;
+    int immediate_operand;
+    int immediate_size;
+    int operand_size;
+    bool immediate_signed;
+    bool relative;
+} form_t;
+
+typedef struct register_entry {
+    char *name;
+    int size;
+    int number;
+    bool rex;
+} register_entry_t;
+
+typedef struct spec {
+    size_t form_count;
+    form_t forms[max_forms];
+    size_t register_count;
+    register_entry_t registers[max_registers];
+} spec_t;
+
+/* A set of keys to perfect hash, slots[i] is the slot of keys[i] */
+typedef struct perfect_hash {
+    size_t len;
+    const char **keys;
+    size_t *slots;
+    size_t bucket_count;
+    size_t slot_count;
+    uint32_t *seeds;
+} perfect_hash_t;
+
+static const char *spec_path;
+static size_t current_line;
+
+[[noreturn]] static void fail(const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    fprintf(stderr, "encodergen: %s:%zu: ", spec_path, current_line);
+    vfprintf(stderr, fmt, args);
+    fprintf(stderr, "\n");
+    va_end(args);
+    exit(1);
+}
+
+static void *checked_calloc(size_t n, size_t size) {
+    void *p = calloc(n, size);
+    if (p == nullptr)
+        fail("memory allocation failed");
+    return p;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Reading the instruction table                                            */
+/* ------------------------------------------------------------------------ */
+
+static char *read_file(const char *path) {
+    FILE *fp = fopen(path, "rb");
+    if (fp == nullptr)
+        fail("can't open instruction table");
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    char *text = checked_calloc(size + 1, 1);
+    if (fread(text, 1, size, fp) != (size_t)size)
+        fail("can't read instruction table");
+    fclose(fp);
+    return text;
+}
+
+// Blanks out comments, keeping the newlines so line numbers stay correct
+static void strip_comments(char *text) {
+    for (char *p = text; (p = strstr(p, "/*"));) {
+        char *end = strstr(p + 2, "*/");
+        if (end == nullptr)
+            fail("unterminated comment");
+        for (; p < end + 2; ++p)
+            if (*p != '\n')
+                *p = ' ';
+    }
+}
+
+// Splits a line into words at whitespace and commas
+static size_t split(char *line, char *words[max_words]) {
+    size_t len = 0;
+    for (char *p = line; *p;) {
+        if (isspace((unsigned char)*p) || *p == ',') {
+            *p++ = '\0';
+            continue;
+        }
+        if (len == max_words)
+            fail("too many words");
+        words[len++] = p;
+        while (*p && !isspace((unsigned char)*p) && *p != ',')
+            p++;
+    }
+    return len;
+}
+
+static void read_register(spec_t *spec, char **words, size_t len) {
+    if (len < 4 || len > 5 || (len == 5 && strcmp(words[4], "rex") != 0))
+        fail("expected 'register <name> <bits> <number> [rex]'");
+    if (spec->register_count == max_registers)
+        fail("too many registers");
+
+    register_entry_t *reg = &spec->registers[spec->register_count++];
+    reg->name = strdup(words[1]);
+    reg->size = atoi(words[2]);
+    reg->number = atoi(words[3]);
+    reg->rex = len == 5;
+    if (reg->size != 8 && reg->size != 16 && reg->size != 32 &&
+        reg->size != 64)
+        fail("invalid register size %s", words[2]);
+    if (reg->number < 0 || reg->number > 15)
+        fail("invalid register number %s", words[3]);
+}
+
+static operand_class_t read_operand_class(const char *word) {
+    for (size_t i = 0; i < OPERAND_CLASS_COUNT; ++i)
+        if (strcmp(word, operand_classes[i].name) == 0)
+            return i;
+    fail("unknown operand class '%s'", word);
+}
+
+static bool is_register_class(operand_class_t class) {
+    return class <= OPERAND_R64;
+}
+
+static bool is_rm_class(operand_class_t class) {
+    return class >= OPERAND_RM8 && class <= OPERAND_M;
+}
+
+static bool is_immediate_class(operand_class_t class) {
+    return class >= OPERAND_IMM8;
+}
+
+static int find_operand(form_t *form, bool (*matches)(operand_class_t)) {
+    int found = -1;
+    for (size_t i = 0; i < form->operand_count; ++i) {
+        if (!matches(form->operands[i]))
+            continue;
+        if (found != -1)
+            fail("ambiguous operands for the encoding");
+        found = i;
+    }
+    return found;
+}
+
+// Opcode bytes are upper case so they can't be confused with cd or ib
+static bool is_opcode_digit(char c) {
+    return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'F');
+}
+
+static void read_encoding(form_t *form, char **words, size_t len) {
+    form->modrm = -1;
+    for (size_t i = 0; i < len; ++i) {
+        char *word = words[i];
+        if (strcmp(word, "o16") == 0) {
+            form->operand_size_prefix = true;
+        } else if (strcmp(word, "rex.w") == 0) {
+            form->rex_w = true;
+        } else if (strcmp(word, "d64") == 0) {
+            form->default_64 = true;
+        } else if (strcmp(word, "/r") == 0) {
+            form->modrm = 8;
+        } else if (word[0] == '/' && word[1] >= '0' && word[1] <= '7' &&
+                   word[2] == '\0') {
+            form->modrm = word[1] - '0';
+        } else if (strcmp(word, "ib") == 0 || strcmp(word, "iw") == 0 ||
+                   strcmp(word, "id") == 0 || strcmp(word, "io") == 0) {
+            form->immediate_size = word[1] == 'b'   ? 1
+                                   : word[1] == 'w' ? 2
+                                   : word[1] == 'd' ? 4
+                                                    : 8;
+        } else if (strcmp(word, "cb") == 0 || strcmp(word, "cd") == 0) {
+            form->immediate_size = word[1] == 'b' ? 1 : 4;
+            form->relative = true;
+        } else if (is_opcode_digit(word[0]) && is_opcode_digit(word[1]) &&
+                   (word[2] == '\0' || strcmp(word + 2, "+r") == 0)) {
+            if (form->opcode_register)
+                fail("+r has to be on the last opcode byte");
+            if (form->opcode_length == max_opcode)
+                fail("too many opcode bytes");
+            form->opcode[form->opcode_length++] = strtoul(word, nullptr, 16);
+            form->opcode_register = word[2] == '+';
+        } else {
+            fail("unknown encoding '%s'", word);
+        }
+    }
+    if (form->opcode_length == 0)
+        fail("missing opcode");
+}
+
+// Checks the encoding against the operands and assigns the operand roles
+static void assign_operands(form_t *form) {
+    form->reg_operand = find_operand(form, is_register_class);
+    form->rm_operand = find_operand(form, is_rm_class);
+    form->immediate_operand = find_operand(form, is_immediate_class);
+
+    bool has_reg = form->modrm == 8 || form->opcode_register;
+    if (has_reg != (form->reg_operand != -1))
+        fail("r operand doesn't match the encoding");
+    if ((form->modrm != -1) != (form->rm_operand != -1))
+        fail("rm operand doesn't match the encoding");
+    if (form->modrm == 8 && form->opcode_register)
+        fail("/r and +r can't be combined");
+    if ((form->immediate_size != 0) != (form->immediate_operand != -1))
+        fail("immediate operand doesn't match the encoding");
+
+    if (form->immediate_operand == -1)
+        return;
+    operand_class_t immediate = form->operands[form->immediate_operand];
+    bool relative = immediate == OPERAND_REL8 || immediate == OPERAND_REL32;
+    if (relative != form->relative)
+        fail("rel8 and rel32 operands need a cb or cd encoding");
+    if (operand_classes[immediate].size != form->immediate_size * 8)
+        fail("immediate size doesn't match the operand");
+
+    int operand_size = 0;
+    for (size_t i = 0; i < form->operand_count; ++i)
+        if (!is_immediate_class(form->operands[i]) &&
+            operand_classes[form->operands[i]].size > operand_size)
+            operand_size = operand_classes[form->operands[i]].size;
+    if (form->default_64 && operand_size != 0)
+        fail("d64 is only for forms without sized operands");
+    if (form->default_64)
+        operand_size = 64;
+    // Without other operands the immediate is the operand, like int's
+    if (operand_size == 0)
+        operand_size = form->immediate_size * 8;
+    form->operand_size = operand_size;
+    form->immediate_signed = form->immediate_size * 8 < operand_size;
+}
+
+static bool is_short_branch(const form_t *form) {
+    return form->operand_count == 1 && form->operands[0] == OPERAND_REL8;
+}
+
+static void read_form(spec_t *spec, char *line, char *encoding,
+                      const char *source) {
+    char *words[max_words];
+    size_t len = split(line, words);
+    if (len == 0)
+        fail("missing mnemonic");
+
+    if (spec->form_count == max_forms)
+        fail("too many instruction forms");
+    form_t *form = &spec->forms[spec->form_count++];
+    form->mnemonic = strdup(words[0]);
+    form->source = strdup(source);
+
+    for (size_t i = 1; i < len; ++i) {
+        if (form->operand_count == max_operands)
+            fail("too many operands");
+        form->operands[form->operand_count++] = read_operand_class(words[i]);
+    }
+
+    len = split(encoding, words);
+    read_encoding(form, words, len);
+    assign_operands(form);
+
+    // The assembler replaces a short branch that doesn't reach its label with
+    // the next form
+    form_t *previous =
+        spec->form_count >= 2 ? &spec->forms[spec->form_count - 2] : nullptr;
+    if (previous && is_short_branch(previous) &&
+        (strcmp(previous->mnemonic, form->mnemonic) != 0 ||
+         form->operand_count != 1 || form->operands[0] != OPERAND_REL32))
+        fail("rel8 forms have to be followed by a rel32 form");
+
+    // Forms of the same instruction have to be next to each other
+    for (size_t j = 0; j + 2 < spec->form_count; ++j)
+        if (strcmp(spec->forms[j].mnemonic, form->mnemonic) == 0 &&
+            strcmp(spec->forms[j + 1].mnemonic, form->mnemonic) != 0)
+            fail("forms of '%s' aren't consecutive", form->mnemonic);
+}
+
+static void read_spec(spec_t *spec, char *text) {
+    strip_comments(text);
+    current_line = 0;
+    for (char *line = text; line;) {
+        current_line += 1;
+        char *next = strchr(line, '\n');
+        if (next)
+            *next++ = '\0';
+
+        // The line with its whitespace collapsed, for comments in the output
+        char source[256] = {};
+        size_t source_len = 0;
+        for (char *p = line; *p && source_len + 1 < sizeof(source); ++p) {
+            bool space = isspace((unsigned char)*p);
+            if (space && (source_len == 0 || source[source_len - 1] == ' '))
+                continue;
+            source[source_len++] = space ? ' ' : *p;
+        }
+
+        char *encoding = strchr(line, ':');
+        if (encoding) {
+            *encoding++ = '\0';
+            read_form(spec, line, encoding, source);
+        } else {
+            char *words[max_words];
+            size_t len = split(line, words);
+            if (len > 0 && strcmp(words[0], "register") == 0)
+                read_register(spec, words, len);
+            else if (len > 0)
+                fail("expected a register or an instruction form");
+        }
+        line = next;
+    }
+    if (spec->form_count &&
+        is_short_branch(&spec->forms[spec->form_count - 1]))
+        fail("rel8 forms have to be followed by a rel32 form");
+    current_line = 0;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Perfect hashing                                                          */
+/* ------------------------------------------------------------------------ */
+
+/* Must stay in sync with the hash emitted into the generated file */
+static uint32_t table_hash(const char *key, uint32_t seed) {
+    uint32_t hash = 0x811c9dc5 ^ (seed * 0x9e3779b9);
+    for (; *key; ++key)
+        hash = (hash ^ (unsigned char)*key) * 0x01000193;
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6b;
+    hash ^= hash >> 13;
+    return hash;
+}
+
+static size_t bucket_size(perfect_hash_t *ph, size_t bucket) {
+    size_t size = 0;
+    for (size_t i = 0; i < ph->len; ++i)
+        if (table_hash(ph->keys[i], 0) % ph->bucket_count == bucket)
+            size++;
+    return size;
+}
+
+// Tries to place every key of the bucket with the seed
+static bool place_bucket(perfect_hash_t *ph, size_t bucket, uint32_t seed,
+                         bool *taken) {
+    size_t placed[ph->len];
+    size_t placed_count = 0;
+    for (size_t i = 0; i < ph->len; ++i) {
+        if (table_hash(ph->keys[i], 0) % ph->bucket_count != bucket)
+            continue;
+        size_t slot = table_hash(ph->keys[i], seed) & (ph->slot_count - 1);
+        if (taken[slot]) {
+            for (size_t j = 0; j < placed_count; ++j)
+                taken[ph->slots[placed[j]]] = false;
+            return false;
+        }
+        taken[slot] = true;
+        ph->slots[i] = slot;
+        placed[placed_count++] = i;
+    }
+    return true;
+}
+
+static void perfect_hash(perfect_hash_t *ph) {
+    ph->bucket_count = ph->len / 2 + 1;
+    ph->slot_count = 1;
+    while (ph->slot_count < ph->len + ph->len / 4)
+        ph->slot_count *= 2;
+    ph->seeds = checked_calloc(ph->bucket_count, sizeof(uint32_t));
+    ph->slots = checked_calloc(ph->len, sizeof(size_t));
+    bool *taken = checked_calloc(ph->slot_count, sizeof(bool));
+
+    // Place the largest buckets first while most slots are still free
+    size_t *order = checked_calloc(ph->bucket_count, sizeof(size_t));
+    size_t *sizes = checked_calloc(ph->bucket_count, sizeof(size_t));
+    for (size_t i = 0; i < ph->bucket_count; ++i) {
+        sizes[i] = bucket_size(ph, i);
+        size_t j = i;
+        for (; j > 0 && sizes[order[j - 1]] < sizes[i]; --j)
+            order[j] = order[j - 1];
+        order[j] = i;
+    }
+
+    for (size_t i = 0; i < ph->bucket_count && sizes[order[i]]; ++i) {
+        uint32_t seed = 1;
+        while (!place_bucket(ph, order[i], seed, taken))
+            if (++seed > max_seed)
+                fail("no perfect hash found for bucket %zu", order[i]);
+        ph->seeds[order[i]] = seed;
+    }
+
+    free(sizes);
+    free(order);
+    free(taken);
+}
+
+/* ------------------------------------------------------------------------ */
+/* Output                                                                   */
+/* ------------------------------------------------------------------------ */
+
+static void perfect_hash_free(perfect_hash_t *ph) {
+    free(ph->seeds);
+    free(ph->slots);
+}
+
+static void spec_free(spec_t *spec) {
+    for (size_t i = 0; i < spec->form_count; ++i) {
+        free(spec->forms[i].mnemonic);
+        free(spec->forms[i].source);
+    }
+    for (size_t i = 0; i < spec->register_count; ++i)
+        free(spec->registers[i].name);
+    free(spec);
+}
+
+static const char prelude[] =
+    "#include \"encoder/table.h\"\n"
+    "#include <string.h>\n"
+    "\n"
+    "static uint32_t table_hash(const char *key, uint32_t seed) {\n"
+    "    uint32_t hash = 0x811c9dc5 ^ (seed * 0x9e3779b9);\n"
+    "    for (; *key; ++key)\n"
+    "        hash = (hash ^ (unsigned char)*key) * 0x01000193;\n"
+    "    hash ^= hash >> 16;\n"
+    "    hash *= 0x85ebca6b;\n"
+    "    hash ^= hash >> 13;\n"
+    "    return hash;\n"
+    "}\n"
+    "\n";
+
+static void emit_seeds(FILE *out, const char *name, perfect_hash_t *ph) {
+    fprintf(out, "static const uint16_t %s_seeds[%zu] = {", name,
+            ph->bucket_count);
+    for (size_t i = 0; i < ph->bucket_count; ++i)
+        fprintf(out, "%s%u,", i % 12 ? " " : "\n    ", ph->seeds[i]);
+    fprintf(out, "\n};\n\n");
+}
+
+// The key parameter is named after the field of the table that holds it
+static void emit_lookup(FILE *out, const char *type, const char *function,
+                        const char *table, const char *key,
+                        perfect_hash_t *ph) {
+    fprintf(out, "const %s *%s(const char *%s) {\n", type, function, key);
+    fprintf(out, "    uint32_t bucket = table_hash(%s, 0) %% %zu;\n", key,
+            ph->bucket_count);
+    fprintf(out,
+            "    uint32_t slot = table_hash(%s, %s_seeds[bucket]) & %zu;\n",
+            key, table, ph->slot_count - 1);
+    fprintf(out, "    const %s *entry = &%s[slot];\n", type, table);
+    fprintf(out,
+            "    if (entry->%s == nullptr || strcmp(entry->%s, %s) != 0)\n"
+            "        return nullptr;\n"
+            "    return entry;\n"
+            "}\n\n",
+            key, key, key);
+}
+
+static void emit_form(FILE *out, form_t *form) {
+    fprintf(out, "    /* %s */\n", form->source);
+    fprintf(out, "    {.operand_count = %zu, .operands = {",
+            form->operand_count);
+    for (size_t i = 0; i < form->operand_count; ++i)
+        fprintf(out, "%s%s", i ? ", " : "",
+                operand_classes[form->operands[i]].constant);
+    fprintf(out, "},\n     .operand_size_prefix = %s, .rex_w = %s,\n",
+            form->operand_size_prefix ? "true" : "false",
+            form->rex_w ? "true" : "false");
+    fprintf(out, "     .opcode_length = %zu, .opcode = {", form->opcode_length);
+    for (size_t i = 0; i < form->opcode_length; ++i)
+        fprintf(out, "%s0x%02x", i ? ", " : "", form->opcode[i]);
+    char modrm[16];
+    if (form->modrm == -1)
+        snprintf(modrm, sizeof(modrm), "modrm_none");
+    else if (form->modrm == 8)
+        snprintf(modrm, sizeof(modrm), "modrm_register");
+    else
+        snprintf(modrm, sizeof(modrm), "%d", form->modrm);
+    fprintf(out, "},\n     .opcode_register = %s, .modrm = %s,\n",
+            form->opcode_register ? "true" : "false", modrm);
+    fprintf(out,
+            "     .reg_operand = %d, .rm_operand = %d, "
+            ".immediate_operand = %d,\n",
+            form->reg_operand, form->rm_operand, form->immediate_operand);
+    fprintf(out,
+            "     .immediate_size = %d, .operand_size = %d,\n"
+            "     .immediate_signed = %s, .relative = %s},\n",
+            form->immediate_size, form->operand_size,
+            form->immediate_signed ? "true" : "false",
+            form->relative ? "true" : "false");
+}
+
+static void generate_instructions(spec_t *spec, FILE *out) {
+    fprintf(out, "static const instruction_form_t forms[] = {\n");
+    for (size_t i = 0; i < spec->form_count; ++i)
+        emit_form(out, &spec->forms[i]);
+    fprintf(out, "};\n\n");
+
+    // One key per mnemonic, pointing at its first form
+    const char **keys = checked_calloc(spec->form_count, sizeof(char *));
+    size_t *first = checked_calloc(spec->form_count, sizeof(size_t));
+    size_t *count = checked_calloc(spec->form_count, sizeof(size_t));
+    size_t len = 0;
+    for (size_t i = 0; i < spec->form_count; ++i) {
+        if (len && strcmp(keys[len - 1], spec->forms[i].mnemonic) == 0) {
+            count[len - 1]++;
+            continue;
+        }
+        keys[len] = spec->forms[i].mnemonic;
+        first[len] = i;
+        count[len] = 1;
+        len++;
+    }
+
+    perfect_hash_t ph = {.len = len, .keys = keys};
+    perfect_hash(&ph);
+    emit_seeds(out, "instructions", &ph);
+
+    fprintf(out, "static const instruction_t instructions[%zu] = {\n",
+            ph.slot_count);
+    for (size_t i = 0; i < len; ++i)
+        fprintf(out,
+                "    [%zu] = {.mnemonic = \"%s\", .form_count = %zu, "
+                ".forms = &forms[%zu]},\n",
+                ph.slots[i], keys[i], count[i], first[i]);
+    fprintf(out, "};\n\n");
+
+    emit_lookup(out, "instruction_t", "instruction_lookup", "instructions",
+                "mnemonic", &ph);
+    perfect_hash_free(&ph);
+    free(keys);
+    free(first);
+    free(count);
+}
+
+static void generate_registers(spec_t *spec, FILE *out) {
+    const char **keys = checked_calloc(spec->register_count, sizeof(char *));
+    for (size_t i = 0; i < spec->register_count; ++i)
+        keys[i] = spec->registers[i].name;
+
+    perfect_hash_t ph = {.len = spec->register_count, .keys = keys};
+    perfect_hash(&ph);
+    emit_seeds(out, "registers", &ph);
+
+    fprintf(out, "static const register_info_t registers[%zu] = {\n",
+            ph.slot_count);
+    for (size_t i = 0; i < spec->register_count; ++i) {
+        register_entry_t *reg = &spec->registers[i];
+        fprintf(out,
+                "    [%zu] = {.name = \"%s\", .size = %d, .number = %d, "
+                ".rex = %s},\n",
+                ph.slots[i], reg->name, reg->size, reg->number,
+                reg->rex ? "true" : "false");
+    }
+    fprintf(out, "};\n\n");
+
+    emit_lookup(out, "register_info_t", "register_lookup", "registers",
+                "name", &ph);
+    perfect_hash_free(&ph);
+    free(keys);
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        fputs("Usage: encodergen <instructions> <output.c>\n", stderr);
+        return 1;
+    }
+    spec_path = argv[1];
+
+    spec_t *spec = checked_calloc(1, sizeof(spec_t));
+    char *text = read_file(argv[1]);
+    read_spec(spec, text);
+    free(text);
+
+    FILE *out = fopen(argv[2], "w");
+    if (out == nullptr)
+        fail("can't open output file");
+    fprintf(out, "/* Generated by tools/encodergen.c from %s, do not edit */\n",
+            spec_path);
+    fprintf(out, "%s", prelude);
+    generate_instructions(spec, out);
+    generate_registers(spec, out);
+    if (fclose(out))
+        fail("can't write output file");
+    spec_free(spec);
+    return 0;
+}
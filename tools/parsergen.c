@@ -0,0 +1,1000 @@
+/**
+ * Generates a specialized recursive descent parser from the BNF grammar in
+ * doc/parser_grammar.txt.
+ *
+ * Usage: parsergen <grammar> <output.c> <output.h>
+ *
+ * Every rule becomes a function `parse_generated_<rule>` with the same
+ * signature as the hand written parsers in src/parser. Alternations are
+ * compiled into a switch on the current token id using the FIRST sets of the
+ * alternatives, rules call each other directly and token tests are emitted
+ * inline. How rules map to AST nodes is described at the top of the grammar.
+ */
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+constexpr size_t max_rules = 256;
+constexpr size_t max_tokens = 128;
+constexpr size_t max_items = 32;
+constexpr size_t max_alternatives = 128;
+constexpr size_t max_name_length = 64;
+
+typedef enum item_kind {
+    ITEM_SYMBOL,
+    ITEM_LITERAL,
+    ITEM_GROUP,
+} item_kind_t;
+
+typedef struct alternation alternation_t;
+
+typedef struct item {
+    item_kind_t kind;
+    char suffix; // 0 or one of '?', '*', '+'
+    char *value; // symbol name or literal value
+    alternation_t *group;
+} item_t;
+
+typedef struct sequence {
+    size_t len;
+    item_t items[max_items];
+} sequence_t;
+
+/* Function names and FIRST sets are cached on every alternation, groups are
+ * compiled into their own functions just like rules are */
+struct alternation {
+    size_t len;
+    sequence_t *alternatives[max_alternatives];
+    char function[3 * max_name_length];
+    bool first[max_tokens];
+    bool nullable;
+};
+
+typedef enum rule_kind {
+    RULE_TOKEN,       // <rule> ::= <token>
+    RULE_LITERAL,     // <rule> ::= "value" | "other value"
+    RULE_ALTERNATION, // <rule> ::= <a> | <b>
+    RULE_SEQUENCE,    // <rule> ::= <a> <b>? ( <c> | <d> )*
+} rule_kind_t;
+
+typedef struct rule {
+    char *name;
+    rule_kind_t kind;
+    alternation_t *body;
+    size_t group_count;
+} rule_t;
+
+typedef struct grammar {
+    size_t rule_count;
+    rule_t rules[max_rules];
+    size_t token_count;
+    char *tokens[max_tokens];
+} grammar_t;
+
+static const char *grammar_path;
+
+[[noreturn]] static void fail(const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    fprintf(stderr, "parsergen: %s: ", grammar_path);
+    vfprintf(stderr, fmt, args);
+    fprintf(stderr, "\n");
+    va_end(args);
+    exit(1);
+}
+
+static void *checked_calloc(size_t n, size_t size) {
+    void *p = calloc(n, size);
+    if (p == nullptr)
+        fail("memory allocation failed");
+    return p;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Reading the grammar                                                      */
+/* ------------------------------------------------------------------------ */
+
+typedef enum gtoken_id {
+    GTOKEN_EOF,
+    GTOKEN_NAME,
+    GTOKEN_LITERAL,
+    GTOKEN_DEFINE,
+    GTOKEN_PIPE,
+    GTOKEN_LPAREN,
+    GTOKEN_RPAREN,
+    GTOKEN_SUFFIX,
+} gtoken_id_t;
+
+typedef struct gtoken {
+    gtoken_id_t id;
+    char *value;
+    size_t line;
+} gtoken_t;
+
+typedef struct scanner {
+    const char *p;
+    size_t line;
+    gtoken_t current;
+    gtoken_t peek;
+} scanner_t;
+
+static gtoken_t scan(scanner_t *s) {
+    for (;;) {
+        while (isspace((unsigned char)*s->p)) {
+            if (*s->p == '\n')
+                s->line += 1;
+            s->p++;
+        }
+        if (s->p[0] != '/' || s->p[1] != '*')
+            break;
+        const char *end = strstr(s->p + 2, "*/");
+        if (end == nullptr)
+            fail("line %zu: unterminated comment", s->line);
+        for (; s->p < end; s->p++)
+            if (*s->p == '\n')
+                s->line += 1;
+        s->p = end + 2;
+    }
+
+    gtoken_t token = {.line = s->line};
+    const char *start = s->p;
+    switch (*s->p) {
+    case '\0':
+        token.id = GTOKEN_EOF;
+        return token;
+    case '|':
+        token.id = GTOKEN_PIPE;
+        s->p++;
+        return token;
+    case '(':
+        token.id = GTOKEN_LPAREN;
+        s->p++;
+        return token;
+    case ')':
+        token.id = GTOKEN_RPAREN;
+        s->p++;
+        return token;
+    case '?':
+    case '*':
+    case '+':
+        token.id = GTOKEN_SUFFIX;
+        token.value = strndup(s->p, 1);
+        s->p++;
+        return token;
+    case ':':
+        if (strncmp(s->p, "::=", 3) != 0)
+            fail("line %zu: expected '::='", s->line);
+        token.id = GTOKEN_DEFINE;
+        s->p += 3;
+        return token;
+    case '<':
+        start = ++s->p;
+        while (isalnum((unsigned char)*s->p) || *s->p == '_')
+            s->p++;
+        if (*s->p != '>' || s->p == start ||
+            (size_t)(s->p - start) >= max_name_length)
+            fail("line %zu: invalid name", s->line);
+        token.id = GTOKEN_NAME;
+        token.value = strndup(start, s->p - start);
+        s->p++;
+        return token;
+    case '"':
+        start = ++s->p;
+        while (*s->p && *s->p != '"' && *s->p != '\n')
+            s->p++;
+        if (*s->p != '"')
+            fail("line %zu: unterminated literal", s->line);
+        token.id = GTOKEN_LITERAL;
+        token.value = strndup(start, s->p - start);
+        s->p++;
+        return token;
+    default:
+        fail("line %zu: unexpected character '%c'", s->line, *s->p);
+    }
+}
+
+static void advance(scanner_t *s) {
+    s->current = s->peek;
+    s->peek = scan(s);
+}
+
+// A rule definition starts with a name followed by ::=
+static bool at_rule_start(scanner_t *s) {
+    return s->current.id == GTOKEN_NAME && s->peek.id == GTOKEN_DEFINE;
+}
+
+static alternation_t *read_alternation(scanner_t *s);
+
+static sequence_t *read_sequence(scanner_t *s) {
+    sequence_t *seq = checked_calloc(1, sizeof(sequence_t));
+    for (;;) {
+        item_t item = {};
+        switch (s->current.id) {
+        case GTOKEN_NAME:
+            if (at_rule_start(s))
+                goto done;
+            item.kind = ITEM_SYMBOL;
+            item.value = s->current.value;
+            advance(s);
+            break;
+        case GTOKEN_LITERAL:
+            item.kind = ITEM_LITERAL;
+            item.value = s->current.value;
+            advance(s);
+            break;
+        case GTOKEN_LPAREN:
+            advance(s);
+            item.kind = ITEM_GROUP;
+            item.group = read_alternation(s);
+            if (s->current.id != GTOKEN_RPAREN)
+                fail("line %zu: expected ')'", s->current.line);
+            advance(s);
+            break;
+        default:
+            goto done;
+        }
+        if (s->current.id == GTOKEN_SUFFIX) {
+            item.suffix = s->current.value[0];
+            advance(s);
+        }
+        if (seq->len == max_items)
+            fail("line %zu: too many items in sequence", s->current.line);
+        seq->items[seq->len++] = item;
+    }
+done:
+    if (seq->len == 0)
+        fail("line %zu: empty sequence", s->current.line);
+    return seq;
+}
+
+static alternation_t *read_alternation(scanner_t *s) {
+    alternation_t *alt = checked_calloc(1, sizeof(alternation_t));
+    alt->alternatives[alt->len++] = read_sequence(s);
+    while (s->current.id == GTOKEN_PIPE) {
+        advance(s);
+        if (alt->len == max_alternatives)
+            fail("line %zu: too many alternatives", s->current.line);
+        alt->alternatives[alt->len++] = read_sequence(s);
+    }
+    return alt;
+}
+
+static rule_t *find_rule(grammar_t *g, const char *name) {
+    for (size_t i = 0; i < g->rule_count; ++i)
+        if (strcmp(g->rules[i].name, name) == 0)
+            return &g->rules[i];
+    return nullptr;
+}
+
+static int find_token(grammar_t *g, const char *name) {
+    for (size_t i = 0; i < g->token_count; ++i)
+        if (strcmp(g->tokens[i], name) == 0)
+            return (int)i;
+    return -1;
+}
+
+static void add_token(grammar_t *g, char *name) {
+    if (find_token(g, name) >= 0)
+        return;
+    if (g->token_count == max_tokens)
+        fail("too many tokens");
+    g->tokens[g->token_count++] = name;
+}
+
+static void read_grammar(grammar_t *g, const char *text) {
+    scanner_t s = {.p = text, .line = 1};
+    s.peek = scan(&s);
+    advance(&s);
+
+    while (s.current.id != GTOKEN_EOF) {
+        if (!at_rule_start(&s))
+            fail("line %zu: expected a rule definition", s.current.line);
+        if (g->rule_count == max_rules)
+            fail("too many rules");
+        rule_t *rule = &g->rules[g->rule_count++];
+        rule->name = s.current.value;
+        advance(&s);
+        advance(&s);
+        rule->body = read_alternation(&s);
+    }
+}
+
+/* Names that are used but never defined are the tokens the lexer emits */
+static void collect_tokens(grammar_t *g, alternation_t *alt) {
+    for (size_t i = 0; i < alt->len; ++i) {
+        sequence_t *seq = alt->alternatives[i];
+        for (size_t j = 0; j < seq->len; ++j) {
+            item_t *item = &seq->items[j];
+            if (item->kind == ITEM_SYMBOL && !find_rule(g, item->value))
+                add_token(g, item->value);
+            if (item->kind == ITEM_GROUP)
+                collect_tokens(g, item->group);
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------ */
+/* Analysis                                                                 */
+/* ------------------------------------------------------------------------ */
+
+static bool is_single_symbol(sequence_t *seq) {
+    return seq->len == 1 && seq->items[0].kind == ITEM_SYMBOL &&
+           seq->items[0].suffix == 0;
+}
+
+static bool is_single_literal(sequence_t *seq) {
+    return seq->len == 1 && seq->items[0].kind == ITEM_LITERAL &&
+           seq->items[0].suffix == 0;
+}
+
+// An alternation of plain symbols returns whatever alternative matched
+static bool is_transparent(alternation_t *alt) {
+    for (size_t i = 0; i < alt->len; ++i)
+        if (!is_single_symbol(alt->alternatives[i]))
+            return false;
+    return true;
+}
+
+static void classify(grammar_t *g, rule_t *rule) {
+    alternation_t *body = rule->body;
+    bool all_literals = true;
+    for (size_t i = 0; i < body->len; ++i)
+        all_literals = all_literals && is_single_literal(body->alternatives[i]);
+
+    if (all_literals)
+        rule->kind = RULE_LITERAL;
+    else if (body->len == 1 && is_single_symbol(body->alternatives[0]) &&
+             !find_rule(g, body->alternatives[0]->items[0].value))
+        rule->kind = RULE_TOKEN;
+    else if (body->len > 1 && is_transparent(body))
+        rule->kind = RULE_ALTERNATION;
+    else if (body->len == 1)
+        rule->kind = RULE_SEQUENCE;
+    else
+        fail("rule <%s>: alternatives must be single symbols, group them "
+             "with parentheses",
+             rule->name);
+}
+
+static bool merge_first(bool *into, bool *from) {
+    bool changed = false;
+    for (size_t i = 0; i < max_tokens; ++i) {
+        if (from[i] && !into[i]) {
+            into[i] = true;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+static bool compute_first_alternation(grammar_t *g, alternation_t *alt);
+
+/**
+ * Computes the FIRST set and nullability of a single item ignoring its suffix,
+ * returns true if anything new was learned about a group (used for the
+ * fixpoint)
+ */
+static bool element_first(grammar_t *g, item_t *item, bool *first,
+                          bool *nullable) {
+    bool changed = false;
+    memset(first, 0, sizeof(bool) * max_tokens);
+    *nullable = false;
+
+    switch (item->kind) {
+    case ITEM_LITERAL:
+        first[find_token(g, "identifier")] = true;
+        break;
+    case ITEM_SYMBOL: {
+        rule_t *rule = find_rule(g, item->value);
+        if (rule == nullptr) {
+            first[find_token(g, item->value)] = true;
+            break;
+        }
+        merge_first(first, rule->body->first);
+        *nullable = rule->body->nullable;
+        break;
+    }
+    case ITEM_GROUP:
+        changed = compute_first_alternation(g, item->group);
+        merge_first(first, item->group->first);
+        *nullable = item->group->nullable;
+        break;
+    }
+    return changed;
+}
+
+static bool item_first(grammar_t *g, item_t *item, bool *first,
+                       bool *nullable) {
+    bool changed = element_first(g, item, first, nullable);
+    *nullable = *nullable || item->suffix == '?' || item->suffix == '*';
+    return changed;
+}
+
+static bool compute_first_alternation(grammar_t *g, alternation_t *alt) {
+    bool changed = false;
+    for (size_t i = 0; i < alt->len; ++i) {
+        sequence_t *seq = alt->alternatives[i];
+        bool seq_nullable = true;
+        for (size_t j = 0; j < seq->len && seq_nullable; ++j) {
+            bool first[max_tokens];
+            bool nullable;
+            changed |= item_first(g, &seq->items[j], first, &nullable);
+            changed |= merge_first(alt->first, first);
+            seq_nullable = nullable;
+        }
+        if (seq_nullable && !alt->nullable) {
+            alt->nullable = true;
+            changed = true;
+        }
+    }
+    return changed;
+}
+
+static void compute_first(grammar_t *g) {
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (size_t i = 0; i < g->rule_count; ++i)
+            changed |= compute_first_alternation(g, g->rules[i].body);
+    }
+}
+
+/* <x> ( <delimiter> <x> )* is a list, delimiters aren't kept in the AST */
+static bool is_list(sequence_t *seq, size_t i) {
+    if (i + 1 >= seq->len)
+        return false;
+    item_t *element = &seq->items[i];
+    item_t *tail = &seq->items[i + 1];
+    if (element->kind != ITEM_SYMBOL || element->suffix != 0 ||
+        tail->kind != ITEM_GROUP || tail->suffix != '*' ||
+        tail->group->len != 1)
+        return false;
+    sequence_t *repeat = tail->group->alternatives[0];
+    return repeat->len == 2 && repeat->items[0].kind == ITEM_SYMBOL &&
+           repeat->items[0].suffix == 0 &&
+           repeat->items[1].kind == ITEM_SYMBOL &&
+           repeat->items[1].suffix == 0 &&
+           strcmp(repeat->items[1].value, element->value) == 0;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Code generation                                                          */
+/* ------------------------------------------------------------------------ */
+
+static char *upper(const char *name) {
+    static char buffer[max_name_length];
+    size_t i = 0;
+    for (; name[i]; ++i)
+        buffer[i] = toupper((unsigned char)name[i]);
+    buffer[i] = '\0';
+    return buffer;
+}
+
+static const char *function_for(grammar_t *g, item_t *item) {
+    static char buffer[3 * max_name_length];
+    if (item->kind == ITEM_GROUP)
+        return item->group->function;
+    if (item->kind == ITEM_LITERAL)
+        fail("literal \"%s\" can only be used in a rule of literals",
+             item->value);
+    (void)g;
+    snprintf(buffer, sizeof(buffer), "parse_generated_%s", item->value);
+    return buffer;
+}
+
+/* Groups that aren't plain alternations collect their nodes in a container
+ * node which gets spliced into the parent */
+static bool returns_container(item_t *item) {
+    return item->kind == ITEM_GROUP && !is_transparent(item->group);
+}
+
+static void emit_alternation_body(FILE *out, grammar_t *g, alternation_t *alt,
+                                  const char **functions);
+
+static void emit_append(FILE *out, item_t *item, const char *indent) {
+    fprintf(out,
+            "%sif ((result.err = %s(node, result.node)))\n"
+            "%s    return parse_generated_fail(node, result);\n"
+            "%scurrent = result.next;\n",
+            indent,
+            returns_container(item) ? "parse_generated_splice"
+                                    : "parse_generated_add",
+            indent, indent);
+}
+
+static void emit_required(FILE *out, grammar_t *g, item_t *item) {
+    fprintf(out,
+            "    result = %s(current);\n"
+            "    if (result.err || (result.err = %s(node, result.node)))\n"
+            "        return parse_generated_fail(node, result);\n"
+            "    current = result.next;\n",
+            function_for(g, item),
+            returns_container(item) ? "parse_generated_splice"
+                                    : "parse_generated_add");
+}
+
+static void emit_optional(FILE *out, grammar_t *g, item_t *item) {
+    fprintf(out,
+            "    result = %s(current);\n"
+            "    if (result.err == nullptr) {\n",
+            function_for(g, item));
+    emit_append(out, item, "        ");
+    fprintf(out, "    }\n");
+}
+
+static void emit_repeat(FILE *out, grammar_t *g, item_t *item,
+                        bool nullable) {
+    fprintf(out, "    while ((result = %s(current)).err == nullptr) {\n",
+            function_for(g, item));
+    if (nullable) {
+        fprintf(out, "        if (result.next == current) {\n"
+                     "            ast_node_free(result.node);\n"
+                     "            break;\n"
+                     "        }\n");
+    }
+    emit_append(out, item, "        ");
+    fprintf(out, "    }\n"
+                 "    if (result.err && result.err != err_parse_no_match)\n"
+                 "        return parse_generated_fail(node, result);\n");
+}
+
+static void emit_list(FILE *out, grammar_t *g, item_t *element,
+                      item_t *delimiter) {
+    const char *function = function_for(g, element);
+    fprintf(out,
+            "    result = %s(current);\n"
+            "    if (result.err || (result.err = parse_generated_add(node, "
+            "result.node)))\n"
+            "        return parse_generated_fail(node, result);\n"
+            "    current = result.next;\n"
+            "    while (current && current->token.id == TOKEN_%s) {\n",
+            function, upper(delimiter->value));
+    // The delimiter is only consumed along with the element after it
+    fprintf(out,
+            "        result = %s(tokenlist_next(current));\n"
+            "        if (result.err == err_parse_no_match)\n"
+            "            break;\n"
+            "        if (result.err || (result.err = parse_generated_add(node, "
+            "result.node)))\n"
+            "            return parse_generated_fail(node, result);\n"
+            "        current = result.next;\n"
+            "    }\n",
+            function);
+}
+
+static void emit_sequence_function(FILE *out, grammar_t *g, sequence_t *seq,
+                                   const char *name, const char *node_id,
+                                   bool is_static) {
+    fprintf(out,
+            "%sparse_result_t %s(tokenlist_entry_t *current) {\n"
+            "    ast_node_t *node;\n"
+            "    error_t *err = ast_node_alloc(&node);\n"
+            "    if (err)\n"
+            "        return parse_error(err);\n"
+            "    node->id = %s;\n"
+            "    parse_result_t result;\n",
+            is_static ? "static " : "", name, node_id);
+
+    for (size_t i = 0; i < seq->len; ++i) {
+        item_t *item = &seq->items[i];
+        bool first[max_tokens];
+        bool nullable;
+        element_first(g, item, first, &nullable);
+
+        fprintf(out, "\n");
+        if (is_list(seq, i)) {
+            emit_list(out, g, item,
+                      &seq->items[i + 1].group->alternatives[0]->items[0]);
+            i += 1;
+            continue;
+        }
+        switch (item->suffix) {
+        case 0:
+            emit_required(out, g, item);
+            break;
+        case '?':
+            emit_optional(out, g, item);
+            break;
+        case '+':
+            emit_required(out, g, item);
+            emit_repeat(out, g, item, nullable);
+            break;
+        case '*':
+            emit_repeat(out, g, item, nullable);
+            break;
+        }
+    }
+    fprintf(out, "\n    return parse_success(node, current);\n}\n\n");
+}
+
+static void emit_token_function(FILE *out, const char *name,
+                                const char *token, const char *node,
+                                const char *validator, bool is_static) {
+    fprintf(out,
+            "%sparse_result_t parse_generated_%s(tokenlist_entry_t "
+            "*current) {\n"
+            "    if (current == nullptr || current->token.id != TOKEN_%s",
+            is_static ? "[[maybe_unused]] static inline " : "", name, token);
+    if (validator)
+        fprintf(out, " ||\n        !%s(current->token.value)", validator);
+    fprintf(out,
+            ")\n"
+            "        return parse_no_match();\n"
+            "    return parse_token_node(current, NODE_%s);\n"
+            "}\n\n",
+            node);
+}
+
+static int compare_strings(const void *a, const void *b) {
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+static void emit_indent(FILE *out, size_t depth) {
+    for (size_t i = 0; i < depth; ++i)
+        fprintf(out, "    ");
+}
+
+/**
+ * Emits nested switches over the characters of the sorted values [lo, hi)
+ * which all share their first `depth` characters
+ */
+static void emit_literal_trie(FILE *out, char **values, size_t lo, size_t hi,
+                              size_t depth) {
+    size_t indent = depth + 1;
+    if (hi - lo == 1) {
+        emit_indent(out, indent);
+        if (values[lo][depth] == '\0')
+            fprintf(out, "return value[%zu] == '\\0';\n", depth);
+        else
+            fprintf(out, "return strcmp(value + %zu, \"%s\") == 0;\n", depth,
+                    values[lo] + depth);
+        return;
+    }
+
+    emit_indent(out, indent);
+    fprintf(out, "switch (value[%zu]) {\n", depth);
+    for (size_t i = lo; i < hi;) {
+        char c = values[i][depth];
+        size_t end = i + 1;
+        while (end < hi && values[end][depth] == c)
+            end++;
+
+        emit_indent(out, indent);
+        if (c == '\0') {
+            fprintf(out, "case '\\0':\n");
+            emit_indent(out, indent + 1);
+            fprintf(out, "return true;\n");
+        } else {
+            fprintf(out, "case '%c':\n", c);
+            emit_literal_trie(out, values, i, end, depth + 1);
+        }
+        i = end;
+    }
+    emit_indent(out, indent);
+    fprintf(out, "default:\n");
+    emit_indent(out, indent + 1);
+    fprintf(out, "return false;\n");
+    emit_indent(out, indent);
+    fprintf(out, "}\n");
+}
+
+/* Literal rules validate identifier tokens with a switch per character, so no
+ * more than a single string comparison is done for any identifier */
+static void emit_literal_validator(FILE *out, rule_t *rule) {
+    alternation_t *body = rule->body;
+    char *values[max_alternatives];
+    for (size_t i = 0; i < body->len; ++i)
+        values[i] = body->alternatives[i]->items[0].value;
+    qsort(values, body->len, sizeof(char *), compare_strings);
+
+    fprintf(out, "static bool parse_generated_is_%s(const char *value) {\n",
+            rule->name);
+    emit_literal_trie(out, values, 0, body->len, 0);
+    fprintf(out, "}\n\n");
+}
+
+static void emit_alternation_function(FILE *out, grammar_t *g,
+                                      alternation_t *alt, const char *name,
+                                      bool is_static) {
+    const char *functions[max_alternatives];
+    for (size_t i = 0; i < alt->len; ++i)
+        functions[i] = strdup(function_for(g, &alt->alternatives[i]->items[0]));
+
+    fprintf(out, "%sparse_result_t %s(tokenlist_entry_t *current) {\n",
+            is_static ? "static " : "", name);
+    emit_alternation_body(out, g, alt, functions);
+    fprintf(out, "}\n\n");
+
+    for (size_t i = 0; i < alt->len; ++i)
+        free((void *)functions[i]);
+}
+
+/**
+ * Emits an ordered choice between the given functions. Alternatives are
+ * dispatched with a switch on the current token using their FIRST sets, when
+ * an alternative can match nothing every alternative is simply tried in order.
+ */
+static void emit_alternation_body(FILE *out, grammar_t *g, alternation_t *alt,
+                                  const char **functions) {
+    bool firsts[max_alternatives][max_tokens] = {};
+    bool any_nullable = false;
+    for (size_t i = 0; i < alt->len; ++i) {
+        sequence_t *seq = alt->alternatives[i];
+        bool nullable = false;
+        if (seq->len == 1)
+            item_first(g, &seq->items[0], firsts[i], &nullable);
+        else
+            nullable = true;
+        any_nullable = any_nullable || nullable;
+    }
+
+    fprintf(out, "    parse_result_t result;\n");
+    if (any_nullable) {
+        for (size_t i = 0; i < alt->len; ++i)
+            fprintf(out,
+                    "    result = %s(current);\n"
+                    "    if (result.err == nullptr)\n"
+                    "        return result;\n",
+                    functions[i]);
+        fprintf(out, "    return parse_no_match();\n");
+        return;
+    }
+
+    fprintf(out, "    if (current == nullptr)\n"
+                 "        return parse_no_match();\n"
+                 "    switch (current->token.id) {\n");
+
+    bool done[max_tokens] = {};
+    for (size_t t = 0; t < g->token_count; ++t) {
+        if (done[t])
+            continue;
+        bool any = false;
+        for (size_t i = 0; i < alt->len; ++i)
+            any = any || firsts[i][t];
+        if (!any)
+            continue;
+
+        // Every token that dispatches to the same alternatives shares a case
+        for (size_t u = t; u < g->token_count; ++u) {
+            bool same = !done[u];
+            for (size_t i = 0; i < alt->len && same; ++i)
+                same = firsts[i][t] == firsts[i][u];
+            if (!same)
+                continue;
+            done[u] = true;
+            fprintf(out, "    case TOKEN_%s:\n", upper(g->tokens[u]));
+        }
+        for (size_t i = 0; i < alt->len; ++i) {
+            if (!firsts[i][t])
+                continue;
+            fprintf(out,
+                    "        result = %s(current);\n"
+                    "        if (result.err == nullptr)\n"
+                    "            return result;\n",
+                    functions[i]);
+        }
+        fprintf(out, "        return parse_no_match();\n");
+    }
+    fprintf(out, "    default:\n"
+                 "        return parse_no_match();\n"
+                 "    }\n");
+}
+
+static void name_groups(rule_t *rule, alternation_t *alt) {
+    for (size_t i = 0; i < alt->len; ++i) {
+        sequence_t *seq = alt->alternatives[i];
+        for (size_t j = 0; j < seq->len; ++j) {
+            if (seq->items[j].kind != ITEM_GROUP ||
+                (j > 0 && is_list(seq, j - 1)))
+                continue;
+            alternation_t *group = seq->items[j].group;
+            snprintf(group->function, sizeof(group->function),
+                     "parse_generated_%s_group%zu", rule->name,
+                     ++rule->group_count);
+            name_groups(rule, group);
+        }
+    }
+}
+
+static void emit_group_declarations(FILE *out, alternation_t *alt) {
+    for (size_t i = 0; i < alt->len; ++i) {
+        sequence_t *seq = alt->alternatives[i];
+        for (size_t j = 0; j < seq->len; ++j) {
+            if (seq->items[j].kind != ITEM_GROUP ||
+                (j > 0 && is_list(seq, j - 1)))
+                continue;
+            alternation_t *group = seq->items[j].group;
+            fprintf(out,
+                    "static parse_result_t %s(tokenlist_entry_t *current);\n",
+                    group->function);
+            emit_group_declarations(out, group);
+        }
+    }
+}
+
+static void emit_groups(FILE *out, grammar_t *g, alternation_t *alt) {
+    for (size_t i = 0; i < alt->len; ++i) {
+        sequence_t *seq = alt->alternatives[i];
+        for (size_t j = 0; j < seq->len; ++j) {
+            if (seq->items[j].kind != ITEM_GROUP ||
+                (j > 0 && is_list(seq, j - 1)))
+                continue;
+            alternation_t *group = seq->items[j].group;
+            emit_groups(out, g, group);
+
+            if (is_transparent(group)) {
+                emit_alternation_function(out, g, group, group->function,
+                                          true);
+                continue;
+            }
+            if (group->len == 1) {
+                emit_sequence_function(out, g, group->alternatives[0],
+                                       group->function, "NODE_INVALID", true);
+                continue;
+            }
+
+            // Alternatives that are sequences get a container function each
+            const char *functions[max_alternatives];
+            for (size_t k = 0; k < group->len; ++k) {
+                char name[4 * max_name_length];
+                snprintf(name, sizeof(name), "%s_%zu", group->function, k);
+                functions[k] = strdup(name);
+                fprintf(out,
+                        "static parse_result_t %s(tokenlist_entry_t "
+                        "*current);\n",
+                        name);
+                emit_sequence_function(out, g, group->alternatives[k], name,
+                                       "NODE_INVALID", true);
+            }
+            fprintf(out, "static parse_result_t %s(tokenlist_entry_t "
+                         "*current) {\n",
+                    group->function);
+            emit_alternation_body(out, g, group, functions);
+            fprintf(out, "}\n\n");
+            for (size_t k = 0; k < group->len; ++k)
+                free((void *)functions[k]);
+        }
+    }
+}
+
+static const char prelude[] =
+    "#include \"parser/generated.h\"\n"
+    "#include \"ast.h\"\n"
+    "#include \"tokenlist.h\"\n"
+    "#include <string.h>\n"
+    "\n"
+    "// Adds a parsed node to its parent, frees the child on failure\n"
+    "static inline error_t *parse_generated_add(ast_node_t *node,\n"
+    "                                           ast_node_t *child) {\n"
+    "    error_t *err = ast_node_add_child(node, child);\n"
+    "    if (err)\n"
+    "        ast_node_free(child);\n"
+    "    return err;\n"
+    "}\n"
+    "\n"
+    "// Moves the children of a group's container node into the parent\n"
+    "static inline error_t *parse_generated_splice(ast_node_t *node,\n"
+    "                                              ast_node_t *container) {\n"
+    "    error_t *err = ast_node_move_children(node, container);\n"
+    "    ast_node_free(container);\n"
+    "    return err;\n"
+    "}\n"
+    "\n"
+    "static inline parse_result_t parse_generated_fail(ast_node_t *node,\n"
+    "                                                  parse_result_t "
+    "result) {\n"
+    "    ast_node_free(node);\n"
+    "    return result;\n"
+    "}\n"
+    "\n";
+
+static void generate(grammar_t *g, FILE *out, FILE *header) {
+    fprintf(header,
+            "/* Generated by tools/parsergen.c from %s, do not edit */\n"
+            "#ifndef INCLUDE_PARSER_GENERATED_H_\n"
+            "#define INCLUDE_PARSER_GENERATED_H_\n"
+            "\n"
+            "#include \"parser/util.h\"\n"
+            "\n",
+            grammar_path);
+    for (size_t i = 0; i < g->rule_count; ++i)
+        fprintf(header,
+                "parse_result_t parse_generated_%s(tokenlist_entry_t "
+                "*current);\n",
+                g->rules[i].name);
+    fprintf(header, "\n#endif // INCLUDE_PARSER_GENERATED_H_\n");
+
+    fprintf(out, "/* Generated by tools/parsergen.c from %s, do not edit */\n",
+            grammar_path);
+    fprintf(out, "%s", prelude);
+
+    for (size_t i = 0; i < g->token_count; ++i) {
+        char token[max_name_length];
+        snprintf(token, sizeof(token), "%s", upper(g->tokens[i]));
+        emit_token_function(out, g->tokens[i], token, token, nullptr, true);
+    }
+
+    for (size_t i = 0; i < g->rule_count; ++i)
+        emit_group_declarations(out, g->rules[i].body);
+    fprintf(out, "\n");
+
+    for (size_t i = 0; i < g->rule_count; ++i) {
+        rule_t *rule = &g->rules[i];
+        char name[3 * max_name_length];
+        char node[3 * max_name_length];
+        snprintf(name, sizeof(name), "parse_generated_%s", rule->name);
+        snprintf(node, sizeof(node), "NODE_%s", upper(rule->name));
+
+        emit_groups(out, g, rule->body);
+        switch (rule->kind) {
+        case RULE_TOKEN: {
+            char token[max_name_length];
+            snprintf(token, sizeof(token), "%s",
+                     upper(rule->body->alternatives[0]->items[0].value));
+            emit_token_function(out, rule->name, token, node + 5, nullptr,
+                                false);
+            break;
+        }
+        case RULE_LITERAL: {
+            char validator[3 * max_name_length];
+            snprintf(validator, sizeof(validator), "parse_generated_is_%s",
+                     rule->name);
+            emit_literal_validator(out, rule);
+            emit_token_function(out, rule->name, "IDENTIFIER", node + 5,
+                                validator, false);
+            break;
+        }
+        case RULE_ALTERNATION:
+            emit_alternation_function(out, g, rule->body, name, false);
+            break;
+        case RULE_SEQUENCE:
+            emit_sequence_function(out, g, rule->body->alternatives[0], name,
+                                   node, false);
+            break;
+        }
+    }
+}
+
+static char *read_file(const char *path) {
+    FILE *fp = fopen(path, "rb");
+    if (fp == nullptr)
+        fail("can't open grammar");
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    char *text = checked_calloc(size + 1, 1);
+    if (fread(text, 1, size, fp) != (size_t)size)
+        fail("can't read grammar");
+    fclose(fp);
+    return text;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 4) {
+        fputs("Usage: parsergen <grammar> <output.c> <output.h>\n", stderr);
+        return 1;
+    }
+    grammar_path = argv[1];
+
+    grammar_t *g = checked_calloc(1, sizeof(grammar_t));
+    read_grammar(g, read_file(argv[1]));
+    add_token(g, "identifier");
+    for (size_t i = 0; i < g->rule_count; ++i)
+        collect_tokens(g, g->rules[i].body);
+    for (size_t i = 0; i < g->rule_count; ++i) {
+        classify(g, &g->rules[i]);
+        name_groups(&g->rules[i], g->rules[i].body);
+    }
+    compute_first(g);
+
+    FILE *out = fopen(argv[2], "w");
+    FILE *header = fopen(argv[3], "w");
+    if (out == nullptr || header == nullptr)
+        fail("can't open output files");
+    generate(g, out, header);
+    if (fclose(out) || fclose(header))
+        fail("can't write output files");
+    return 0;
+}
@@ -8,11 +8,246 @@ ASAN=build/asan/oas
 MSAN=build/msan/oas
 DEBUG=build/debug/oas
 
-ARGUMENTS=("tokens" "text" "ast")
+ARGUMENTS=("tokens" "text" "ast" "-s ast" "ast-reference" "symbols" "encode"
+           "-b encode" "boundaries" "-j 4 encode" "-S -j 4 encode"
+           "-O -S encode" "-s -O boundaries" "-d -S encode" "analyze"
+           "-m zen3 analyze")
+# Programs with diagnostics exit with 1, so the tools report with 2
+export ASAN_OPTIONS=exitcode=2 MSAN_OPTIONS=exitcode=2
 while IFS= read -r INPUT_FILE; do
-    for ARGS in ${ARGUMENTS[@]}; do
-        $ASAN $ARGS $INPUT_FILE > /dev/null
-        $MSAN $ARGS $INPUT_FILE > /dev/null
-        valgrind --leak-check=full --error-exitcode=1 $DEBUG $ARGS $INPUT_FILE >/dev/null
+    for ARGS in "${ARGUMENTS[@]}"; do
+        $ASAN $ARGS $INPUT_FILE > /dev/null || [[ $? -eq 1 ]]
+        $MSAN $ARGS $INPUT_FILE > /dev/null || [[ $? -eq 1 ]]
+        valgrind --leak-check=full --error-exitcode=2 $DEBUG $ARGS $INPUT_FILE >/dev/null || [[ $? -eq 1 ]]
     done
 done < <(find tests/input/ -type f -name '*.asm')
+
+# The generated parser has to produce exactly the same trees as the reference
+# parser combinators
+while IFS= read -r INPUT_FILE; do
+    diff <($DEBUG ast $INPUT_FILE) <($DEBUG ast-reference $INPUT_FILE)
+    # Sharing operand subtrees must not change what the tree looks like
+    diff <($DEBUG -s ast $INPUT_FILE) <($DEBUG ast $INPUT_FILE)
+    # Neither may encoding on a pool of threads change the code
+    diff <($DEBUG -j 4 encode $INPUT_FILE) <($DEBUG encode $INPUT_FILE)
+done < <(find tests/input/ -type f -name '*.asm')
+
+# Programs have no limit on the number of statements, parse one with a couple
+# million of them
+LARGE_INPUT=$(mktemp --suffix=.asm)
+OBJECT=$(mktemp --suffix=.o)
+OTHER_OBJECT=$(mktemp --suffix=.o)
+BINARY=$(mktemp --suffix=.bin)
+FLAT=$(mktemp --suffix=.bin)
+DEPFILE=$(mktemp --suffix=.d)
+HEADER=$(mktemp --suffix=.inc)
+# Small programs written for a single check
+SNIPPET=$(mktemp --suffix=.asm)
+trap 'rm -f "$LARGE_INPUT" "$OBJECT" "$OTHER_OBJECT" "$BINARY" "$FLAT" "$DEPFILE" "$HEADER" "$SNIPPET"' EXIT
+LARGE_STATEMENTS=2000000
+head -n $LARGE_STATEMENTS < <(yes "label:") > "$LARGE_INPUT"
+PARSED_STATEMENTS=$($DEBUG ast "$LARGE_INPUT" | grep -c "^  NODE_LABEL$")
+if [[ $PARSED_STATEMENTS -ne $LARGE_STATEMENTS ]]; then
+    echo "Parsed $PARSED_STATEMENTS of $LARGE_STATEMENTS statements in a large input"
+    exit 1
+fi
+
+# A single run reports every statement that can't be parsed, and fails
+if REPORT=$($DEBUG ast tests/input/invalid.asm); then
+    echo "Exited with 0 after diagnostics in tests/input/invalid.asm"
+    exit 1
+fi
+DIAGNOSTICS=$(grep -c "^[0-9]*:[0-9]*: " <<< "$REPORT")
+if [[ $DIAGNOSTICS -ne 7 ]]; then
+    echo "Reported $DIAGNOSTICS of 7 diagnostics in tests/input/invalid.asm"
+    exit 1
+fi
+# and when it parses, every value that doesn't fit its data
+DIAGNOSTICS=$($DEBUG -D DATA encode tests/input/invalid.asm | grep -c "doesn't fit" || true)
+if [[ $DIAGNOSTICS -ne 4 ]]; then
+    echo "Reported $DIAGNOSTICS of 4 values too large for their data"
+    exit 1
+fi
+
+# Every instruction in the encoder test input has to encode, including the ones
+# following instructions without operands and the ones referencing labels
+# before their definition
+UNENCODED=$($DEBUG encode tests/input/encode.asm | grep -vc "^[0-9a-f]\{8\} " || true)
+if [[ $UNENCODED -ne 0 ]]; then
+    echo "Failed to encode $UNENCODED instructions in tests/input/encode.asm"
+    exit 1
+fi
+
+# The encoder test input repeats instructions, those come from the cache
+CACHE=$($DEBUG -S encode tests/input/encode.asm 2>&1 >/dev/null)
+if [[ $CACHE != "encoding cache: "[1-9]*" hits, "* ]]; then
+    echo "No encodings came from the cache: $CACHE"
+    exit 1
+fi
+
+# The peephole pass rewrites only where the flags are dead and the result is
+# the same
+REWRITES=$($DEBUG -O -S encode tests/input/peephole.asm 2>&1 >/dev/null | tail -n 1)
+if [[ $REWRITES != "peephole: 8 rewrites" ]]; then
+    echo "Expected 8 rewrites in tests/input/peephole.asm: $REWRITES"
+    exit 1
+fi
+
+# Dead code goes, the labels .global names only in flat binaries where
+# nothing else can name them. What a jump to $ plus a number could land on
+# stays.
+DEAD=$($DEBUG -d -S encode tests/input/deadcode.asm 2>&1 >/dev/null | sed -n 1p)
+if [[ $DEAD != "dead code: 10 statements and 0 labels dropped" ]]; then
+    echo "Expected 10 dead statements in tests/input/deadcode.asm: $DEAD"
+    exit 1
+fi
+DEAD=$($DEBUG -d -S -o "$FLAT" bin tests/input/deadcode.asm 2>&1 >/dev/null | sed -n 1p)
+if [[ $DEAD != "dead code: 10 statements and 1 labels dropped" ]]; then
+    echo "Expected 10 dead statements in a flat binary: $DEAD"
+    exit 1
+fi
+
+# The loop waits for its load and the divide makes up most of the chain of
+# the other function, on both models
+ANALYSIS=$($DEBUG analyze tests/input/analyze.asm | grep '"label":"again"')
+if [[ $ANALYSIS != *'"throughput":1.00,"latency":6,'* ]]; then
+    echo "Expected a throughput of 1 and a latency of 6 on skylake: $ANALYSIS"
+    exit 1
+fi
+ANALYSIS=$($DEBUG -m zen3 analyze tests/input/analyze.asm | grep '"label":"divide"')
+if [[ $ANALYSIS != *'"throughput":12.00,"latency":24,"bottleneck":"alu2"'* ]]; then
+    echo "Expected the divider to bound the divide on zen3: $ANALYSIS"
+    exit 1
+fi
+
+# Shifts by cl and xchg with the accumulator take their one byte opcodes, but
+# xchg eax, eax isn't nop, which would leave the upper half of rax alone
+printf 'shl eax, cl\nxchg eax, ecx\nxchg eax, eax\n' > "$SNIPPET"
+diff <($DEBUG encode "$SNIPPET" | cut -c 11-) <(printf 'd3 e0\n91\n87 c0\n')
+
+# The symbols of a program are its labels with their lines and sections
+diff <($DEBUG symbols tests/input/data.asm) \
+     <(printf '_start\t7\ttext\ntable\t13\ttext\ndone\t16\ttext\n')
+# with the labels of macros where they expand and none of unused bodies
+diff <($DEBUG symbols tests/input/macros.asm) \
+     <(printf 'start\t33\ttext\ncleared\t18\ttext\ntable\t49\ttext\ntable_end\t51\ttext\n')
+
+# Padding keeps every branch of the encoder test input off the 32 byte
+# boundaries and every short loop within a cache line
+REPORT=$($DEBUG -b boundaries tests/input/encode.asm | tail -n 1)
+if [[ $REPORT != "0 of "*", 0 of "* ]]; then
+    echo "Padding left branches or loops on boundaries: $REPORT"
+    exit 1
+fi
+
+# Object files have to be accepted by the linker
+$ASAN -o "$OBJECT" encode tests/input/encode.asm
+$MSAN -o "$OBJECT" encode tests/input/encode.asm
+ld -o /dev/null "$OBJECT"
+$ASAN -b -o "$OBJECT" encode tests/input/encode.asm
+ld -o /dev/null "$OBJECT"
+# A branch to a label of another object leaves its displacement to the
+# relocation, the object has zeros there
+printf '_start:\n    jmp elsewhere\n    ret\n' > "$SNIPPET"
+$ASAN -o "$OBJECT" encode "$SNIPPET"
+objcopy -O binary -j .text "$OBJECT" "$BINARY"
+BRANCH=$(head -c 5 "$BINARY" | od -An -tx1)
+if [[ $BRANCH != " e9 00 00 00 00" ]]; then
+    echo "Expected a zero displacement for a label of another object: $BRANCH"
+    exit 1
+fi
+
+# Labels are local unless .global names them, so objects using the same
+# label names link
+printf '.global _start\n_start:\nloop:\n    call helper\n    jmp loop\n' > "$SNIPPET"
+$ASAN -o "$OBJECT" encode "$SNIPPET"
+printf '.globl helper\nhelper:\nloop:\n    dec ecx\n    jnz loop\n    ret\n' > "$SNIPPET"
+$ASAN -o "$OTHER_OBJECT" encode "$SNIPPET"
+ld -o "$BINARY" "$OBJECT" "$OTHER_OBJECT"
+
+# Sharing operand subtrees leaves every error about a label where the label
+# is named
+printf '_start:\n    jmp nowhere\n    jmp nowhere\n' > "$SNIPPET"
+diff <($DEBUG -s encode "$SNIPPET") <($DEBUG encode "$SNIPPET")
+
+# Included files end up in the object as they are, and tables of labels link
+$ASAN -o "$OBJECT" encode tests/input/data.asm
+$MSAN -o "$OBJECT" encode tests/input/data.asm
+ld -o /dev/null "$OBJECT"
+objcopy -O binary -j .text "$OBJECT" "$BINARY"
+INCLUDED=$(stat -c %s tests/input/encode.asm)
+cmp <(tail -c +17 "$BINARY" | head -c "$INCLUDED") tests/input/encode.asm
+
+# A flat binary of a single section at address 0 is the linked code of the
+# section
+$ASAN -o "$FLAT" bin tests/input/data.asm
+$MSAN -o "$FLAT" bin tests/input/data.asm
+cmp "$FLAT" "$BINARY"
+
+# Expressions fold into signed numbers, differences resolve in the assembler
+# and $ links through the symbol of its section
+ENCODED=$($DEBUG encode tests/input/expressions.asm)
+for FOLDED in "b8 15 00 00 00" "2a 00 00 00 00 00 00 00" "b8 fc ff ff ff" \
+              "48 83 c0 fd" "b9 fc ff ff ff" "be fd ff ff ff" "ba 0d 00 00 00"; do
+    if [[ $ENCODED != *"$FOLDED"* ]]; then
+        echo "Folded tests/input/expressions.asm without $FOLDED: $ENCODED"
+        exit 1
+    fi
+done
+$ASAN -o "$OBJECT" encode tests/input/expressions.asm
+$MSAN -o "$OBJECT" encode tests/input/expressions.asm
+ld -o /dev/null "$OBJECT"
+objcopy -O binary -j .text "$OBJECT" "$BINARY"
+$ASAN -o "$FLAT" bin tests/input/expressions.asm
+cmp "$FLAT" "$BINARY"
+
+# Macros and repetitions expand to every statement they stand for, a large
+# repetition as well
+EXPANDED=$($DEBUG encode tests/input/macros.asm | grep -c "^[0-9a-f]\{8\} ")
+if [[ $EXPANDED -ne 20 ]]; then
+    echo "Expanded $EXPANDED of 20 statements in tests/input/macros.asm"
+    exit 1
+fi
+printf '.rept %d\n    nop\n.endr\n' $LARGE_STATEMENTS > "$SNIPPET"
+PARSED_STATEMENTS=$($DEBUG ast "$SNIPPET" | grep -c "^  NODE_INSTRUCTION$")
+if [[ $PARSED_STATEMENTS -ne $LARGE_STATEMENTS ]]; then
+    echo "Parsed $PARSED_STATEMENTS of $LARGE_STATEMENTS repeated statements"
+    exit 1
+fi
+
+# Conditional blocks follow the names defined on the command line, dropped
+# blocks never reach the token list
+ENCODED=$($DEBUG -D VERSION=3 encode tests/input/conditional.asm)
+if [[ $ENCODED != *"83 c0 06"* || $ENCODED == *"31 c0"* ]]; then
+    echo "Kept the wrong blocks of tests/input/conditional.asm: $ENCODED"
+    exit 1
+fi
+ENCODED=$($DEBUG -D LARGE -D VERSION=1 encode tests/input/conditional.asm | wc -l)
+if [[ $ENCODED -ne 2 ]]; then
+    echo "Expected 2 instructions with LARGE defined, got $ENCODED"
+    exit 1
+fi
+LEXED=$($DEBUG tokens tests/input/conditional.asm | grep -c TOKEN_ERROR || true)
+if [[ $LEXED -ne 0 ]]; then
+    echo "Lexed a dropped block of tests/input/conditional.asm"
+    exit 1
+fi
+
+# Included files expand like the lines they replace, and the dependency file
+# of the output lists them for make
+ENCODED=$($DEBUG encode tests/input/include.asm | grep -c "^[0-9a-f]\{8\} ")
+if [[ $ENCODED -ne 10 ]]; then
+    echo "Expanded $ENCODED of 10 statements in tests/input/include.asm"
+    exit 1
+fi
+$ASAN -o "$OBJECT" -MF "$DEPFILE" encode tests/input/include.asm
+ld -o /dev/null "$OBJECT"
+if [[ $(cat "$DEPFILE") != *"tests/input/include.inc"* ]]; then
+    echo "Dependencies of tests/input/include.asm are missing its include"
+    exit 1
+fi
+# The symbols of an included file are listed with their line in the file
+printf 'helper:\n    ret\n' > "$HEADER"
+printf '.section text\nstart:\n    .include "%s"\n' "$HEADER" > "$SNIPPET"
+diff <($DEBUG symbols "$SNIPPET") \
+     <(printf 'start\t2\ttext\nhelper\t1\ttext\n')